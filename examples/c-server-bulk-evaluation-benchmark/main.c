@@ -0,0 +1,158 @@
+// Compares evaluating a set of flags for one context with one
+// LDServerSDK_JsonVariationDetail call per flag against a single
+// LDServerSDK_JsonVariationDetails call, as a language binding would.
+//
+// Usage: c-server-bulk-evaluation-benchmark [flag-key...]
+//
+// If LD_SDK_KEY is set, the SDK connects to LaunchDarkly; otherwise it runs
+// offline, which measures the cost of crossing into the SDK rather than of
+// flag rules. If no flag keys are given, NUM_GENERATED_FLAGS generated keys
+// are evaluated.
+
+#include <launchdarkly/server_side/bindings/c/sdk.h>
+
+#include <launchdarkly/bindings/c/context_builder.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_GENERATED_FLAGS 50
+
+// The number of times every flag is evaluated by each method.
+#define ITERATIONS 2000
+
+#define INIT_TIMEOUT_MILLISECONDS 3000
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Evaluates each flag with its own call, reading the same information the
+// bulk call returns.
+static void evaluate_individually(LDServerSDK sdk,
+                                  LDContext context,
+                                  char const* const* keys,
+                                  LDValue const* defaults,
+                                  size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        LDEvalDetail detail = NULL;
+        LDValue value = LDServerSDK_JsonVariationDetail(
+            sdk, context, keys[i], defaults[i], &detail);
+
+        size_t variation_index = 0;
+        (void)LDEvalDetail_VariationIndex(detail, &variation_index);
+        LDEvalReason reason = NULL;
+        if (LDEvalDetail_Reason(detail, &reason)) {
+            (void)LDEvalReason_Kind(reason);
+        }
+
+        LDValue_Free(value);
+        LDEvalDetail_Free(detail);
+    }
+}
+
+static void evaluate_in_bulk(LDServerSDK sdk,
+                             LDContext context,
+                             char const* const* keys,
+                             LDValue const* defaults,
+                             size_t count,
+                             struct LDServerEvaluationResult* results) {
+    LDServerSDK_JsonVariationDetails(sdk, context, keys, defaults, count,
+                                     results);
+    LDServerEvaluationResults_Free(results, count);
+}
+
+int main(int argc, char** argv) {
+    char const* sdk_key = getenv("LD_SDK_KEY");
+    bool const online = sdk_key && strlen(sdk_key);
+
+    size_t count = NUM_GENERATED_FLAGS;
+    char** generated_keys = NULL;
+    char const** keys = NULL;
+    if (argc > 1) {
+        count = (size_t)(argc - 1);
+        keys = (char const**)(argv + 1);
+    } else {
+        generated_keys = malloc(count * sizeof(char*));
+        for (size_t i = 0; i < count; i++) {
+            generated_keys[i] = malloc(32);
+            snprintf(generated_keys[i], 32, "flag-%zu", i);
+        }
+        keys = (char const**)generated_keys;
+    }
+
+    LDServerConfigBuilder config_builder =
+        LDServerConfigBuilder_New(online ? sdk_key : "sdk-key");
+    LDServerConfigBuilder_Offline(config_builder, !online);
+
+    LDServerConfig config = NULL;
+    LDStatus config_status =
+        LDServerConfigBuilder_Build(config_builder, &config);
+    if (!LDStatus_Ok(config_status)) {
+        printf("error: config is invalid: %s", LDStatus_Error(config_status));
+        return 1;
+    }
+
+    LDServerSDK sdk = LDServerSDK_New(config);
+
+    bool initialized_successfully = false;
+    LDServerSDK_Start(sdk, INIT_TIMEOUT_MILLISECONDS,
+                      &initialized_successfully);
+    if (online && !initialized_successfully) {
+        printf("*** SDK failed to initialize\n");
+        return 1;
+    }
+
+    LDContextBuilder context_builder = LDContextBuilder_New();
+    LDContextBuilder_AddKind(context_builder, "user", "benchmark-user-key");
+    LDContext context = LDContextBuilder_Build(context_builder);
+
+    LDValue* defaults = malloc(count * sizeof(LDValue));
+    for (size_t i = 0; i < count; i++) {
+        defaults[i] = LDValue_NewBool(false);
+    }
+    struct LDServerEvaluationResult* results =
+        malloc(count * sizeof(struct LDServerEvaluationResult));
+
+    double start = now_seconds();
+    for (int i = 0; i < ITERATIONS; i++) {
+        evaluate_individually(sdk, context, keys, defaults, count);
+    }
+    double const individual_seconds = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < ITERATIONS; i++) {
+        evaluate_in_bulk(sdk, context, keys, defaults, count, results);
+    }
+    double const bulk_seconds = now_seconds() - start;
+
+    double const evaluations = (double)count * ITERATIONS;
+    printf("%zu flags x %d iterations (%s)\n", count, ITERATIONS,
+           online ? "online" : "offline");
+    printf("  one call per flag: %8.1f ns/flag\n",
+           individual_seconds * 1e9 / evaluations);
+    printf("  one call per set:  %8.1f ns/flag\n",
+           bulk_seconds * 1e9 / evaluations);
+
+    for (size_t i = 0; i < count; i++) {
+        LDValue_Free(defaults[i]);
+    }
+    free(defaults);
+    free(results);
+    if (generated_keys) {
+        for (size_t i = 0; i < count; i++) {
+            free(generated_keys[i]);
+        }
+        free(generated_keys);
+    }
+
+    LDContext_Free(context);
+    LDServerSDK_Free(sdk);
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+// Measures end-to-end bootstrap latency: evaluating every flag for one
+// context and producing the JSON handed to a client-side SDK. It compares
+// AllFlagsState followed by boost::json serialization against
+// AllFlagsStateJson, which writes the JSON while evaluating.
+//
+// Usage: cpp-server-all-flags-state-benchmark [number-of-flags]
+//
+// The flags are served from memory through a lazy-load source with a long
+// cache refresh, so after the first iteration no time is spent fetching or
+// parsing flags and the measurement covers evaluation and serialization only.
+
+#include <launchdarkly/context_builder.hpp>
+#include <launchdarkly/server_side/client.hpp>
+#include <launchdarkly/server_side/config/config_builder.hpp>
+#include <launchdarkly/server_side/integrations/data_reader/iserialized_data_reader.hpp>
+#include <launchdarkly/server_side/serialization/json_all_flags_state.hpp>
+
+#include <boost/json.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#define DEFAULT_NUM_FLAGS 4096
+
+#define ITERATIONS 200
+
+#define INIT_TIMEOUT_MILLISECONDS 3000
+
+using namespace launchdarkly;
+using namespace launchdarkly::server_side;
+
+namespace {
+
+// Serves a fixed set of flags, and no segments.
+class InMemoryReader final : public integrations::ISerializedDataReader {
+   public:
+    explicit InMemoryReader(std::size_t num_flags) {
+        for (std::size_t i = 0; i < num_flags; i++) {
+            std::string const key = "flag-" + std::to_string(i);
+            flags_.emplace(key, integrations::SerializedItemDescriptor::Present(
+                                    1, FlagJson(key, i)));
+        }
+    }
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        if (kind.Namespace() != "features") {
+            return std::nullopt;
+        }
+        if (auto it = flags_.find(itemKey); it != flags_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        if (kind.Namespace() != "features") {
+            return AllResult::value_type{};
+        }
+        return flags_;
+    }
+
+    std::string const& Identity() const override { return identity_; }
+
+    bool Initialized() const override { return true; }
+
+   private:
+    // A flag with a targeting rule, so that most contexts fall through after
+    // evaluating a clause. Every fourth flag is tracked, so that its details
+    // are included when DetailsOnlyForTrackedFlags is set.
+    static std::string FlagJson(std::string const& key, std::size_t i) {
+        return R"({"key":")" + key + R"(","version":1,"on":true,)" +
+               R"("variations":[false,true,{"size":)" + std::to_string(i) +
+               R"(}],"offVariation":0,"fallthrough":{"variation":1},)" +
+               R"("targets":[{"variation":2,"values":["target-)" +
+               std::to_string(i) + R"("]}],)" +
+               R"("rules":[{"id":"rule-0","variation":0,"clauses":[)" +
+               R"({"attribute":"email","op":"endsWith",)" +
+               R"("values":["@example.com"]}]}],)" +
+               R"("trackEvents":)" + (i % 4 == 0 ? "true" : "false") +
+               R"(,"clientSide":true,"salt":"salt"})";
+    }
+
+    std::unordered_map<std::string, integrations::SerializedItemDescriptor>
+        flags_;
+    std::string identity_ = "in-memory";
+};
+
+template <typename Fn>
+double NanosecondsPerCall(Fn&& fn) {
+    auto const start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        fn();
+    }
+    std::chrono::duration<double, std::nano> const elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ITERATIONS;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t const num_flags =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : DEFAULT_NUM_FLAGS;
+
+    auto config_builder = ConfigBuilder("sdk-key");
+    config_builder.Events().Disable();
+
+    using LazyLoad = server_side::config::builders::LazyLoadBuilder;
+    config_builder.DataSystem().Method(
+        LazyLoad()
+            .Source(std::make_shared<InMemoryReader>(num_flags))
+            .CacheRefresh(std::chrono::hours(1)));
+
+    auto config = config_builder.Build();
+    if (!config) {
+        std::cout << "error: config is invalid: " << config.error() << '\n';
+        return 1;
+    }
+
+    auto client = Client(std::move(*config));
+    auto start_result = client.StartAsync();
+    if (start_result.wait_for(std::chrono::milliseconds(
+            INIT_TIMEOUT_MILLISECONDS)) != std::future_status::ready ||
+        !start_result.get()) {
+        std::cout << "*** SDK failed to initialize\n";
+        return 1;
+    }
+
+    auto const context =
+        ContextBuilder().Kind("user", "benchmark-user-key").Build();
+
+    std::cout << num_flags << " flags x " << ITERATIONS << " iterations\n";
+
+    for (auto const options :
+         {AllFlagsState::Options::Default,
+          AllFlagsState::Options::ClientSideOnly |
+              AllFlagsState::Options::IncludeReasons |
+              AllFlagsState::Options::DetailsOnlyForTrackedFlags}) {
+        std::string via_dom;
+        std::string direct;
+
+        // Warm the flag cache before measuring.
+        client.AllFlagsStateJson(context, direct, options);
+
+        double const dom_ns = NanosecondsPerCall([&] {
+            auto const state = client.AllFlagsState(context, options);
+            via_dom = boost::json::serialize(boost::json::value_from(state));
+        });
+        double const direct_ns = NanosecondsPerCall(
+            [&] { client.AllFlagsStateJson(context, direct, options); });
+
+        if (boost::json::parse(via_dom) != boost::json::parse(direct)) {
+            std::cout << "error: outputs differ\n";
+            return 1;
+        }
+
+        std::cout << "  options " << static_cast<int>(options) << ", "
+                  << direct.size() << " bytes of JSON\n";
+        std::cout << "    AllFlagsState + boost::json: " << dom_ns / 1e6
+                  << " ms\n";
+        std::cout << "    AllFlagsStateJson:           " << direct_ns / 1e6
+                  << " ms\n";
+    }
+
+    return 0;
+}
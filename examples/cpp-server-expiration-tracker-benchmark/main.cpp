@@ -0,0 +1,114 @@
+// Measures the Lazy Load expiration tracker with many tracked keys: the cost
+// of tracking and looking up a key, and of pruning expired keys. Pruning by a
+// full scan of the tracker is compared against PruneExpired, which visits
+// only the keys added with AddExpiring that have expired.
+//
+// Usage: cpp-server-expiration-tracker-benchmark [number-of-keys]
+//
+// Half of the keys model cached items, which are never pruned, and half
+// model keys missing from the store, which are. Expirations are spread
+// evenly over one TTL, and the clock advances through it in fixed steps,
+// pruning at each one.
+
+#include <data_components/expiration_tracker/expiration_tracker.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DEFAULT_NUM_KEYS 100000
+
+#define PRUNE_STEPS 100
+
+using launchdarkly::server_side::data_components::DataKind;
+using launchdarkly::server_side::data_components::ExpirationTracker;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+ExpirationTracker::TimePoint At(std::size_t step) {
+    return ExpirationTracker::TimePoint{std::chrono::seconds(step)};
+}
+
+double ElapsedNanoseconds(Clock::time_point const start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start)
+        .count();
+}
+
+// Tracks every key, with the missing ones added as expiring if requested.
+void Populate(ExpirationTracker& tracker,
+              std::vector<std::string> const& keys,
+              bool expiring) {
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        auto const expiration = At(i % PRUNE_STEPS);
+        if (i % 2 == 1 && expiring) {
+            tracker.AddExpiring(DataKind::kFlag, keys[i], expiration);
+        } else {
+            tracker.Add(DataKind::kFlag, keys[i], expiration);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t const num_keys =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : DEFAULT_NUM_KEYS;
+
+    std::vector<std::string> keys;
+    keys.reserve(num_keys);
+    for (std::size_t i = 0; i < num_keys; i++) {
+        keys.push_back("flag-" + std::to_string(i));
+    }
+
+    std::cout << num_keys << " tracked keys, " << PRUNE_STEPS
+              << " prune steps\n";
+
+    ExpirationTracker scanned;
+    auto start = Clock::now();
+    Populate(scanned, keys, false);
+    std::cout << "  Add:                 "
+              << ElapsedNanoseconds(start) / num_keys << " ns/key\n";
+
+    ExpirationTracker incremental;
+    start = Clock::now();
+    Populate(incremental, keys, true);
+    std::cout << "  Add (half expiring): "
+              << ElapsedNanoseconds(start) / num_keys << " ns/key\n";
+
+    start = Clock::now();
+    std::size_t stale = 0;
+    for (auto const& key : keys) {
+        stale += incremental.State(DataKind::kFlag, key, At(PRUNE_STEPS / 2)) ==
+                 ExpirationTracker::TrackState::kStale;
+    }
+    std::cout << "  State:               "
+              << ElapsedNanoseconds(start) / num_keys << " ns/key (" << stale
+              << " stale)\n";
+
+    // A full scan can't tell cached items from missing ones, so it prunes
+    // both; it stands in for the cost of the scan, not for its result.
+    std::size_t scan_pruned = 0;
+    start = Clock::now();
+    for (std::size_t step = 1; step <= PRUNE_STEPS; step++) {
+        scan_pruned += scanned.Prune(At(step)).size();
+    }
+    auto const scan_ns = ElapsedNanoseconds(start) / PRUNE_STEPS;
+
+    std::size_t incremental_pruned = 0;
+    start = Clock::now();
+    for (std::size_t step = 1; step <= PRUNE_STEPS; step++) {
+        incremental_pruned += incremental.PruneExpired(At(step));
+    }
+    auto const incremental_ns = ElapsedNanoseconds(start) / PRUNE_STEPS;
+
+    std::cout << "  Prune (full scan):   " << scan_ns / 1e3 << " us/step, "
+              << scan_pruned << " keys pruned\n";
+    std::cout << "  PruneExpired:        " << incremental_ns / 1e3
+              << " us/step, " << incremental_pruned << " keys pruned\n";
+
+    return 0;
+}
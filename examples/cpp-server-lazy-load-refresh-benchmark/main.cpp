@@ -0,0 +1,175 @@
+// Measures evaluation latency when Lazy Load's cached flag has gone stale,
+// comparing the Synchronous and StaleWhileRevalidate refresh policies.
+//
+// Usage: cpp-server-lazy-load-refresh-benchmark [store-latency-ms]
+//
+// The store answers every query after a fixed delay. Between evaluations the
+// benchmark sleeps past the cache TTL, so every evaluation finds the flag
+// stale. With Synchronous refresh each one waits for the store; with
+// StaleWhileRevalidate each one is served from the cache while the refresh
+// runs in the background.
+
+#include <launchdarkly/context_builder.hpp>
+#include <launchdarkly/server_side/client.hpp>
+#include <launchdarkly/server_side/config/config_builder.hpp>
+#include <launchdarkly/server_side/integrations/data_reader/iserialized_data_reader.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define DEFAULT_STORE_LATENCY_MILLISECONDS 5
+
+#define CACHE_TTL_MILLISECONDS 10
+
+#define ITERATIONS 200
+
+#define INIT_TIMEOUT_MILLISECONDS 3000
+
+using namespace launchdarkly;
+using namespace launchdarkly::server_side;
+
+using LazyLoad = server_side::config::builders::LazyLoadBuilder;
+
+namespace {
+
+// Serves a single flag, and no segments, after a fixed delay.
+class SlowReader final : public integrations::ISerializedDataReader {
+   public:
+    explicit SlowReader(std::chrono::milliseconds latency)
+        : latency_(latency) {}
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        std::this_thread::sleep_for(latency_);
+        queries_++;
+        if (kind.Namespace() != "features" || itemKey != kFlagKey) {
+            return std::nullopt;
+        }
+        return integrations::SerializedItemDescriptor::Present(
+            1,
+            R"({"key":"benchmark-flag","version":1,"on":true,)"
+            R"("variations":[false,true],"offVariation":0,)"
+            R"("fallthrough":{"variation":1},"salt":"salt"})");
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        std::this_thread::sleep_for(latency_);
+        queries_++;
+        return AllResult::value_type{};
+    }
+
+    std::string const& Identity() const override { return identity_; }
+
+    bool Initialized() const override { return true; }
+
+    [[nodiscard]] std::size_t Queries() const { return queries_; }
+
+    static constexpr char const* kFlagKey = "benchmark-flag";
+
+   private:
+    std::chrono::milliseconds const latency_;
+    mutable std::atomic<std::size_t> queries_{0};
+    std::string identity_ = "slow-in-memory";
+};
+
+struct Latencies {
+    double median_us;
+    double p99_us;
+    double max_us;
+    std::size_t queries;
+};
+
+std::optional<Latencies> Measure(LazyLoad::RefreshPolicy const policy,
+                                 std::chrono::milliseconds const latency) {
+    auto reader = std::make_shared<SlowReader>(latency);
+
+    auto config_builder = ConfigBuilder("sdk-key");
+    config_builder.Events().Disable();
+    config_builder.DataSystem().Method(
+        LazyLoad()
+            .Source(reader)
+            .CacheRefresh(std::chrono::milliseconds(CACHE_TTL_MILLISECONDS))
+            .CacheRefreshPolicy(policy));
+
+    auto config = config_builder.Build();
+    if (!config) {
+        std::cout << "error: config is invalid: " << config.error() << '\n';
+        return std::nullopt;
+    }
+
+    auto client = Client(std::move(*config));
+    auto start_result = client.StartAsync();
+    if (start_result.wait_for(std::chrono::milliseconds(
+            INIT_TIMEOUT_MILLISECONDS)) != std::future_status::ready ||
+        !start_result.get()) {
+        std::cout << "*** SDK failed to initialize\n";
+        return std::nullopt;
+    }
+
+    auto const context =
+        ContextBuilder().Kind("user", "benchmark-user-key").Build();
+
+    // Populate the cache; a miss is fetched synchronously under either
+    // policy, so it isn't part of the measurement.
+    client.BoolVariation(context, SlowReader::kFlagKey, false);
+    auto const queries_before = reader->Queries();
+
+    std::vector<double> samples;
+    samples.reserve(ITERATIONS);
+    for (int i = 0; i < ITERATIONS; i++) {
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(CACHE_TTL_MILLISECONDS) + latency);
+
+        auto const start = std::chrono::steady_clock::now();
+        if (!client.BoolVariation(context, SlowReader::kFlagKey, false)) {
+            std::cout << "error: unexpected evaluation result\n";
+            return std::nullopt;
+        }
+        std::chrono::duration<double, std::micro> const elapsed =
+            std::chrono::steady_clock::now() - start;
+        samples.push_back(elapsed.count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    return Latencies{samples[samples.size() / 2],
+                     samples[samples.size() * 99 / 100], samples.back(),
+                     reader->Queries() - queries_before};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::chrono::milliseconds const store_latency(
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                 : DEFAULT_STORE_LATENCY_MILLISECONDS);
+
+    std::cout << ITERATIONS << " evaluations of a stale flag, store latency "
+              << store_latency.count() << " ms, cache TTL "
+              << CACHE_TTL_MILLISECONDS << " ms\n";
+
+    using RefreshPolicy = LazyLoad::RefreshPolicy;
+    for (auto const& [policy, name] :
+         {std::make_pair(RefreshPolicy::Synchronous, "Synchronous"),
+          std::make_pair(RefreshPolicy::StaleWhileRevalidate,
+                         "StaleWhileRevalidate")}) {
+        auto const latencies = Measure(policy, store_latency);
+        if (!latencies) {
+            return 1;
+        }
+        std::cout << "  " << name << ": median " << latencies->median_us
+                  << " us, p99 " << latencies->p99_us << " us, max "
+                  << latencies->max_us << " us, " << latencies->queries
+                  << " store queries\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+// Measures Big Segment membership cache throughput as the number of
+// evaluating threads grows. It compares the SDK's sharded CLOCK cache against
+// the single-mutex LRU it replaced, which is reproduced below.
+//
+// Usage: cpp-server-membership-cache-benchmark [max-threads]
+//
+// Each thread repeatedly looks up context keys drawn from a set slightly
+// larger than the cache, inserting on a miss as the SDK does after querying
+// the store. Most lookups therefore hit, which is the contended path.
+
+#include <data_components/big_segments/membership_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define CACHE_CAPACITY 1000
+
+#define KEY_COUNT 1050
+
+#define RUN_MILLISECONDS 500
+
+using launchdarkly::server_side::data_components::CompactMembership;
+using launchdarkly::server_side::data_components::MembershipCache;
+
+namespace {
+
+using MembershipPtr = std::shared_ptr<CompactMembership const>;
+
+// The membership cache as it was before sharding: one mutex over a map and a
+// recency list, which every hit splices.
+class SingleMutexLruCache {
+   public:
+    SingleMutexLruCache(std::size_t capacity, std::chrono::milliseconds ttl)
+        : capacity_(capacity), ttl_(ttl) {}
+
+    MembershipPtr Get(std::string const& key) {
+        std::lock_guard lock(mutex_);
+        auto const it = entries_.find(key);
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        if (std::chrono::steady_clock::now() >= it->second.expires_at) {
+            recency_.erase(it->second.recency_position);
+            entries_.erase(it);
+            return nullptr;
+        }
+        recency_.splice(recency_.begin(), recency_,
+                        it->second.recency_position);
+        return it->second.membership;
+    }
+
+    void Set(std::string const& key, MembershipPtr membership) {
+        std::lock_guard lock(mutex_);
+        auto const expires_at = std::chrono::steady_clock::now() + ttl_;
+        auto const it = entries_.find(key);
+        if (it != entries_.end()) {
+            recency_.splice(recency_.begin(), recency_,
+                            it->second.recency_position);
+            it->second.membership = std::move(membership);
+            it->second.expires_at = expires_at;
+            return;
+        }
+        recency_.push_front(key);
+        entries_.emplace(
+            key, Entry{recency_.begin(), std::move(membership), expires_at});
+        if (entries_.size() > capacity_) {
+            entries_.erase(recency_.back());
+            recency_.pop_back();
+        }
+    }
+
+   private:
+    struct Entry {
+        std::list<std::string>::iterator recency_position;
+        MembershipPtr membership;
+        std::chrono::steady_clock::time_point expires_at;
+    };
+
+    std::size_t const capacity_;
+    std::chrono::milliseconds const ttl_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> recency_;
+};
+
+// Runs the workload on the given number of threads and returns lookups per
+// second across all of them.
+template <typename Cache>
+double LookupsPerSecond(Cache& cache,
+                        std::vector<std::string> const& keys,
+                        std::size_t num_threads) {
+    auto const membership = std::make_shared<CompactMembership const>(
+        std::vector<std::pair<std::uint32_t, bool>>{{1, true}, {2, false}});
+
+    for (std::size_t i = 0; i < CACHE_CAPACITY; i++) {
+        cache.Set(keys[i], membership);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> total{0};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            std::minstd_rand rng(static_cast<unsigned>(t + 1));
+            std::uniform_int_distribution<std::size_t> pick(0,
+                                                            keys.size() - 1);
+            std::uint64_t lookups = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto const& key = keys[pick(rng)];
+                if (!cache.Get(key)) {
+                    cache.Set(key, membership);
+                }
+                lookups++;
+            }
+            total += lookups;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(RUN_MILLISECONDS));
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(total) * 1000.0 / RUN_MILLISECONDS;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t const max_threads =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                 : std::max(2u, std::thread::hardware_concurrency() * 2);
+
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < KEY_COUNT; i++) {
+        keys.push_back("context-" + std::to_string(i));
+    }
+
+    std::cout << "capacity " << CACHE_CAPACITY << ", " << KEY_COUNT
+              << " keys, " << std::thread::hardware_concurrency()
+              << " hardware threads\n";
+    std::cout << "threads  single-mutex LRU  sharded CLOCK  (M lookups/s)\n";
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        SingleMutexLruCache lru(CACHE_CAPACITY, std::chrono::hours(1));
+        MembershipCache sharded(CACHE_CAPACITY, std::chrono::hours(1));
+
+        double const lru_rate = LookupsPerSecond(lru, keys, threads);
+        double const sharded_rate = LookupsPerSecond(sharded, keys, threads);
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(7)
+                  << threads << std::setw(18) << lru_rate / 1e6
+                  << std::setw(15) << sharded_rate / 1e6 << '\n';
+    }
+
+    return 0;
+}
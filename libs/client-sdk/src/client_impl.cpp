@@ -8,6 +8,7 @@
 
 #include <launchdarkly/detail/c_binding_helpers.hpp>
 #include <launchdarkly/encoding/sha_256.hpp>
+#include <launchdarkly/logging/async_backend.hpp>
 #include <launchdarkly/logging/console_backend.hpp>
 #include <launchdarkly/logging/null_logger.hpp>
 
@@ -66,11 +67,15 @@ static Logger MakeLogger(config::shared::built::Logging const& config) {
     if (config.disable_logging) {
         return {std::make_shared<logging::NullLoggerBackend>()};
     }
-    if (config.backend) {
-        return {config.backend};
+    std::shared_ptr<ILogBackend> backend =
+        config.backend ? config.backend
+                       : std::make_shared<logging::ConsoleBackend>(config.level,
+                                                                   config.tag);
+    if (config.async_capacity != 0) {
+        backend = std::make_shared<logging::AsyncBackend>(
+            std::move(backend), config.async_capacity);
     }
-    return {
-        std::make_shared<logging::ConsoleBackend>(config.level, config.tag)};
+    return {std::move(backend)};
 }
 
 static std::shared_ptr<IPersistence> MakePersistence(Config const& config) {
@@ -3,6 +3,7 @@
 #include <launchdarkly/config/shared/built/logging.hpp>
 #include <launchdarkly/logging/log_backend.hpp>
 
+#include <cstddef>
 #include <variant>
 
 namespace launchdarkly::config::shared::builders {
@@ -104,6 +105,26 @@ class LoggingBuilder {
      */
     LoggingBuilder& Logging(LoggingType logging);
 
+    /**
+     * Write log records from a background thread, rather than from the
+     * thread which logs them, so that logging never waits on the back-end's
+     * I/O. This applies to the console logger and to a custom back-end.
+     *
+     * Records wait for the background thread in a queue of fixed capacity.
+     * If the queue is full, a new record is dropped, and the number of
+     * records dropped is logged as a warning once there is room again.
+     *
+     * ```
+     * builder.Logging().Asynchronous(1024)
+     * ```
+     *
+     * @param capacity The number of records the queue holds, rounded up to a
+     * power of two. Zero, the default, writes records on the thread which
+     * logs them.
+     * @return A reference to this builder.
+     */
+    LoggingBuilder& Asynchronous(std::size_t capacity);
+
     /**
      * Build a logger configuration. Intended for use by the SDK implementation.
      *
@@ -113,6 +134,7 @@ class LoggingBuilder {
 
    private:
     LoggingType logging_;
+    std::size_t async_capacity_ = 0;
 };
 
 }  // namespace launchdarkly::config::shared::builders
@@ -2,6 +2,7 @@
 
 #include <launchdarkly/logging/log_backend.hpp>
 
+#include <cstddef>
 #include <optional>
 
 namespace launchdarkly::config::shared::built {
@@ -33,6 +34,13 @@ struct Logging {
      * in use, this will be the minimum log level.
      */
     LogLevel level;
+
+    /**
+     * When logging is enabled, the number of records which may be queued for
+     * a background thread to write. Zero to write records on the thread
+     * which logs them.
+     */
+    std::size_t async_capacity = 0;
 };
 
 }  // namespace launchdarkly::config::shared::built
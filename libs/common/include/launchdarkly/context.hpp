@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +28,10 @@ class ContextBuilder;
 
 /**
  * A LaunchDarkly context.
+ *
+ * A Context is immutable once built. Copies share the same underlying state,
+ * so copying a Context is a reference-count increment regardless of how many
+ * kinds and attributes it has.
  */
 class Context final {
     friend class ContextBuilder;
@@ -66,7 +73,7 @@ class Context final {
      *
      * @return Returns true if the context is valid.
      */
-    [[nodiscard]] bool Valid() const { return valid_; }
+    [[nodiscard]] bool Valid() const { return state_->valid; }
 
     /**
      * Get the canonical key for this context.
@@ -80,6 +87,19 @@ class Context final {
      */
     [[nodiscard]] std::map<std::string, std::string> const& KindsToKeys() const;
 
+    /**
+     * Get a hash of the context's contents: its kinds and all of their
+     * attributes, including private attribute references. Computed once when
+     * the context is built.
+     *
+     * Contexts with equal contents have equal hashes, so the hash may be used
+     * to key caches of per-context results. Different contexts may also
+     * collide, so a cache must not treat equal hashes as proof of equality.
+     *
+     * @return The hash, or 0 for an invalid context.
+     */
+    [[nodiscard]] std::size_t Hash() const { return state_->hash; }
+
     /**
      * Get a string containing errors the context encountered during
      * construction.
@@ -87,13 +107,13 @@ class Context final {
      * @return A string containing errors, or an empty string if there are no
      * errors.
      */
-    std::string const& errors() { return errors_; }
+    std::string const& errors() { return state_->errors; }
 
     friend std::ostream& operator<<(std::ostream& out, Context const& context) {
-        if (context.valid_) {
+        if (context.state_->valid) {
             out << "{contexts: [";
             bool first = true;
-            for (auto const& kind : context.attributes_) {
+            for (auto const& kind : context.state_->attributes) {
                 if (first) {
                     first = false;
                 } else {
@@ -103,7 +123,7 @@ class Context final {
             }
             out << "]";
         } else {
-            out << "{invalid: errors: [" << context.errors_ << "]";
+            out << "{invalid: errors: [" << context.state_->errors << "]";
         }
 
         return out;
@@ -111,9 +131,15 @@ class Context final {
 
     ~Context() = default;
     Context(Context const& context) = default;
-    Context(Context&& context) = default;
     Context& operator=(Context const&) = default;
-    Context& operator=(Context&&) = default;
+
+    // Moves share the state rather than taking it, so that a moved-from
+    // Context remains usable, as it was before copies were shared.
+    Context(Context&& context) noexcept : state_(context.state_) {}
+    Context& operator=(Context&& context) noexcept {
+        state_ = context.state_;
+        return *this;
+    }
 
    private:
     /**
@@ -127,14 +153,21 @@ class Context final {
      */
     Context(std::map<std::string, launchdarkly::Attributes> attributes);
 
-    std::map<std::string, launchdarkly::Attributes> attributes_;
-    std::vector<std::string> kinds_;
-    std::map<std::string, std::string> kinds_to_keys_;
-    bool valid_ = false;
-    std::string errors_;
-    std::string canonical_key_;
-
-    std::string make_canonical_key();
+    struct State {
+        std::map<std::string, launchdarkly::Attributes> attributes;
+        std::vector<std::string> kinds;
+        std::map<std::string, std::string> kinds_to_keys;
+        bool valid = false;
+        std::string errors;
+        std::string canonical_key;
+        std::size_t hash = 0;
+    };
+
+    static std::string MakeCanonicalKey(
+        std::map<std::string, std::string> const& kinds_to_keys);
+
+    // Never null, and never modified after construction.
+    std::shared_ptr<State const> state_;
 };
 
 }  // namespace launchdarkly
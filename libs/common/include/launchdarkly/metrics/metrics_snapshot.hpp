@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace launchdarkly::metrics {
+
+/**
+ * The distribution of the values recorded by a histogram, such as the
+ * durations of an operation in nanoseconds.
+ *
+ * Values are counted in buckets whose width grows with their magnitude, so
+ * that each value is known to within 12.5%, at any magnitude.
+ */
+struct HistogramSnapshot {
+    struct Bucket {
+        /** The largest value counted in the bucket. */
+        std::uint64_t upper_bound;
+        /** The number of values counted in the bucket. */
+        std::uint64_t count;
+    };
+
+    /** The number of values recorded. */
+    std::uint64_t count = 0;
+
+    /** The sum of the values recorded. */
+    std::uint64_t sum = 0;
+
+    /** The largest value recorded. */
+    std::uint64_t max = 0;
+
+    /** The buckets which counted at least one value, smallest first. */
+    std::vector<Bucket> buckets;
+
+    /**
+     * @return The mean of the values recorded, or 0 if none were.
+     */
+    [[nodiscard]] double Mean() const;
+
+    /**
+     * Returns an upper bound on the given percentile of the values recorded,
+     * which is never greater than the largest value recorded.
+     * @param percentile The percentile, between 0 and 100.
+     * @return The upper bound, or 0 if no values were recorded.
+     */
+    [[nodiscard]] std::uint64_t Percentile(double percentile) const;
+};
+
+/**
+ * The values of every metric in a metrics registry at one point in time,
+ * keyed by metric name.
+ *
+ * Each metric is read separately while others may be updating, so metrics
+ * which are updated together may be slightly inconsistent with each other.
+ */
+struct MetricsSnapshot {
+    /** Totals which only increase, such as the number of events dropped. */
+    std::map<std::string, std::uint64_t> counters;
+
+    /** Current levels, such as the number of events queued. */
+    std::map<std::string, std::int64_t> gauges;
+
+    /** Distributions, such as evaluation latencies. */
+    std::map<std::string, HistogramSnapshot> histograms;
+};
+
+}  // namespace launchdarkly::metrics
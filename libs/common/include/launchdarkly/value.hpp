@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -38,11 +39,20 @@ namespace launchdarkly {
  * reference /objectAttr1/color to match the value "green". Nested property
  * references like /objectAttr1/address/street are allowed if a property
  *     contains another JSON object.
+ *
+ * # Representation
+ *
+ * Because values are immutable, arrays, objects, and long strings share their
+ * storage between copies: copying such a Value only increments a reference
+ * count, so copies may be made freely, including across threads. Short strings
+ * are stored inline. Object members are stored in a vector sorted by key,
+ * rather than a tree.
  */
 class Value final {
    public:
     /**
-     * Array type for values. Provides const iteration and indexing.
+     * Array type for values. Provides const iteration and indexing. Copies
+     * share the same elements.
      */
     class Array {
        public:
@@ -78,7 +88,7 @@ class Value final {
         friend std::ostream& operator<<(std::ostream& out, Array const& arr) {
             out << "[";
             bool first = true;
-            for (auto const& item : arr.vec_) {
+            for (auto const& item : arr) {
                 if (first) {
                     first = false;
                 } else {
@@ -95,7 +105,7 @@ class Value final {
          * @param vec The vector to base the array on.
          */
         Array(std::vector<Value> vec);
-        Array(std::initializer_list<Value> values) : vec_(values) {}
+        Array(std::initializer_list<Value> values);
         Array() = default;
 
         Value const& operator[](std::size_t index) const;
@@ -107,13 +117,19 @@ class Value final {
         [[nodiscard]] Iterator end() const;
 
        private:
-        std::vector<Value> vec_;
+        [[nodiscard]] std::vector<Value> const& Elements() const;
+
+        // Null when empty.
+        std::shared_ptr<std::vector<Value> const> vec_;
     };
 
     /**
-     * Object type for values. Provides const iteration and indexing.
+     * Object type for values. Provides const iteration, in key order, and
+     * lookup by key. Copies share the same members.
      */
     class Object {
+        using Items = std::vector<std::pair<std::string const, Value>>;
+
        public:
         struct Iterator {
             using iterator_category = std::forward_iterator_tag;
@@ -123,7 +139,7 @@ class Value final {
             using pointer = value_type const*;
             using reference = value_type const&;
 
-            Iterator(std::map<std::string, Value>::const_iterator iterator);
+            Iterator(Items::const_iterator iterator);
 
             reference operator*() const;
             pointer operator->();
@@ -138,13 +154,13 @@ class Value final {
             };
 
            private:
-            std::map<std::string, Value>::const_iterator it_;
+            Items::const_iterator it_;
         };
 
         friend std::ostream& operator<<(std::ostream& out, Object const& obj) {
             out << "{";
             bool first = true;
-            for (auto const& pair : obj.map_) {
+            for (auto const& pair : obj) {
                 if (first) {
                     first = false;
                 } else {
@@ -160,7 +176,15 @@ class Value final {
          * Create an Object from a map of Values.
          * @param map The map to base the object on.
          */
-        Object(std::map<std::string, Value> map) : map_(std::move(map)) {}
+        Object(std::map<std::string, Value> map);
+
+        /**
+         * Create an Object from key/value pairs in any order. If a key appears
+         * more than once, the first value is kept.
+         * @param members The members of the object.
+         */
+        Object(std::vector<std::pair<std::string, Value>> members);
+
         Object() = default;
         Object(std::initializer_list<std::pair<std::string, Value>> values);
 
@@ -197,7 +221,10 @@ class Value final {
         [[nodiscard]] Iterator Find(std::string const& key) const;
 
        private:
-        std::map<std::string, Value> map_;
+        [[nodiscard]] Items const& Members() const;
+
+        // Sorted by key, with unique keys. Null when empty.
+        std::shared_ptr<Items const> map_;
     };
 
     /**
@@ -387,8 +414,7 @@ class Value final {
                 out << "number(" << std::get<double>(value.storage_) << ")";
                 break;
             case Type::kString:
-                out << "string(" << std::get<std::string>(value.storage_)
-                    << ")";
+                out << "string(" << value.AsString() << ")";
                 break;
             case Type::kObject:
                 out << "object(" << std::get<Object>(value.storage_) << ")";
@@ -411,7 +437,22 @@ class Value final {
    private:
     struct null_type {};
 
-    std::variant<null_type, bool, double, std::string, Array, Object> storage_;
+    // A string too long to be worth copying. Never null.
+    struct shared_string {
+        std::shared_ptr<std::string const> str;
+    };
+
+    using Storage = std::variant<null_type,
+                                 bool,
+                                 double,
+                                 std::string,
+                                 shared_string,
+                                 Array,
+                                 Object>;
+
+    static Storage StringStorage(std::string str);
+
+    Storage storage_;
 
     // Empty constants used when accessing the wrong type.
     // These are not inline static const because of this bug:
@@ -4,7 +4,7 @@
 namespace launchdarkly::config::shared::builders {
 
 built::Logging LoggingBuilder::Build() const {
-    return std::visit(
+    auto logging = std::visit(
         [](auto&& arg) {
             using T = std::decay_t<decltype(arg)>;
             if constexpr (std::is_same_v<T, LoggingBuilder::BasicLogging>) {
@@ -26,6 +26,8 @@ built::Logging LoggingBuilder::Build() const {
             }
         },
         logging_);
+    logging.async_capacity = async_capacity_;
+    return logging;
 }
 
 LoggingBuilder& LoggingBuilder::Logging(
@@ -36,6 +38,11 @@ LoggingBuilder& LoggingBuilder::Logging(
     return *this;
 }
 
+LoggingBuilder& LoggingBuilder::Asynchronous(std::size_t capacity) {
+    async_capacity_ = capacity;
+    return *this;
+}
+
 LoggingBuilder::LoggingBuilder(LoggingBuilder::CustomLogging custom) {
     Logging(custom);
 }
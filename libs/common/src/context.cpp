@@ -2,6 +2,8 @@
 
 #include <launchdarkly/context.hpp>
 
+#include <functional>
+
 namespace launchdarkly {
 
 static bool NeedsEscape(std::string_view to_check) {
@@ -22,48 +24,112 @@ static std::string EscapeKey(std::string_view const& to_escape) {
     return escaped;
 }
 
-std::vector<std::string> const& Context::Kinds() const {
-    return kinds_;
+static void HashCombine(std::size_t& seed, std::size_t const hash) {
+    seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
-Context::Context(std::string error_message)
-    : errors_(std::move(error_message)) {}
+template <typename T>
+static void HashCombine(std::size_t& seed, T const& value) {
+    HashCombine(seed, std::hash<T>{}(value));
+}
 
-Context::Context(std::map<std::string, launchdarkly::Attributes> attributes)
-    : attributes_(std::move(attributes)), valid_(true) {
-    for (auto& pair : attributes_) {
-        kinds_.push_back(pair.first);
-        kinds_to_keys_[pair.first] = pair.second.Key();
+static void HashValue(std::size_t& seed, Value const& value) {
+    HashCombine(seed, static_cast<int>(value.Type()));
+    switch (value.Type()) {
+        case Value::Type::kNull:
+            break;
+        case Value::Type::kBool:
+            HashCombine(seed, value.AsBool());
+            break;
+        case Value::Type::kNumber:
+            HashCombine(seed, value.AsDouble());
+            break;
+        case Value::Type::kString:
+            HashCombine(seed, value.AsString());
+            break;
+        case Value::Type::kArray:
+            HashCombine(seed, value.AsArray().Size());
+            for (auto const& item : value.AsArray()) {
+                HashValue(seed, item);
+            }
+            break;
+        case Value::Type::kObject:
+            // Objects iterate in key order, so equal objects hash equally.
+            HashCombine(seed, value.AsObject().Size());
+            for (auto const& [key, item] : value.AsObject()) {
+                HashCombine(seed, key);
+                HashValue(seed, item);
+            }
+            break;
+    }
+}
+
+static std::size_t HashAttributes(
+    std::map<std::string, launchdarkly::Attributes> const& attributes) {
+    std::size_t seed = attributes.size();
+    for (auto const& [kind, attrs] : attributes) {
+        HashCombine(seed, kind);
+        HashCombine(seed, attrs.Key());
+        HashCombine(seed, attrs.Name());
+        HashCombine(seed, attrs.Anonymous());
+        HashValue(seed, attrs.CustomAttributes());
+        HashCombine(seed, attrs.PrivateAttributes().size());
+        for (auto const& ref : attrs.PrivateAttributes()) {
+            HashCombine(seed, ref.RedactionName());
+        }
     }
+    return seed;
+}
+
+std::vector<std::string> const& Context::Kinds() const {
+    return state_->kinds;
+}
 
-    canonical_key_ = make_canonical_key();
+Context::Context(std::string error_message) {
+    auto state = std::make_shared<State>();
+    state->errors = std::move(error_message);
+    state_ = std::move(state);
+}
+
+Context::Context(std::map<std::string, launchdarkly::Attributes> attributes) {
+    auto state = std::make_shared<State>();
+    state->attributes = std::move(attributes);
+    state->valid = true;
+    for (auto& pair : state->attributes) {
+        state->kinds.push_back(pair.first);
+        state->kinds_to_keys[pair.first] = pair.second.Key();
+    }
+    state->canonical_key = MakeCanonicalKey(state->kinds_to_keys);
+    state->hash = HashAttributes(state->attributes);
+    state_ = std::move(state);
 }
 
 Value const& Context::Get(std::string const& kind,
                           AttributeReference const& ref) const {
-    auto found = attributes_.find(kind);
-    if (found != attributes_.end()) {
+    auto found = state_->attributes.find(kind);
+    if (found != state_->attributes.end()) {
         return found->second.Get(ref);
     }
     return Value::Null();
 }
 
 Attributes const& Context::Attributes(std::string const& kind) const {
-    return attributes_.at(kind);
+    return state_->attributes.at(kind);
 }
 
 std::string const& Context::CanonicalKey() const {
-    return canonical_key_;
+    return state_->canonical_key;
 }
 
 std::map<std::string, std::string> const& Context::KindsToKeys() const {
-    return kinds_to_keys_;
+    return state_->kinds_to_keys;
 }
 
-std::string Context::make_canonical_key() {
-    if (kinds_to_keys_.size() == 1) {
-        if (auto iterator = kinds_to_keys_.find("user");
-            iterator != kinds_to_keys_.end()) {
+std::string Context::MakeCanonicalKey(
+    std::map<std::string, std::string> const& kinds_to_keys) {
+    if (kinds_to_keys.size() == 1) {
+        if (auto iterator = kinds_to_keys.find("user");
+            iterator != kinds_to_keys.end()) {
             return iterator->second;
         }
     }
@@ -71,7 +137,7 @@ std::string Context::make_canonical_key() {
     bool first = true;
     // Maps are ordered, so keys and kinds will be in the correct order for
     // the canonical key.
-    for (auto& pair : kinds_to_keys_) {
+    for (auto const& pair : kinds_to_keys) {
         if (first) {
             first = false;
         } else {
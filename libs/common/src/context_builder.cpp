@@ -31,7 +31,7 @@ ContextBuilder::ContextBuilder(Context const& context) {
         return;
     }
 
-    for (const auto& kind : context.kinds_) {
+    for (const auto& kind : context.Kinds()) {
         const auto& attributes = context.Attributes(kind);
         builders_.emplace(kind, AttributesBuilder<ContextBuilder, Context>(
                                     *this, kind, attributes));
@@ -0,0 +1,35 @@
+#include <launchdarkly/metrics/metrics_snapshot.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace launchdarkly::metrics {
+
+double HistogramSnapshot::Mean() const {
+    if (count == 0) {
+        return 0;
+    }
+    return static_cast<double>(sum) / static_cast<double>(count);
+}
+
+std::uint64_t HistogramSnapshot::Percentile(double const percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    // The rank of the value at the percentile, counting from 1.
+    auto const rank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(
+               std::clamp(percentile, 0.0, 100.0) / 100.0 *
+               static_cast<double>(count))));
+
+    std::uint64_t seen = 0;
+    for (auto const& bucket : buckets) {
+        seen += bucket.count;
+        if (seen >= rank) {
+            return std::min(bucket.upper_bound, max);
+        }
+    }
+    return max;
+}
+
+}  // namespace launchdarkly::metrics
@@ -35,8 +35,9 @@ tl::expected<std::optional<Value>, JsonError> tag_invoke(
         case boost::json::kind::string:
             return Value(std::string(json_value.as_string()));
         case boost::json::kind::array: {
-            auto vec = json_value.as_array();
+            auto const& vec = json_value.as_array();
             std::vector<Value> values;
+            values.reserve(vec.size());
             for (auto const& item : vec) {
                 auto value =
                     boost::json::value_to<tl::expected<Value, JsonError>>(item);
@@ -45,11 +46,12 @@ tl::expected<std::optional<Value>, JsonError> tag_invoke(
                 }
                 values.emplace_back(std::move(*value));
             }
-            return Value(values);
+            return Value(std::move(values));
         }
         case boost::json::kind::object: {
             auto& map = json_value.as_object();
-            std::map<std::string, Value> values;
+            std::vector<std::pair<std::string, Value>> values;
+            values.reserve(map.size());
             for (auto const& pair : map) {
                 auto value =
                     boost::json::value_to<tl::expected<Value, JsonError>>(
@@ -57,9 +59,9 @@ tl::expected<std::optional<Value>, JsonError> tag_invoke(
                 if (!value) {
                     return tl::make_unexpected(value.error());
                 }
-                values.emplace(pair.key().data(), std::move(*value));
+                values.emplace_back(pair.key().data(), std::move(*value));
             }
-            return Value(std::move(values));
+            return Value(Value::Object(std::move(values)));
         }
     }
     // The above switch is exhaustive, so this can only happen if a new
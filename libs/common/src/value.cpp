@@ -1,7 +1,10 @@
 #include <launchdarkly/value.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <iterator>
+#include <stdexcept>
 
 namespace launchdarkly {
 
@@ -18,13 +21,26 @@ Value::Value(double num) : storage_{num} {}
 
 Value::Value(int num) : storage_{(double)num} {}
 
-Value::Value(std::string str) : storage_{std::move(str)} {}
+// Strings at least this long are shared between copies rather than copied.
+// Shorter ones are cheap to copy, and many fit the string's inline buffer.
+static constexpr std::size_t kSharedStringMinSize = 64;
 
-Value::Value(char const* str) : storage_{std::string(str)} {}
+Value::Storage Value::StringStorage(std::string str) {
+    if (str.size() >= kSharedStringMinSize) {
+        return shared_string{
+            std::make_shared<std::string const>(std::move(str))};
+    }
+    return str;
+}
+
+Value::Value(std::string str) : storage_{StringStorage(std::move(str))} {}
 
-Value::Value(std::vector<Value> arr) : storage_{std::move(arr)} {}
+Value::Value(char const* str) : storage_{StringStorage(str)} {}
 
-Value::Value(std::map<std::string, Value> obj) : storage_{std::move(obj)} {}
+Value::Value(std::vector<Value> arr) : storage_{Array(std::move(arr))} {}
+
+Value::Value(std::map<std::string, Value> obj)
+    : storage_{Object(std::move(obj))} {}
 
 template <class>
 inline constexpr bool always_false_v = false;
@@ -39,7 +55,8 @@ enum Value::Type Value::Type() const {
                 return Type::kBool;
             } else if constexpr (std::is_same_v<T, double>) {
                 return Type::kNumber;
-            } else if constexpr (std::is_same_v<T, std::string>) {
+            } else if constexpr (std::is_same_v<T, std::string> ||
+                                 std::is_same_v<T, shared_string>) {
                 return Type::kString;
             } else if constexpr (std::is_same_v<T, Value::Array>) {
                 return Type::kArray;
@@ -66,7 +83,8 @@ bool Value::IsNumber() const {
 }
 
 bool Value::IsString() const {
-    return std::holds_alternative<std::string>(storage_);
+    return std::holds_alternative<std::string>(storage_) ||
+           std::holds_alternative<shared_string>(storage_);
 }
 
 bool Value::IsArray() const {
@@ -105,8 +123,11 @@ double Value::AsDouble() const {
 }
 
 std::string const& Value::AsString() const {
-    if (IsString()) {
-        return std::get<std::string>(storage_);
+    if (auto const* str = std::get_if<std::string>(&storage_)) {
+        return *str;
+    }
+    if (auto const* shared = std::get_if<shared_string>(&storage_)) {
+        return *shared->str;
     }
     return empty_string_;
 }
@@ -127,13 +148,13 @@ Value::Object const& Value::AsObject() const {
 
 Value::Value(std::optional<std::string> opt_str) : storage_{0.0} {
     if (opt_str.has_value()) {
-        storage_ = opt_str.value();
+        storage_ = StringStorage(std::move(*opt_str));
     } else {
         storage_ = null_type{};
     }
 }
 Value::Value(std::initializer_list<Value> values)
-    : storage_(std::vector<Value>(values)) {}
+    : storage_(Array(values)) {}
 
 Value::Value(Value::Array arr) : storage_(std::move(arr)) {}
 
@@ -173,25 +194,36 @@ Value::Array::Iterator Value::Array::Iterator::operator--(int) {
 }
 
 Value const& Value::Array::operator[](std::size_t index) const {
-    return vec_[index];
+    return Elements()[index];
 }
 
 std::size_t Value::Array::Size() const {
-    return vec_.size();
+    return vec_ ? vec_->size() : 0;
 }
 
 Value::Array::Iterator Value::Array::begin() const {
-    return {vec_.begin()};
+    return {Elements().begin()};
 }
 
 Value::Array::Iterator Value::Array::end() const {
-    return {vec_.end()};
+    return {Elements().end()};
+}
+
+Value::Array::Array(std::vector<Value> vec) {
+    if (!vec.empty()) {
+        vec_ = std::make_shared<std::vector<Value> const>(std::move(vec));
+    }
 }
 
-Value::Array::Array(std::vector<Value> vec) : vec_(std::move(vec)) {}
+Value::Array::Array(std::initializer_list<Value> values)
+    : Array(std::vector<Value>(values)) {}
+
+std::vector<Value> const& Value::Array::Elements() const {
+    static std::vector<Value> const empty;
+    return vec_ ? *vec_ : empty;
+}
 
-Value::Object::Iterator::Iterator(
-    std::map<std::string, Value>::const_iterator iterator)
+Value::Object::Iterator::Iterator(Items::const_iterator iterator)
     : it_(iterator) {}
 
 Value::Object::Iterator::reference Value::Object::Iterator::operator*() const {
@@ -214,32 +246,81 @@ Value::Object::Iterator Value::Object::Iterator::operator++(int) {
 }
 
 std::size_t Value::Object::Size() const {
-    return map_.size();
+    return map_ ? map_->size() : 0;
 }
 
 Value::Object::Iterator Value::Object::begin() const {
-    return {map_.begin()};
+    return {Members().begin()};
 }
 
 Value::Object::Iterator Value::Object::end() const {
-    return {map_.end()};
+    return {Members().end()};
 }
 
 Value::Object::Iterator Value::Object::Find(std::string const& key) const {
-    return {map_.find(key)};
+    auto const& members = Members();
+    auto const it = std::lower_bound(
+        members.begin(), members.end(), key,
+        [](auto const& member, std::string const& k) {
+            return member.first < k;
+        });
+    if (it != members.end() && it->first == key) {
+        return {it};
+    }
+    return {members.end()};
 }
 
 std::size_t Value::Object::Count(std::string const& key) const {
-    return map_.count(key);
+    return Find(key) == end() ? 0 : 1;
 }
-Value::Object::Object(
-    std::initializer_list<std::pair<std::string, Value>> values) {
-    map_.insert(std::make_move_iterator(values.begin()),
-                std::make_move_iterator(values.end()));
+
+Value::Object::Object(std::map<std::string, Value> map) {
+    if (map.empty()) {
+        return;
+    }
+    // Already sorted and unique.
+    auto members = std::make_shared<Items>();
+    members->reserve(map.size());
+    for (auto& [key, value] : map) {
+        members->emplace_back(key, std::move(value));
+    }
+    map_ = std::move(members);
+}
+
+Value::Object::Object(std::vector<std::pair<std::string, Value>> members) {
+    if (members.empty()) {
+        return;
+    }
+    // A stable sort keeps duplicates in their original order, so unique()
+    // keeps the first value for each key.
+    std::stable_sort(
+        members.begin(), members.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+    auto const last = std::unique(
+        members.begin(), members.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first == rhs.first; });
+
+    auto sorted = std::make_shared<Items>();
+    sorted->reserve(std::distance(members.begin(), last));
+    std::move(members.begin(), last, std::back_inserter(*sorted));
+    map_ = std::move(sorted);
 }
 
+Value::Object::Object(
+    std::initializer_list<std::pair<std::string, Value>> values)
+    : Object(std::vector<std::pair<std::string, Value>>(values)) {}
+
 Value const& Value::Object::operator[](std::string const& key) const {
-    return map_.at(key);
+    auto const it = Find(key);
+    if (it == end()) {
+        throw std::out_of_range("Value::Object key not found: " + key);
+    }
+    return (*it).second;
+}
+
+Value::Object::Items const& Value::Object::Members() const {
+    static Items const empty;
+    return map_ ? *map_ : empty;
 }
 
 bool operator==(Value const& lhs, Value const& rhs) {
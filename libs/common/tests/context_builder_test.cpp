@@ -303,4 +303,49 @@ TEST(ContextBuilderTests, CanMarkTypedAttributesAsPrivate) {
     EXPECT_EQ(context.Attributes("user").PrivateAttributes().count("name"), 1);
 }
 
+TEST(ContextBuilderTests, CopiesShareState) {
+    auto context = ContextBuilder()
+                       .Kind("user", "potato")
+                       .Set("favorites", Array{"fries", "mash"})
+                       .Build();
+    auto copy = context;
+    EXPECT_EQ(&context.Attributes("user"), &copy.Attributes("user"));
+    EXPECT_EQ(&context.CanonicalKey(), &copy.CanonicalKey());
+
+    // A moved-from context is still usable.
+    auto moved = std::move(context);
+    EXPECT_TRUE(context.Valid());
+    EXPECT_EQ("potato", context.CanonicalKey());
+    EXPECT_EQ("potato", moved.CanonicalKey());
+}
+
+TEST(ContextBuilderTests, EqualContentsHaveEqualHashes) {
+    auto build = [](Value favorite) {
+        return ContextBuilder()
+            .Kind("user", "potato")
+            .Name("Bob")
+            .Set("favorite", std::move(favorite))
+            .SetPrivate("email", "bob@example.com")
+            .Kind("org", "spud")
+            .Build();
+    };
+
+    auto const context = build(Object{{"food", "fries"}, {"count", 3}});
+    EXPECT_EQ(context.Hash(),
+              build(Object{{"count", 3}, {"food", "fries"}}).Hash());
+    EXPECT_EQ(context.Hash(), ContextBuilder(context).Build().Hash());
+
+    EXPECT_NE(context.Hash(),
+              build(Object{{"food", "mash"}, {"count", 3}}).Hash());
+    EXPECT_NE(context.Hash(), build(Array{"fries", 3}).Hash());
+
+    ContextBuilder with_private(context);
+    with_private.Kind("org", "spud").AddPrivateAttribute("name");
+    EXPECT_NE(context.Hash(), with_private.Build().Hash());
+}
+
+TEST(ContextBuilderTests, InvalidContextHashIsZero) {
+    EXPECT_EQ(0, ContextBuilder().Build().Hash());
+}
+
 // NOLINTEND cppcoreguidelines-avoid-magic-numbers
@@ -54,3 +54,17 @@ TEST(LoggingBuilderTests, NoBackendSet) {
     ASSERT_EQ(LogLevel::kInfo, config.level);
     ASSERT_EQ(std::shared_ptr<launchdarkly::ILogBackend>(), config.backend);
 }
+
+TEST(LoggingBuilderTests, LoggingIsSynchronousByDefault) {
+    ASSERT_EQ(0, LoggingBuilder().Build().async_capacity);
+}
+
+TEST(LoggingBuilderTests, ConfigureAsynchronousLogging) {
+    auto config = LoggingBuilder()
+                      .Asynchronous(256)
+                      .Logging(LoggingBuilder::BasicLogging().Tag("Potato"))
+                      .Build();
+    ASSERT_FALSE(config.disable_logging);
+    ASSERT_EQ("Potato", config.tag);
+    ASSERT_EQ(256, config.async_capacity);
+}
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -345,4 +346,80 @@ TEST(ValueTests, ObjectInequality) {
     }
 }
 
+TEST(ValueTests, ObjectIteratesInKeyOrder) {
+    Value::Object const obj{{"c", 3}, {"a", 1}, {"b", 2}};
+
+    std::vector<std::string> keys;
+    for (auto const& pair : obj) {
+        keys.push_back(pair.first);
+    }
+    EXPECT_EQ((std::vector<std::string>{"a", "b", "c"}), keys);
+}
+
+TEST(ValueTests, ObjectKeepsFirstValueOfDuplicateKey) {
+    Value::Object const obj(std::vector<std::pair<std::string, Value>>{
+        {"b", 1}, {"a", 2}, {"b", 3}, {"a", 4}});
+
+    EXPECT_EQ(2, obj.Size());
+    EXPECT_EQ(1, obj["b"].AsInt());
+    EXPECT_EQ(2, obj["a"].AsInt());
+
+    Value::Object const init_list{{"a", 1}, {"a", 2}};
+    EXPECT_EQ(1, init_list.Size());
+    EXPECT_EQ(1, init_list["a"].AsInt());
+}
+
+TEST(ValueTests, ObjectLookupOfMissingKey) {
+    Value::Object const obj{{"a", 1}, {"c", 3}};
+
+    EXPECT_EQ(0, obj.Count("b"));
+    EXPECT_EQ(obj.end(), obj.Find("b"));
+    EXPECT_EQ(obj.end(), obj.Find("d"));
+    EXPECT_THROW((void)obj["b"], std::out_of_range);
+
+    Value::Object const empty;
+    EXPECT_EQ(0, empty.Count("a"));
+    EXPECT_EQ(empty.end(), empty.Find("a"));
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(ValueTests, CopiesShareArrayAndObjectElements) {
+    Value const arr{"a", Value::Object{{"key", "value"}}};
+    Value const arr_copy = arr;
+    EXPECT_EQ(&arr.AsArray()[0], &arr_copy.AsArray()[0]);
+
+    Value const obj(Value::Object{{"key", arr}});
+    Value const obj_copy = obj;
+    EXPECT_EQ(&obj.AsObject()["key"], &obj_copy.AsObject()["key"]);
+    EXPECT_EQ(arr, obj_copy.AsObject()["key"]);
+}
+
+TEST(ValueTests, CopiesShareLongStrings) {
+    std::string const long_string(1000, 'x');
+    Value const str(long_string);
+    Value const str_copy = str;
+
+    EXPECT_TRUE(str_copy.IsString());
+    EXPECT_EQ(Value::Type::kString, str_copy.Type());
+    EXPECT_EQ(long_string, str_copy.AsString());
+    EXPECT_EQ(&str.AsString(), &str_copy.AsString());
+    EXPECT_EQ(Value("short"), Value(std::optional<std::string>("short")));
+    EXPECT_EQ(str, Value(std::optional<std::string>(long_string)));
+    EXPECT_EQ("string(" + long_string + ")", ProduceString(str));
+}
+
+TEST(ValueTests, EmptyArrayAndObject) {
+    Value const arr(std::vector<Value>{});
+    EXPECT_TRUE(arr.IsArray());
+    EXPECT_EQ(0, arr.AsArray().Size());
+    EXPECT_EQ(arr.AsArray().begin(), arr.AsArray().end());
+
+    Value const obj(std::map<std::string, Value>{});
+    EXPECT_TRUE(obj.IsObject());
+    EXPECT_EQ(0, obj.AsObject().Size());
+
+    EXPECT_EQ(arr, Value(Value::Array()));
+    EXPECT_NE(arr, obj);
+}
+
 // NOLINTEND cppcoreguidelines-avoid-magic-numbers
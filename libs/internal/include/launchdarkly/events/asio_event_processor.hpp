@@ -4,6 +4,7 @@
 #include <launchdarkly/config/shared/built/service_endpoints.hpp>
 #include <launchdarkly/context_filter.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/network/http_requester.hpp>
 
 #include <launchdarkly/events/data/events.hpp>
@@ -29,12 +30,18 @@ namespace launchdarkly::events {
 template <typename SDK>
 class AsioEventProcessor : public IEventProcessor {
    public:
+    /**
+     * @param metrics If present, the processor records the depth of its
+     * inbox, the events it drops, and the size and delivery time of each
+     * payload in it. Must outlive the processor.
+     */
     AsioEventProcessor(
         boost::asio::any_io_executor const& io,
         config::shared::built::ServiceEndpoints const& endpoints,
         config::shared::built::Events const& events_config,
         config::shared::built::HttpProperties const& http_properties,
-        Logger& logger);
+        Logger& logger,
+        metrics::Registry* metrics = nullptr);
 
     virtual void FlushAsync() override;
 
@@ -80,6 +87,11 @@ class AsioEventProcessor : public IEventProcessor {
 
     Logger& logger_;
 
+    // Null unless the processor was given a metrics registry.
+    metrics::Gauge* inbox_depth_;
+    metrics::Counter* dropped_events_;
+    metrics::Histogram* payload_bytes_;
+
     void HandleSend(InputEvent event);
 
     std::optional<detail::EventBatch> CreateBatch();
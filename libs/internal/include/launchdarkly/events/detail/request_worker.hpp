@@ -7,6 +7,7 @@
 #include <variant>
 
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/network/requester.hpp>
 #include <launchdarkly/network/http_requester.hpp>
 
@@ -99,13 +100,16 @@ class RequestWorker {
      * @param id Unique identifier for the flush worker (used for logging).
      * @param mode TLS peer verification mode.
      * @param logger Logger.
+     * @param delivery_duration If present, records how long each batch took
+     * to deliver, including any retry, whether or not delivery succeeded.
      */
     RequestWorker(boost::asio::any_io_executor io,
                   std::chrono::milliseconds retry_after,
                   std::size_t id,
                   std::optional<std::locale> date_header_locale,
                   config::shared::built::TlsOptions tls_options,
-                  Logger& logger);
+                  Logger& logger,
+                  metrics::Histogram* delivery_duration = nullptr);
 
     /**
      * Returns true if the worker is available for delivery.
@@ -135,6 +139,7 @@ class RequestWorker {
 
         state_ = State::FirstChance;
         batch_ = std::move(batch);
+        delivery_started_ = std::chrono::steady_clock::now();
 
         LD_LOG(logger_, LogLevel::kDebug)
             << tag_ << "posting " << batch_->Count() << " events(s) to "
@@ -166,6 +171,11 @@ class RequestWorker {
      * request is in-flight or a retry is taking place. */
     std::optional<EventBatch> batch_;
 
+    /* When delivery of the current batch began. */
+    std::chrono::steady_clock::time_point delivery_started_;
+
+    metrics::Histogram* delivery_duration_;
+
     /* Tag used in logs. */
     std::string tag_;
 
@@ -177,6 +187,9 @@ class RequestWorker {
 
     void OnDeliveryAttempt(network::HttpResult const& request,
                            ResultCallback cb);
+
+    /* Ends delivery of the current batch. */
+    void ResetBatch();
 };
 
 }  // namespace launchdarkly::events::detail
@@ -33,12 +33,15 @@ class WorkerPool {
      * @param tls_options The TLS options to use for the connection to
      * LaunchDarkly event delivery endpoint.
      * @param logger Logger.
+     * @param delivery_duration If present, records how long each batch took
+     * to deliver.
      */
     WorkerPool(boost::asio::any_io_executor io,
                std::size_t pool_size,
                std::chrono::milliseconds delivery_retry_delay,
                config::shared::built::TlsOptions const& tls_options,
-               Logger& logger);
+               Logger& logger,
+               metrics::Histogram* delivery_duration = nullptr);
 
     /**
      * Attempts to find a free worker. If none are available, the completion
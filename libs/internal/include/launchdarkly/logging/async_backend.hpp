@@ -0,0 +1,104 @@
+#pragma once
+
+#include <launchdarkly/logging/log_backend.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace launchdarkly::logging {
+
+/**
+ * Back-end which moves writing off the logging thread. Each record is placed
+ * in a fixed-size ring and written to the wrapped back-end from a background
+ * thread, so a thread which logs never waits on the wrapped back-end's I/O.
+ *
+ * Records arrive already formatted, so enqueueing one is a lock-free move of
+ * its string into the ring. The background thread drains up to a batch of
+ * records at a time, freeing their slots before writing any of them, and is
+ * only woken when it has gone idle.
+ *
+ * When the ring is full a record is dropped according to the OverflowPolicy.
+ * Dropped records are counted, and the count is reported to the wrapped
+ * back-end as a warning once there is room again.
+ *
+ * Destroying the back-end writes any records still queued.
+ */
+class AsyncBackend : public ILogBackend {
+   public:
+    /**
+     * Which record to drop when a record is written while the ring is full.
+     */
+    enum class OverflowPolicy {
+        /** Drop the record being written. */
+        kDropNewest,
+        /** Drop the oldest queued record to make room. */
+        kDropOldest,
+    };
+
+    /**
+     * Constructs an AsyncBackend and starts its background thread.
+     * @param backend Back-end the background thread writes to.
+     * @param capacity Number of records the ring holds, rounded up to a power
+     * of two.
+     * @param policy Which record to drop when the ring is full.
+     */
+    explicit AsyncBackend(std::shared_ptr<ILogBackend> backend,
+                          std::size_t capacity = 1024,
+                          OverflowPolicy policy = OverflowPolicy::kDropNewest);
+
+    ~AsyncBackend() override;
+
+    bool Enabled(LogLevel level) noexcept override;
+
+    void Write(LogLevel level, std::string message) noexcept override;
+
+    /**
+     * @return The number of records dropped because the ring was full.
+     */
+    [[nodiscard]] std::size_t Dropped() const;
+
+   private:
+    struct Record {
+        LogLevel level = LogLevel::kDebug;
+        std::string message;
+    };
+
+    struct Cell {
+        // Equal to the position it will next be written at when free, or one
+        // past that position when it holds a record.
+        std::atomic<std::size_t> sequence;
+        Record record;
+    };
+
+    bool TryPush(Record& record);
+    bool TryPop(Record& record);
+    bool Empty() const;
+
+    void Run();
+
+    std::shared_ptr<ILogBackend> backend_;
+    OverflowPolicy const policy_;
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t const mask_;
+    std::atomic<std::size_t> enqueue_pos_{0};
+    std::atomic<std::size_t> dequeue_pos_{0};
+
+    std::atomic<std::size_t> dropped_{0};
+
+    // Set while the background thread is idle, so that writers only take the
+    // mutex when there is a thread to wake.
+    std::atomic<bool> waiting_{false};
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+
+    std::thread thread_;
+};
+
+}  // namespace launchdarkly::logging
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+namespace launchdarkly {
+
+/**
+ * Limits a single log statement to one message per interval. Intended for
+ * messages which can be triggered on every evaluation, such as an unknown flag
+ * key, where logging each occurrence would flood the application's logs.
+ *
+ * Use one limiter per log statement, with the LD_LOG_RATE_LIMITED macro:
+ * ```
+ * LD_LOG_RATE_LIMITED(logger_, LogLevel::kWarn, limiter_) << "message";
+ * ```
+ *
+ * The first message in each interval is written. The rest are counted, and the
+ * count is reported on the next message written.
+ *
+ * Thread-safe and lock-free. Under contention the suppressed count is
+ * approximate.
+ */
+class LogRateLimiter {
+   public:
+    /**
+     * @param interval Minimum time between messages.
+     * @param clock Source of the current time, injectable for testing.
+     * Defaults to the steady clock.
+     */
+    explicit LogRateLimiter(
+        std::chrono::steady_clock::duration interval = std::chrono::minutes(1),
+        std::function<std::chrono::steady_clock::time_point()> clock = [] {
+            return std::chrono::steady_clock::now();
+        });
+
+    /**
+     * @return True if a message may be written now. Otherwise counts the
+     * message as suppressed.
+     */
+    [[nodiscard]] bool TryAcquire();
+
+    /**
+     * @return The number of messages suppressed since the last call, which
+     * resets the count.
+     */
+    [[nodiscard]] std::size_t TakeSuppressed();
+
+   private:
+    std::chrono::steady_clock::duration const interval_;
+    std::function<std::chrono::steady_clock::time_point()> const clock_;
+
+    // Time since the clock's epoch before which messages are suppressed.
+    std::atomic<std::chrono::steady_clock::rep> next_allowed_;
+    std::atomic<std::size_t> suppressed_{0};
+};
+
+}  // namespace launchdarkly
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <launchdarkly/logging/log_backend.hpp>
+#include <launchdarkly/logging/log_rate_limiter.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -18,6 +20,10 @@ namespace launchdarkly {
  * // Use the macro for logging.
  * LD_LOG(logger, LogLevel::kInfo) << "this is a log";
  * ```
+ *
+ * When the level is disabled, the macro costs a single check of
+ * @ref Enabled: no record or stream is constructed, and the streamed
+ * expressions are not evaluated.
  */
 class Logger {
    public:
@@ -56,6 +62,16 @@ class Logger {
     class LogRecordStream {
        public:
         LogRecordStream(Logger const& logger, Logger::LogRecord rec);
+
+        /**
+         * @param suppressed The number of messages a @ref LogRateLimiter
+         * suppressed since this site last logged. If non-zero, it is appended
+         * to the message.
+         */
+        LogRecordStream(Logger const& logger,
+                        Logger::LogRecord rec,
+                        std::size_t suppressed);
+
         ~LogRecordStream();
 
         /**
@@ -67,7 +83,7 @@ class Logger {
          * @return Return this instance.
          */
         template <typename T>
-        LogRecordStream& operator<<(T any) {
+        LogRecordStream& operator<<(T const& any) {
             if (rec_.open_) {
                 ostream_ << any;
             }
@@ -78,6 +94,15 @@ class Logger {
         Logger const& logger_;
         Logger::LogRecord rec_;
         std::ostream ostream_;
+        std::size_t suppressed_ = 0;
+    };
+
+    /**
+     * Discards a LogRecordStream expression, so that the logging macros can
+     * be written as a single conditional expression.
+     */
+    struct Voidify {
+        void operator&(LogRecordStream const&) const {}
     };
 
     /**
@@ -121,7 +146,31 @@ class Logger {
     std::shared_ptr<ILogBackend> backend_;
 };
 
-#define LD_LOG(logger, level) \
-    launchdarkly::Logger::LogRecordStream(logger, logger.OpenRecord(level))
+// The stream is the operand of operator&, which binds more loosely than <<, so
+// everything streamed into the macro is evaluated only in the enabled branch.
+#define LD_LOG(logger, level)                                     \
+    !(logger).Enabled(level)                                      \
+        ? (void)0                                                 \
+        : launchdarkly::Logger::Voidify() &                       \
+              launchdarkly::Logger::LogRecordStream((logger),     \
+                                                    (logger).OpenRecord(level))
+
+/**
+ * Like LD_LOG, but writes at most once per interval of the given
+ * @ref launchdarkly::LogRateLimiter. The next message written reports how
+ * many were suppressed in between.
+ *
+ * ```
+ * LD_LOG_RATE_LIMITED(logger_, LogLevel::kWarn, unknown_flag_limiter_)
+ *     << "Unknown feature flag " << key;
+ * ```
+ */
+#define LD_LOG_RATE_LIMITED(logger, level, limiter)                      \
+    (!(logger).Enabled(level) || !(limiter).TryAcquire())                \
+        ? (void)0                                                        \
+        : launchdarkly::Logger::Voidify() &                              \
+              launchdarkly::Logger::LogRecordStream(                     \
+                  (logger), (logger).OpenRecord(level),                  \
+                  (limiter).TakeSuppressed())
 
 }  // namespace launchdarkly
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <launchdarkly/metrics/metrics_snapshot.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace launchdarkly::metrics {
+
+// Size of the cache line assumed when padding values written by different
+// threads.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * A total which only increases. Each thread adds to one of several
+ * cache-line-sized shards, so that threads counting at once rarely write to
+ * the same cache line; reading the total sums the shards.
+ */
+class Counter {
+   public:
+    void Add(std::uint64_t amount = 1) {
+        shards_[ShardIndex()].value.fetch_add(amount,
+                                              std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t Value() const;
+
+   private:
+    static constexpr std::size_t kShards = 16;
+
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<std::uint64_t> value{0};
+    };
+
+    // The shard used by the calling thread, assigned on its first call.
+    static std::size_t ShardIndex();
+
+    std::array<Shard, kShards> shards_;
+};
+
+/**
+ * A level which may go up or down.
+ */
+class Gauge {
+   public:
+    void Set(std::int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    void Add(std::int64_t amount) {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::int64_t Value() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<std::int64_t> value_{0};
+};
+
+/**
+ * A distribution of non-negative values, such as durations or sizes.
+ *
+ * Values are counted in buckets after the HDR histogram design: each power of
+ * two is split into kSubBuckets linear buckets, so a value is known to within
+ * 1/kSubBuckets of itself at any magnitude, with a fixed number of buckets.
+ * Recording a value is a few relaxed atomic additions and never allocates.
+ */
+class Histogram {
+   public:
+    void Record(std::uint64_t value);
+
+    void Record(std::chrono::nanoseconds const duration) {
+        Record(static_cast<std::uint64_t>(
+            duration.count() > 0 ? duration.count() : 0));
+    }
+
+    [[nodiscard]] HistogramSnapshot Snapshot() const;
+
+   private:
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr std::uint64_t kSubBuckets = 1 << kSubBucketBits;
+    // Values below kSubBuckets have a bucket each; every larger power of two
+    // up to 2^63 has kSubBuckets.
+    static constexpr std::size_t kBuckets =
+        kSubBuckets + (64 - kSubBucketBits) * kSubBuckets;
+
+    static std::size_t BucketIndex(std::uint64_t value);
+    static std::uint64_t BucketUpperBound(std::size_t index);
+
+    std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+    Counter sum_;
+    std::atomic<std::uint64_t> max_{0};
+};
+
+/**
+ * Owns an SDK instance's internal metrics, keyed by name.
+ *
+ * Components look up their metrics once, when they are constructed, and keep
+ * the returned references; a metric lives as long as the registry. Looking up
+ * a name takes a lock, but updating a metric never does.
+ */
+class Registry {
+   public:
+    Registry() = default;
+
+    Registry(Registry const&) = delete;
+    Registry(Registry&&) = delete;
+    Registry& operator=(Registry const&) = delete;
+    Registry& operator=(Registry&&) = delete;
+
+    /**
+     * @return The counter with the given name, created on first use.
+     */
+    Counter& GetCounter(std::string const& name);
+
+    /**
+     * @return The gauge with the given name, created on first use.
+     */
+    Gauge& GetGauge(std::string const& name);
+
+    /**
+     * @return The histogram with the given name, created on first use.
+     */
+    Histogram& GetHistogram(std::string const& name);
+
+    /**
+     * @return The current value of every metric in the registry.
+     */
+    [[nodiscard]] MetricsSnapshot Snapshot() const;
+
+   private:
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<Counter>> counters_;
+    std::map<std::string, std::unique_ptr<Gauge>> gauges_;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+};
+
+}  // namespace launchdarkly::metrics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "gzip.hpp"
 #include "http_requester.hpp"
 
 #include <launchdarkly/config/shared/built/http_properties.hpp>
@@ -208,6 +209,17 @@ class FoxyClient
         for (auto const& field : resp_.base()) {
             headers.insert_or_assign(field.name_string(), field.value());
         }
+        // Only requests which sent an Accept-Encoding header can receive
+        // a compressed body, so this is a no-op for other requests.
+        if (IsGzipEncoded(headers)) {
+            auto body = GzipDecompress(resp_.body());
+            if (!body) {
+                return HttpResult("response body could not be decompressed");
+            }
+            headers.erase("content-encoding");
+            return HttpResult(resp_.result_int(), std::move(body),
+                              std::move(headers));
+        }
         auto result =
             HttpResult(resp_.result_int(), std::make_optional(resp_.body()),
                        std::move(headers));
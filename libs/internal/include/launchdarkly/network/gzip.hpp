@@ -0,0 +1,33 @@
+#pragma once
+
+#include "http_requester.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace launchdarkly::network {
+
+/**
+ * Value of the Accept-Encoding header sent by requests which can accept a
+ * gzip compressed response.
+ */
+inline constexpr char const* kAcceptEncodingGzip = "gzip";
+
+/**
+ * Decompress a single-member gzip (RFC 1952) payload. The deflate stream is
+ * inflated in fixed size chunks, and the CRC-32 and size in the gzip trailer
+ * are verified.
+ *
+ * @param data The gzip encoded data.
+ * @return The decompressed data, or std::nullopt if the data is not valid
+ * gzip.
+ */
+std::optional<std::string> GzipDecompress(std::string_view data);
+
+/**
+ * @return True if the headers indicate the body is gzip encoded.
+ */
+bool IsGzipEncoded(HttpResult::HeadersType const& headers);
+
+}  // namespace launchdarkly::network
@@ -7,6 +7,22 @@
 #include <tl/expected.hpp>
 
 namespace launchdarkly {
+/**
+ * @return The name of a reason kind in JSON, such as "RULE_MATCH".
+ */
+char const* JsonName(enum EvaluationReason::Kind kind);
+
+/**
+ * @return The name of an error kind in JSON, such as "FLAG_NOT_FOUND".
+ */
+char const* JsonName(enum EvaluationReason::ErrorKind error_kind);
+
+/**
+ * @return The name of a Big Segments status in JSON, such as "HEALTHY", or an
+ * empty string for kNone, which is never serialized.
+ */
+char const* JsonName(enum EvaluationReason::BigSegmentsStatus status);
+
 /**
  * Method used by boost::json for converting a boost::json::value into a
  * launchdarkly::EvaluationReason.
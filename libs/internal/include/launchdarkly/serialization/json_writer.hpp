@@ -0,0 +1,139 @@
+#pragma once
+
+#include <launchdarkly/data/evaluation_reason.hpp>
+#include <launchdarkly/value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace launchdarkly {
+
+/**
+ * Destination of a JsonWriter's text: either a string, which grows to hold
+ * all of it, or a fixed buffer, which holds as much of it as fits. Text which
+ * doesn't fit the buffer is only counted, so that the caller can learn the
+ * size needed.
+ */
+class JsonOutput {
+   public:
+    /**
+     * @param out The string to append to. Must outlive the output.
+     */
+    explicit JsonOutput(std::string& out);
+
+    /**
+     * @param buffer The buffer to write to, from its start. May be null if
+     * size is zero. Must outlive the output.
+     * @param size Size of the buffer.
+     */
+    JsonOutput(char* buffer, std::size_t size);
+
+    void Append(char const c) {
+        if (string_) {
+            string_->push_back(c);
+        } else if (length_ < size_) {
+            buffer_[length_] = c;
+        }
+        ++length_;
+    }
+
+    void Append(std::string_view const text) {
+        if (string_) {
+            string_->append(text.data(), text.size());
+        } else if (length_ < size_) {
+            std::memcpy(buffer_ + length_, text.data(),
+                        std::min(text.size(), size_ - length_));
+        }
+        length_ += text.size();
+    }
+
+    /**
+     * @return The length of the text written so far, including any which
+     * didn't fit the buffer.
+     */
+    [[nodiscard]] std::size_t Length() const { return length_; }
+
+   private:
+    std::string* string_;
+    char* buffer_;
+    std::size_t size_;
+    std::size_t length_;
+};
+
+/**
+ * Writes JSON text directly to a JsonOutput, without building a boost::json
+ * DOM. This is for hot serialization paths whose output shape is fixed in
+ * code; everything else should use boost::json.
+ *
+ * The writer inserts separators and escapes strings, but does not validate
+ * structure: the caller must balance Begin/End calls and precede each value
+ * in an object with Key.
+ */
+class JsonWriter {
+   public:
+    /**
+     * @param out The string to append to. Must outlive the writer.
+     */
+    explicit JsonWriter(std::string& out);
+
+    /**
+     * @param out Where to write. A writer given a fixed buffer keeps writing
+     * once it is full, only counting the length of the JSON.
+     */
+    explicit JsonWriter(JsonOutput out);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /**
+     * Writes the key of the next member of the current object.
+     */
+    void Key(std::string_view key);
+
+    void Null();
+    void Bool(bool value);
+    void Uint(std::uint64_t value);
+    void Int(std::int64_t value);
+    /**
+     * Integral values are written without a fraction or exponent. Values
+     * that JSON cannot represent (NaN and infinities) are written as null.
+     */
+    void Number(double value);
+    void String(std::string_view value);
+
+    void Write(Value const& value);
+
+    /**
+     * Writes a reason with the same members as its boost::json
+     * serialization.
+     */
+    void Write(EvaluationReason const& reason);
+
+    /**
+     * Writes text as is, without a separator or escaping. The caller is
+     * responsible for it being valid JSON where it is written.
+     */
+    void Raw(std::string_view json);
+
+    /**
+     * @return The length of the text written so far, including any which
+     * didn't fit a fixed buffer.
+     */
+    [[nodiscard]] std::size_t Length() const { return out_.Length(); }
+
+   private:
+    void BeforeValue();
+    void AppendEscaped(std::string_view value);
+
+    JsonOutput out_;
+    // Whether the next key or value follows another one in its container.
+    bool needs_comma_;
+};
+
+}  // namespace launchdarkly
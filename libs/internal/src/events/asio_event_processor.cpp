@@ -20,6 +20,11 @@ auto const kEventSchemaHeader = "X-LaunchDarkly-Event-Schema";
 auto const kPayloadIdHeader = "X-LaunchDarkly-Payload-Id";
 auto const kEventSchemaVersion = 4;
 
+auto const kInboxDepthMetric = "events.inbox_depth";
+auto const kDroppedEventsMetric = "events.dropped";
+auto const kPayloadBytesMetric = "events.payload_bytes";
+auto const kDeliveryDurationMetric = "events.delivery_duration_ns";
+
 // These helpers are for usage with std::visit.
 template <class... Ts>
 struct overloaded : Ts... {
@@ -35,7 +40,8 @@ AsioEventProcessor<SDK>::AsioEventProcessor(
     config::shared::built::ServiceEndpoints const& endpoints,
     config::shared::built::Events const& events_config,
     config::shared::built::HttpProperties const& http_properties,
-    Logger& logger)
+    Logger& logger,
+    metrics::Registry* metrics)
     : io_(boost::asio::make_strand(io)),
       outbox_(events_config.Capacity()),
       summarizer_(std::chrono::system_clock::now()),
@@ -48,7 +54,9 @@ AsioEventProcessor<SDK>::AsioEventProcessor(
                events_config.FlushWorkers(),
                events_config.DeliveryRetryDelay(),
                http_properties.Tls(),
-               logger),
+               logger,
+               metrics ? &metrics->GetHistogram(kDeliveryDurationMetric)
+                       : nullptr),
       inbox_capacity_(events_config.Capacity()),
       inbox_size_(0),
       full_outbox_encountered_(false),
@@ -58,7 +66,12 @@ AsioEventProcessor<SDK>::AsioEventProcessor(
       filter_(events_config.AllAttributesPrivate(),
               events_config.PrivateAttributes()),
       context_key_cache_(events_config.ContextKeysCacheCapacity().value_or(0)),
-      logger_(logger) {
+      logger_(logger),
+      inbox_depth_(metrics ? &metrics->GetGauge(kInboxDepthMetric) : nullptr),
+      dropped_events_(metrics ? &metrics->GetCounter(kDroppedEventsMetric)
+                              : nullptr),
+      payload_bytes_(metrics ? &metrics->GetHistogram(kPayloadBytesMetric)
+                             : nullptr) {
     ScheduleFlush();
 }
 
@@ -70,8 +83,14 @@ bool AsioEventProcessor<SDK>::InboxIncrement() {
     }
     if (inbox_size_ < inbox_capacity_) {
         inbox_size_++;
+        if (inbox_depth_) {
+            inbox_depth_->Set(static_cast<std::int64_t>(inbox_size_));
+        }
         return true;
     }
+    if (dropped_events_) {
+        dropped_events_->Add();
+    }
     if (!full_inbox_encountered_) {
         LD_LOG(logger_, LogLevel::kWarn)
             << "event-processor: events are being produced faster than they "
@@ -88,6 +107,9 @@ void AsioEventProcessor<SDK>::InboxDecrement() {
     if (inbox_size_ > 0) {
         inbox_size_--;
     }
+    if (inbox_depth_) {
+        inbox_depth_->Set(static_cast<std::int64_t>(inbox_size_));
+    }
 }
 
 template <typename SDK>
@@ -129,6 +151,11 @@ void AsioEventProcessor<SDK>::Flush(FlushTrigger flush_type) {
                 << "event-processor: nothing to flush";
             return;
         }
+        if (payload_bytes_) {
+            if (auto const& body = batch->Request().Body()) {
+                payload_bytes_->Record(body->size());
+            }
+        }
         worker->AsyncDeliver(
             std::move(*batch),
             [this](std::size_t count,
@@ -11,12 +11,14 @@ RequestWorker::RequestWorker(boost::asio::any_io_executor io,
                              std::size_t id,
                              std::optional<std::locale> date_header_locale,
                              config::shared::built::TlsOptions tls_options,
-                             Logger& logger)
+                             Logger& logger,
+                             metrics::Histogram* delivery_duration)
     : timer_(std::move(io)),
       retry_delay_(retry_after),
       state_(State::Idle),
       requester_(timer_.get_executor(), tls_options),
       batch_(std::nullopt),
+      delivery_duration_(delivery_duration),
       tag_("flush-worker[" + std::to_string(id) + "]: "),
       date_header_locale_(std::move(date_header_locale)),
       logger_(logger) {}
@@ -76,7 +78,7 @@ void RequestWorker::OnDeliveryAttempt(network::HttpResult const& result,
                        "HTTP error "
                     << result.Status();
             }
-            batch_.reset();
+            ResetBatch();
             break;
         case Action::NotifyPermanentFailure:
             LD_LOG(logger_, LogLevel::kWarn)
@@ -84,11 +86,11 @@ void RequestWorker::OnDeliveryAttempt(network::HttpResult const& result,
                 << " event(s) (giving up permanently): HTTP error "
                 << result.Status();
             callback(batch_->Count(), result.Status());
-            batch_.reset();
+            ResetBatch();
             break;
         case Action::ParseDateAndReset: {
             if (!date_header_locale_) {
-                batch_.reset();
+                ResetBatch();
                 break;
             }
             auto headers = result.Headers();
@@ -99,7 +101,7 @@ void RequestWorker::OnDeliveryAttempt(network::HttpResult const& result,
                     callback(batch_->Count(), *server_time);
                 }
             }
-            batch_.reset();
+            ResetBatch();
         } break;
         case Action::Retry:
             if (result.IsError()) {
@@ -130,6 +132,14 @@ void RequestWorker::OnDeliveryAttempt(network::HttpResult const& result,
     state_ = next_state;
 }
 
+void RequestWorker::ResetBatch() {
+    if (delivery_duration_) {
+        delivery_duration_->Record(std::chrono::steady_clock::now() -
+                                   delivery_started_);
+    }
+    batch_.reset();
+}
+
 std::pair<State, Action> NextState(State state,
                                    network::HttpResult const& result) {
     std::optional<Action> action;
@@ -25,7 +25,8 @@ WorkerPool::WorkerPool(boost::asio::any_io_executor io,
                        std::size_t pool_size,
                        std::chrono::milliseconds delivery_retry_delay,
                        TlsOptions const& tls_options,
-                       Logger& logger)
+                       Logger& logger,
+                       metrics::Histogram* delivery_duration)
     : io_(io), workers_() {
     // The en_US.utf-8 locale is used whenever a date is parsed from the HTTP
     // headers returned by the event-delivery endpoints. If the locale is
@@ -39,7 +40,7 @@ WorkerPool::WorkerPool(boost::asio::any_io_executor io,
     for (std::size_t i = 0; i < pool_size; i++) {
         workers_.emplace_back(std::make_unique<RequestWorker>(
             io_, delivery_retry_delay, i, date_header_locale, tls_options,
-            logger));
+            logger, delivery_duration));
     }
 }
 
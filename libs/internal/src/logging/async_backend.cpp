@@ -0,0 +1,180 @@
+#include <launchdarkly/logging/async_backend.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace launchdarkly::logging {
+
+// Records written per wake of the background thread at most.
+static constexpr std::size_t kMaxBatchSize = 64;
+
+// Attempts a writer makes at dropping the oldest record before giving up and
+// dropping its own, in case other writers keep refilling the ring.
+static constexpr int kMaxDropOldestAttempts = 4;
+
+static std::size_t RoundUpToPowerOfTwo(std::size_t const value) {
+    std::size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+AsyncBackend::AsyncBackend(std::shared_ptr<ILogBackend> backend,
+                           std::size_t const capacity,
+                           OverflowPolicy const policy)
+    : backend_(std::move(backend)),
+      policy_(policy),
+      cells_(std::make_unique<Cell[]>(RoundUpToPowerOfTwo(capacity))),
+      mask_(RoundUpToPowerOfTwo(capacity) - 1) {
+    for (std::size_t i = 0; i <= mask_; i++) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread([this] { Run(); });
+}
+
+AsyncBackend::~AsyncBackend() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+bool AsyncBackend::Enabled(LogLevel const level) noexcept {
+    return backend_->Enabled(level);
+}
+
+void AsyncBackend::Write(LogLevel const level, std::string message) noexcept {
+    Record record{level, std::move(message)};
+    if (!TryPush(record)) {
+        bool pushed = false;
+        if (policy_ == OverflowPolicy::kDropOldest) {
+            Record oldest;
+            for (int i = 0; i < kMaxDropOldestAttempts && !pushed; i++) {
+                if (TryPop(oldest)) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+                pushed = TryPush(record);
+            }
+        }
+        if (!pushed) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // Pairs with the fence in Run: either this sees the background thread
+    // waiting, or the background thread sees this record.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_relaxed)) {
+        std::lock_guard lock(mutex_);
+        wake_.notify_one();
+    }
+}
+
+std::size_t AsyncBackend::Dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+// The ring is a bounded multi-producer, multi-consumer queue after Dmitry
+// Vyukov's design. A writer claims a position by advancing enqueue_pos_, then
+// publishes the record by advancing the cell's sequence; a reader does the
+// same with dequeue_pos_. Writers are also readers under kDropOldest.
+bool AsyncBackend::TryPush(Record& record) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells_[pos & mask_];
+        auto const sequence = cell->sequence.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::intptr_t>(sequence) -
+                          static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->record = std::move(record);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncBackend::TryPop(Record& record) {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells_[pos & mask_];
+        auto const sequence = cell->sequence.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::intptr_t>(sequence) -
+                          static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+    record = std::move(cell->record);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncBackend::Empty() const {
+    auto const pos = dequeue_pos_.load(std::memory_order_relaxed);
+    return cells_[pos & mask_].sequence.load(std::memory_order_acquire) !=
+           pos + 1;
+}
+
+void AsyncBackend::Run() {
+    std::vector<Record> batch(kMaxBatchSize);
+    std::size_t reported_dropped = 0;
+
+    while (true) {
+        std::size_t count = 0;
+        while (count < kMaxBatchSize && TryPop(batch[count])) {
+            count++;
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            backend_->Write(batch[i].level, std::move(batch[i].message));
+        }
+
+        if (auto const dropped = Dropped(); dropped != reported_dropped) {
+            if (backend_->Enabled(LogLevel::kWarn)) {
+                backend_->Write(LogLevel::kWarn,
+                                std::to_string(dropped - reported_dropped) +
+                                    " log messages dropped because the log "
+                                    "queue was full");
+            }
+            reported_dropped = dropped;
+        }
+
+        if (count > 0) {
+            continue;
+        }
+
+        std::unique_lock lock(mutex_);
+        waiting_.store(true, std::memory_order_relaxed);
+        // Pairs with the fence in Write.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wake_.wait(lock, [this] { return stopping_ || !Empty(); });
+        waiting_.store(false, std::memory_order_relaxed);
+        if (stopping_ && Empty()) {
+            return;
+        }
+    }
+}
+
+}  // namespace launchdarkly::logging
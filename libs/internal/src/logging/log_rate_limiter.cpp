@@ -0,0 +1,33 @@
+#include <launchdarkly/logging/log_rate_limiter.hpp>
+
+#include <utility>
+
+namespace launchdarkly {
+
+LogRateLimiter::LogRateLimiter(
+    std::chrono::steady_clock::duration const interval,
+    std::function<std::chrono::steady_clock::time_point()> clock)
+    : interval_(interval),
+      clock_(std::move(clock)),
+      next_allowed_(std::chrono::steady_clock::duration::min().count()) {}
+
+bool LogRateLimiter::TryAcquire() {
+    auto const now = clock_().time_since_epoch().count();
+    auto next_allowed = next_allowed_.load(std::memory_order_relaxed);
+    // Only the thread which advances the deadline may log; any others racing
+    // it for the same interval are suppressed.
+    if (now >= next_allowed &&
+        next_allowed_.compare_exchange_strong(next_allowed,
+                                              now + interval_.count(),
+                                              std::memory_order_relaxed)) {
+        return true;
+    }
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+std::size_t LogRateLimiter::TakeSuppressed() {
+    return suppressed_.exchange(0, std::memory_order_relaxed);
+}
+
+}  // namespace launchdarkly
@@ -14,8 +14,19 @@ Logger::LogRecordStream::LogRecordStream(Logger const& logger,
                                          Logger::LogRecord rec)
     : rec_(std::move(rec)), ostream_(std::ostream(&rec_)), logger_(logger) {}
 
+Logger::LogRecordStream::LogRecordStream(Logger const& logger,
+                                         Logger::LogRecord rec,
+                                         std::size_t const suppressed)
+    : LogRecordStream(logger, std::move(rec)) {
+    suppressed_ = suppressed;
+}
+
 Logger::LogRecordStream::~LogRecordStream() {
     if (rec_.open_) {
+        if (suppressed_ > 0) {
+            ostream_ << " (" << suppressed_
+                     << " similar messages suppressed since last logged)";
+        }
         ostream_.flush();
         logger_.PushRecord(std::move(rec_));
     }
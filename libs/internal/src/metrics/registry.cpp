@@ -0,0 +1,129 @@
+#include <launchdarkly/metrics/registry.hpp>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace launchdarkly::metrics {
+
+// Returns the position of the highest set bit of a non-zero value.
+static unsigned HighestBit(std::uint64_t const value) {
+#if defined(__GNUC__)  // GCC, Clang, ICC
+    return 63 - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    for (auto remaining = value >> 1; remaining != 0; remaining >>= 1) {
+        index++;
+    }
+    return index;
+#endif
+}
+
+std::size_t Counter::ShardIndex() {
+    static std::atomic<std::size_t> next_shard{0};
+    thread_local std::size_t const shard =
+        next_shard.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return shard;
+}
+
+std::uint64_t Counter::Value() const {
+    std::uint64_t total = 0;
+    for (auto const& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::size_t Histogram::BucketIndex(std::uint64_t const value) {
+    if (value < kSubBuckets) {
+        return static_cast<std::size_t>(value);
+    }
+    // The top kSubBucketBits + 1 bits of the value select its bucket within
+    // its power of two.
+    auto const shift = HighestBit(value) - kSubBucketBits;
+    auto const sub_bucket = (value >> shift) - kSubBuckets;
+    return static_cast<std::size_t>(kSubBuckets + shift * kSubBuckets +
+                                    sub_bucket);
+}
+
+std::uint64_t Histogram::BucketUpperBound(std::size_t const index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    auto const shift = (index - kSubBuckets) / kSubBuckets;
+    auto const sub_bucket = (index - kSubBuckets) % kSubBuckets;
+    auto const lower = (kSubBuckets + sub_bucket) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+void Histogram::Record(std::uint64_t const value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.Add(value);
+
+    // Only write when the maximum grows, which soon becomes rare.
+    auto max = max_.load(std::memory_order_relaxed);
+    while (value > max &&
+           !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot Histogram::Snapshot() const {
+    HistogramSnapshot snapshot;
+    for (std::size_t i = 0; i < kBuckets; i++) {
+        auto const count = buckets_[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            snapshot.buckets.push_back({BucketUpperBound(i), count});
+            snapshot.count += count;
+        }
+    }
+    snapshot.sum = sum_.Value();
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+template <typename Metric>
+static Metric& GetOrCreate(
+    std::map<std::string, std::unique_ptr<Metric>>& metrics,
+    std::string const& name) {
+    auto& metric = metrics[name];
+    if (!metric) {
+        metric = std::make_unique<Metric>();
+    }
+    return *metric;
+}
+
+Counter& Registry::GetCounter(std::string const& name) {
+    std::lock_guard lock(mutex_);
+    return GetOrCreate(counters_, name);
+}
+
+Gauge& Registry::GetGauge(std::string const& name) {
+    std::lock_guard lock(mutex_);
+    return GetOrCreate(gauges_, name);
+}
+
+Histogram& Registry::GetHistogram(std::string const& name) {
+    std::lock_guard lock(mutex_);
+    return GetOrCreate(histograms_, name);
+}
+
+MetricsSnapshot Registry::Snapshot() const {
+    MetricsSnapshot snapshot;
+    std::lock_guard lock(mutex_);
+    for (auto const& [name, counter] : counters_) {
+        snapshot.counters.emplace(name, counter->Value());
+    }
+    for (auto const& [name, gauge] : gauges_) {
+        snapshot.gauges.emplace(name, gauge->Value());
+    }
+    for (auto const& [name, histogram] : histograms_) {
+        snapshot.histograms.emplace(name, histogram->Snapshot());
+    }
+    return snapshot;
+}
+
+}  // namespace launchdarkly::metrics
@@ -1,6 +1,7 @@
 #ifdef LD_CURL_NETWORKING
 
 #include "launchdarkly/network/curl_requester.hpp"
+#include <boost/algorithm/string/predicate.hpp>
 #include <curl/curl.h>
 #include <memory>
 
@@ -17,6 +18,7 @@ static constexpr auto const* kLf = "\n";
 static constexpr auto const* kWhitespace = " \t";
 static constexpr auto const* kWhitespaceWithNewlines = " \t\r\n";
 static constexpr auto const* kHeaderSeparator = ": ";
+static constexpr auto const* kAcceptEncodingHeader = "Accept-Encoding";
 
 // Error messages
 static constexpr auto const* kErrorMalformedRequest = "The request was malformed and could not be made.";
@@ -69,7 +71,7 @@ static size_t HeaderCallback(const char* buffer, const size_t size, const size_t
 CurlRequester::CurlRequester(net::any_io_executor ctx, TlsOptions const& tls_options)
     : ctx_(std::move(ctx)),
       tls_options_(tls_options),
-      multi_manager_(CurlMultiManager::create(ctx_)) {
+      multi_manager_(CurlMultiManager::shared(ctx_)) {
     curl_global_init(CURL_GLOBAL_DEFAULT);
 }
 
@@ -78,6 +80,13 @@ void CurlRequester::Request(HttpRequest request, std::function<void(const HttpRe
     auto multi_manager = multi_manager_;
     auto tls_options = tls_options_;
 
+    // The multi manager completes transfers on its own strand; hand the
+    // result back to the requester's executor so that callers keep their
+    // serialization guarantees when the io_context has several threads.
+    cb = [ctx = ctx_, cb = std::move(cb)](HttpResult const& result) {
+        boost::asio::post(ctx, [cb, result]() { cb(result); });
+    };
+
     boost::asio::post(ctx_, [multi_manager, tls_options, request = std::move(request), cb = std::move(cb)]() mutable {
         PerformRequestWithMulti(multi_manager, tls_options, std::move(request), std::move(cb));
     });
@@ -104,6 +113,7 @@ void CurlRequester::PerformRequestWithMulti(std::shared_ptr<CurlMultiManager> mu
     struct RequestContext {
         std::string url;
         std::string body; // Keep body alive
+        std::string accept_encoding;
         std::string response_body;
         HttpResult::HeadersType response_headers;
         std::function<void(const HttpResult&)> callback;
@@ -162,6 +172,14 @@ void CurlRequester::PerformRequestWithMulti(std::shared_ptr<CurlMultiManager> mu
     // Set headers
     auto const& base_headers = request.Properties().BaseHeaders();
     for (auto const& [key, value] : base_headers) {
+        if (boost::iequals(key, kAcceptEncodingHeader)) {
+            // Letting CURL send the header means it will also decode the
+            // response body as it is received.
+            ctx->accept_encoding = value;
+            CURL_SETOPT_CHECK(curl.get(), CURLOPT_ACCEPT_ENCODING,
+                              ctx->accept_encoding.c_str());
+            continue;
+        }
         std::string header = key + kHeaderSeparator + value;
         const auto appendResult = curl_slist_append(headers, header.c_str());
         if (!appendResult) {
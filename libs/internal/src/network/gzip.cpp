@@ -0,0 +1,141 @@
+#include <launchdarkly/network/gzip.hpp>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/beast/zlib/inflate_stream.hpp>
+#include <boost/crc.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace launchdarkly::network {
+
+namespace zlib = boost::beast::zlib;
+
+// Gzip member header layout, see RFC 1952 section 2.3.
+static constexpr unsigned char kGzipId1 = 0x1f;
+static constexpr unsigned char kGzipId2 = 0x8b;
+static constexpr unsigned char kGzipMethodDeflate = 8;
+static constexpr std::size_t kGzipHeaderSize = 10;
+static constexpr std::size_t kGzipTrailerSize = 8;
+
+static constexpr unsigned char kFlagHeaderCrc = 0x02;
+static constexpr unsigned char kFlagExtra = 0x04;
+static constexpr unsigned char kFlagName = 0x08;
+static constexpr unsigned char kFlagComment = 0x10;
+
+// The window size used by gzip is always the maximum deflate window.
+static constexpr int kWindowBits = 15;
+
+static constexpr std::size_t kChunkSize = 16 * 1024;
+
+static unsigned char Byte(std::string_view data, std::size_t index) {
+    return static_cast<unsigned char>(data[index]);
+}
+
+static std::uint32_t ReadLittleEndian32(std::string_view data,
+                                        std::size_t offset) {
+    return static_cast<std::uint32_t>(Byte(data, offset)) |
+           static_cast<std::uint32_t>(Byte(data, offset + 1)) << 8 |
+           static_cast<std::uint32_t>(Byte(data, offset + 2)) << 16 |
+           static_cast<std::uint32_t>(Byte(data, offset + 3)) << 24;
+}
+
+// Returns the offset of the deflate data following the gzip header, or
+// std::nullopt if the header is malformed.
+static std::optional<std::size_t> SkipGzipHeader(std::string_view data) {
+    if (data.size() < kGzipHeaderSize || Byte(data, 0) != kGzipId1 ||
+        Byte(data, 1) != kGzipId2 || Byte(data, 2) != kGzipMethodDeflate) {
+        return std::nullopt;
+    }
+    unsigned char const flags = Byte(data, 3);
+    std::size_t offset = kGzipHeaderSize;
+
+    if (flags & kFlagExtra) {
+        if (data.size() < offset + 2) {
+            return std::nullopt;
+        }
+        offset += 2 + (Byte(data, offset) | Byte(data, offset + 1) << 8);
+    }
+    for (auto const flag : {kFlagName, kFlagComment}) {
+        if (flags & flag) {
+            auto const terminator = data.find('\0', offset);
+            if (terminator == std::string_view::npos) {
+                return std::nullopt;
+            }
+            offset = terminator + 1;
+        }
+    }
+    if (flags & kFlagHeaderCrc) {
+        offset += 2;
+    }
+    if (offset > data.size()) {
+        return std::nullopt;
+    }
+    return offset;
+}
+
+std::optional<std::string> GzipDecompress(std::string_view data) {
+    auto const offset = SkipGzipHeader(data);
+    if (!offset) {
+        return std::nullopt;
+    }
+
+    zlib::inflate_stream inflater;
+    inflater.reset(kWindowBits);
+
+    zlib::z_params params;
+    params.next_in = data.data() + *offset;
+    params.avail_in = data.size() - *offset;
+
+    std::string output;
+    std::array<char, kChunkSize> chunk{};
+    boost::crc_32_type crc;
+
+    while (true) {
+        params.next_out = chunk.data();
+        params.avail_out = chunk.size();
+
+        boost::system::error_code ec;
+        inflater.write(params, zlib::Flush::sync, ec);
+
+        auto const produced = chunk.size() - params.avail_out;
+        output.append(chunk.data(), produced);
+        crc.process_bytes(chunk.data(), produced);
+
+        if (ec == zlib::error::end_of_stream) {
+            break;
+        }
+        if (ec == zlib::error::need_buffers && produced != 0) {
+            // The chunk was filled; keep draining.
+            continue;
+        }
+        if (ec) {
+            // Either corrupt data, or the input ended before the deflate
+            // stream was complete.
+            return std::nullopt;
+        }
+    }
+
+    if (params.avail_in < kGzipTrailerSize) {
+        return std::nullopt;
+    }
+    auto const trailer = data.size() - params.avail_in;
+    auto const expected_crc = ReadLittleEndian32(data, trailer);
+    auto const expected_size = ReadLittleEndian32(data, trailer + 4);
+
+    // ISIZE is the uncompressed size modulo 2^32.
+    if (expected_crc != crc.checksum() ||
+        expected_size != static_cast<std::uint32_t>(output.size())) {
+        return std::nullopt;
+    }
+
+    return output;
+}
+
+bool IsGzipEncoded(HttpResult::HeadersType const& headers) {
+    auto const encoding = headers.find("content-encoding");
+    return encoding != headers.end() &&
+           boost::iequals(encoding->second, kAcceptEncodingGzip);
+}
+
+}  // namespace launchdarkly::network
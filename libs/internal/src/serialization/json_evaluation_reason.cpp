@@ -5,65 +5,95 @@
 #include <boost/core/ignore_unused.hpp>
 #include <boost/json.hpp>
 
-#include <sstream>
+#include <cstddef>
+#include <utility>
 
 namespace launchdarkly {
 
-tl::expected<enum EvaluationReason::Kind, JsonError> tag_invoke(
-    boost::json::value_to_tag<
-        tl::expected<enum EvaluationReason::Kind, JsonError>> const& unused,
+namespace {
+// The JSON name of each value of the reason enums. Parsing and serialization
+// both use these tables, as does JsonWriter through JsonName.
+constexpr std::pair<enum EvaluationReason::Kind, char const*> kKindNames[] = {
+    {EvaluationReason::Kind::kOff, "OFF"},
+    {EvaluationReason::Kind::kFallthrough, "FALLTHROUGH"},
+    {EvaluationReason::Kind::kTargetMatch, "TARGET_MATCH"},
+    {EvaluationReason::Kind::kRuleMatch, "RULE_MATCH"},
+    {EvaluationReason::Kind::kPrerequisiteFailed, "PREREQUISITE_FAILED"},
+    {EvaluationReason::Kind::kError, "ERROR"},
+};
+
+constexpr std::pair<enum EvaluationReason::ErrorKind, char const*>
+    kErrorKindNames[] = {
+        {EvaluationReason::ErrorKind::kClientNotReady, "CLIENT_NOT_READY"},
+        {EvaluationReason::ErrorKind::kUserNotSpecified, "USER_NOT_SPECIFIED"},
+        {EvaluationReason::ErrorKind::kFlagNotFound, "FLAG_NOT_FOUND"},
+        {EvaluationReason::ErrorKind::kWrongType, "WRONG_TYPE"},
+        {EvaluationReason::ErrorKind::kMalformedFlag, "MALFORMED_FLAG"},
+        {EvaluationReason::ErrorKind::kException, "EXCEPTION"},
+};
+
+// kNone is the "no status" sentinel and has no name.
+constexpr std::pair<enum EvaluationReason::BigSegmentsStatus, char const*>
+    kBigSegmentsStatusNames[] = {
+        {EvaluationReason::BigSegmentsStatus::kHealthy, "HEALTHY"},
+        {EvaluationReason::BigSegmentsStatus::kStale, "STALE"},
+        {EvaluationReason::BigSegmentsStatus::kNotConfigured, "NOT_CONFIGURED"},
+        {EvaluationReason::BigSegmentsStatus::kStoreError, "STORE_ERROR"},
+};
+
+template <typename Enum, std::size_t N>
+char const* NameOf(std::pair<Enum, char const*> const (&names)[N],
+                   Enum const value) {
+    for (auto const& [candidate, name] : names) {
+        if (candidate == value) {
+            return name;
+        }
+    }
+    return "";
+}
+
+template <typename Enum, std::size_t N>
+tl::expected<Enum, JsonError> Parse(
+    std::pair<Enum, char const*> const (&names)[N],
     boost::json::value const& json_value) {
-    boost::ignore_unused(unused);
     if (!json_value.is_string()) {
         return tl::unexpected(JsonError::kSchemaFailure);
     }
     auto const& str = json_value.as_string();
-    if (str == "OFF") {
-        return EvaluationReason::Kind::kOff;
-    }
-    if (str == "FALLTHROUGH") {
-        return EvaluationReason::Kind::kFallthrough;
-    }
-    if (str == "TARGET_MATCH") {
-        return EvaluationReason::Kind::kTargetMatch;
-    }
-    if (str == "RULE_MATCH") {
-        return EvaluationReason::Kind::kRuleMatch;
-    }
-    if (str == "PREREQUISITE_FAILED") {
-        return EvaluationReason::Kind::kPrerequisiteFailed;
-    }
-    if (str == "ERROR") {
-        return EvaluationReason::Kind::kError;
+    for (auto const& [value, name] : names) {
+        if (str == name) {
+            return value;
+        }
     }
     return tl::make_unexpected(JsonError::kSchemaFailure);
 }
+}  // namespace
+
+char const* JsonName(enum EvaluationReason::Kind const kind) {
+    return NameOf(kKindNames, kind);
+}
+
+char const* JsonName(enum EvaluationReason::ErrorKind const error_kind) {
+    return NameOf(kErrorKindNames, error_kind);
+}
+
+char const* JsonName(enum EvaluationReason::BigSegmentsStatus const status) {
+    return NameOf(kBigSegmentsStatusNames, status);
+}
+
+tl::expected<enum EvaluationReason::Kind, JsonError> tag_invoke(
+    boost::json::value_to_tag<
+        tl::expected<enum EvaluationReason::Kind, JsonError>> const& unused,
+    boost::json::value const& json_value) {
+    boost::ignore_unused(unused);
+    return Parse(kKindNames, json_value);
+}
 
 void tag_invoke(boost::json::value_from_tag const& unused,
                 boost::json::value& json_value,
                 enum EvaluationReason::Kind const& kind) {
     boost::ignore_unused(unused);
-    auto& str = json_value.emplace_string();
-    switch (kind) {
-        case EvaluationReason::Kind::kOff:
-            str = "OFF";
-            break;
-        case EvaluationReason::Kind::kFallthrough:
-            str = "FALLTHROUGH";
-            break;
-        case EvaluationReason::Kind::kTargetMatch:
-            str = "TARGET_MATCH";
-            break;
-        case EvaluationReason::Kind::kRuleMatch:
-            str = "RULE_MATCH";
-            break;
-        case EvaluationReason::Kind::kPrerequisiteFailed:
-            str = "PREREQUISITE_FAILED";
-            break;
-        case EvaluationReason::Kind::kError:
-            str = "ERROR";
-            break;
-    }
+    json_value.emplace_string() = JsonName(kind);
 }
 
 tl::expected<enum EvaluationReason::ErrorKind, JsonError> tag_invoke(
@@ -71,58 +101,14 @@ tl::expected<enum EvaluationReason::ErrorKind, JsonError> tag_invoke(
                                            JsonError>> const& unused,
     boost::json::value const& json_value) {
     boost::ignore_unused(unused);
-
-    if (!json_value.is_string()) {
-        return tl::unexpected(JsonError::kSchemaFailure);
-    }
-    auto const& str = json_value.as_string();
-    if (str == "CLIENT_NOT_READY") {
-        return EvaluationReason::ErrorKind::kClientNotReady;
-    }
-    if (str == "USER_NOT_SPECIFIED") {
-        return EvaluationReason::ErrorKind::kUserNotSpecified;
-    }
-    if (str == "FLAG_NOT_FOUND") {
-        return EvaluationReason::ErrorKind::kFlagNotFound;
-    }
-    if (str == "WRONG_TYPE") {
-        return EvaluationReason::ErrorKind::kWrongType;
-    }
-    if (str == "MALFORMED_FLAG") {
-        return EvaluationReason::ErrorKind::kMalformedFlag;
-    }
-    if (str == "EXCEPTION") {
-        return EvaluationReason::ErrorKind::kException;
-    }
-    return tl::make_unexpected(JsonError::kSchemaFailure);
+    return Parse(kErrorKindNames, json_value);
 }
 
 void tag_invoke(boost::json::value_from_tag const& unused,
                 boost::json::value& json_value,
                 enum EvaluationReason::ErrorKind const& kind) {
     boost::ignore_unused(unused);
-
-    auto& str = json_value.emplace_string();
-    switch (kind) {
-        case EvaluationReason::ErrorKind::kClientNotReady:
-            str = "CLIENT_NOT_READY";
-            break;
-        case EvaluationReason::ErrorKind::kUserNotSpecified:
-            str = "USER_NOT_SPECIFIED";
-            break;
-        case EvaluationReason::ErrorKind::kFlagNotFound:
-            str = "FLAG_NOT_FOUND";
-            break;
-        case EvaluationReason::ErrorKind::kWrongType:
-            str = "WRONG_TYPE";
-            break;
-        case EvaluationReason::ErrorKind::kMalformedFlag:
-            str = "MALFORMED_FLAG";
-            break;
-        case EvaluationReason::ErrorKind::kException:
-            str = "EXCEPTION";
-            break;
-    }
+    json_value.emplace_string() = JsonName(kind);
 }
 
 tl::expected<enum EvaluationReason::BigSegmentsStatus, JsonError> tag_invoke(
@@ -131,50 +117,16 @@ tl::expected<enum EvaluationReason::BigSegmentsStatus, JsonError> tag_invoke(
                      JsonError>> const& unused,
     boost::json::value const& json_value) {
     boost::ignore_unused(unused);
-
-    if (!json_value.is_string()) {
-        return tl::unexpected(JsonError::kSchemaFailure);
-    }
-    auto const& str = json_value.as_string();
-    if (str == "HEALTHY") {
-        return EvaluationReason::BigSegmentsStatus::kHealthy;
-    }
-    if (str == "STALE") {
-        return EvaluationReason::BigSegmentsStatus::kStale;
-    }
-    if (str == "NOT_CONFIGURED") {
-        return EvaluationReason::BigSegmentsStatus::kNotConfigured;
-    }
-    if (str == "STORE_ERROR") {
-        return EvaluationReason::BigSegmentsStatus::kStoreError;
-    }
-    return tl::make_unexpected(JsonError::kSchemaFailure);
+    return Parse(kBigSegmentsStatusNames, json_value);
 }
 
 void tag_invoke(boost::json::value_from_tag const& unused,
                 boost::json::value& json_value,
                 enum EvaluationReason::BigSegmentsStatus const& status) {
     boost::ignore_unused(unused);
-
-    auto& str = json_value.emplace_string();
-    switch (status) {
-        case EvaluationReason::BigSegmentsStatus::kNone:
-            // kNone is the "no status" sentinel and shouldn't reach the wire;
-            // callers guard. If it ever does, emit an empty string.
-            break;
-        case EvaluationReason::BigSegmentsStatus::kHealthy:
-            str = "HEALTHY";
-            break;
-        case EvaluationReason::BigSegmentsStatus::kStale:
-            str = "STALE";
-            break;
-        case EvaluationReason::BigSegmentsStatus::kNotConfigured:
-            str = "NOT_CONFIGURED";
-            break;
-        case EvaluationReason::BigSegmentsStatus::kStoreError:
-            str = "STORE_ERROR";
-            break;
-    }
+    // kNone shouldn't reach the wire; callers guard. If it ever does, it is
+    // written as an empty string.
+    json_value.emplace_string() = JsonName(status);
 }
 
 tl::expected<EvaluationReason, JsonError> tag_invoke(
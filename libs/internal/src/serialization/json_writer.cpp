@@ -0,0 +1,242 @@
+#include <launchdarkly/serialization/json_evaluation_reason.hpp>
+#include <launchdarkly/serialization/json_writer.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace launchdarkly {
+
+// Doubles with a magnitude below this are integers exactly when they have no
+// fractional part.
+constexpr double kMaxExactInteger = 9007199254740992.0;  // 2^53
+
+JsonOutput::JsonOutput(std::string& out)
+    : string_(&out), buffer_(nullptr), size_(0), length_(0) {}
+
+JsonOutput::JsonOutput(char* buffer, std::size_t const size)
+    : string_(nullptr), buffer_(buffer), size_(size), length_(0) {}
+
+JsonWriter::JsonWriter(std::string& out) : JsonWriter(JsonOutput(out)) {}
+
+JsonWriter::JsonWriter(JsonOutput out) : out_(out), needs_comma_(false) {}
+
+void JsonWriter::Raw(std::string_view const json) {
+    out_.Append(json);
+}
+
+void JsonWriter::BeforeValue() {
+    if (needs_comma_) {
+        out_.Append(',');
+    }
+    needs_comma_ = true;
+}
+
+void JsonWriter::BeginObject() {
+    BeforeValue();
+    out_.Append('{');
+    needs_comma_ = false;
+}
+
+void JsonWriter::EndObject() {
+    out_.Append('}');
+    needs_comma_ = true;
+}
+
+void JsonWriter::BeginArray() {
+    BeforeValue();
+    out_.Append('[');
+    needs_comma_ = false;
+}
+
+void JsonWriter::EndArray() {
+    out_.Append(']');
+    needs_comma_ = true;
+}
+
+void JsonWriter::Key(std::string_view const key) {
+    BeforeValue();
+    AppendEscaped(key);
+    out_.Append(':');
+    needs_comma_ = false;
+}
+
+void JsonWriter::Null() {
+    BeforeValue();
+    out_.Append("null");
+}
+
+void JsonWriter::Bool(bool const value) {
+    BeforeValue();
+    out_.Append(value ? "true" : "false");
+}
+
+void JsonWriter::Uint(std::uint64_t const value) {
+    BeforeValue();
+    std::array<char, 24> buffer{};
+    auto const result =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    out_.Append(std::string_view(
+        buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())));
+}
+
+void JsonWriter::Int(std::int64_t const value) {
+    BeforeValue();
+    std::array<char, 24> buffer{};
+    auto const result =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    out_.Append(std::string_view(
+        buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())));
+}
+
+void JsonWriter::Number(double const value) {
+    if (!std::isfinite(value)) {
+        Null();
+        return;
+    }
+    if (std::fabs(value) < kMaxExactInteger && std::trunc(value) == value) {
+        Int(static_cast<std::int64_t>(value));
+        return;
+    }
+
+    BeforeValue();
+    std::array<char, 32> buffer{};
+#if defined(__cpp_lib_to_chars)
+    auto const result =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    out_.Append(std::string_view(
+        buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())));
+#else
+    // Prefer the shorter representation when it round-trips.
+    int length = std::snprintf(buffer.data(), buffer.size(), "%.15g", value);
+    if (std::strtod(buffer.data(), nullptr) != value) {
+        length = std::snprintf(buffer.data(), buffer.size(), "%.17g", value);
+    }
+    // snprintf follows the C locale's decimal separator.
+    for (int i = 0; i < length; i++) {
+        if (buffer[i] == ',') {
+            buffer[i] = '.';
+        }
+    }
+    out_.Append(
+        std::string_view(buffer.data(), static_cast<std::size_t>(length)));
+#endif
+}
+
+void JsonWriter::String(std::string_view const value) {
+    BeforeValue();
+    AppendEscaped(value);
+}
+
+void JsonWriter::AppendEscaped(std::string_view const value) {
+    static constexpr char kHex[] = "0123456789abcdef";
+
+    out_.Append('"');
+    std::size_t run_start = 0;
+    for (std::size_t i = 0; i < value.size(); i++) {
+        auto const c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out_.Append(value.substr(run_start, i - run_start));
+        run_start = i + 1;
+        switch (c) {
+            case '"':
+                out_.Append("\\\"");
+                break;
+            case '\\':
+                out_.Append("\\\\");
+                break;
+            case '\b':
+                out_.Append("\\b");
+                break;
+            case '\f':
+                out_.Append("\\f");
+                break;
+            case '\n':
+                out_.Append("\\n");
+                break;
+            case '\r':
+                out_.Append("\\r");
+                break;
+            case '\t':
+                out_.Append("\\t");
+                break;
+            default: {
+                char const escape[] = {'\\',         'u', '0', '0',
+                                       kHex[c >> 4], kHex[c & 0xf]};
+                out_.Append(std::string_view(escape, sizeof(escape)));
+            } break;
+        }
+    }
+    out_.Append(value.substr(run_start));
+    out_.Append('"');
+}
+
+void JsonWriter::Write(Value const& value) {
+    switch (value.Type()) {
+        case Value::Type::kNull:
+            Null();
+            break;
+        case Value::Type::kBool:
+            Bool(value.AsBool());
+            break;
+        case Value::Type::kNumber:
+            Number(value.AsDouble());
+            break;
+        case Value::Type::kString:
+            String(value.AsString());
+            break;
+        case Value::Type::kObject:
+            BeginObject();
+            for (auto const& pair : value.AsObject()) {
+                Key(pair.first);
+                Write(pair.second);
+            }
+            EndObject();
+            break;
+        case Value::Type::kArray:
+            BeginArray();
+            for (auto const& item : value.AsArray()) {
+                Write(item);
+            }
+            EndArray();
+            break;
+    }
+}
+
+void JsonWriter::Write(EvaluationReason const& reason) {
+    BeginObject();
+    Key("kind");
+    String(JsonName(reason.Kind()));
+    if (auto const error_kind = reason.ErrorKind()) {
+        Key("errorKind");
+        String(JsonName(*error_kind));
+    }
+    if (auto const status = reason.BigSegmentsStatus();
+        status != EvaluationReason::BigSegmentsStatus::kNone) {
+        Key("bigSegmentsStatus");
+        String(JsonName(status));
+    }
+    if (auto const rule_id = reason.RuleId()) {
+        Key("ruleId");
+        String(*rule_id);
+    }
+    if (auto const rule_index = reason.RuleIndex()) {
+        Key("ruleIndex");
+        Uint(*rule_index);
+    }
+    if (reason.InExperiment()) {
+        Key("inExperiment");
+        Bool(true);
+    }
+    if (auto const prerequisite_key = reason.PrerequisiteKey()) {
+        Key("prerequisiteKey");
+        String(*prerequisite_key);
+    }
+    EndObject();
+}
+
+}  // namespace launchdarkly
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <launchdarkly/logging/async_backend.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using launchdarkly::ILogBackend;
+using launchdarkly::LogLevel;
+using launchdarkly::logging::AsyncBackend;
+
+// Records every write. While held, the first write blocks until released, so
+// that tests can fill the ring behind it.
+class GatedLogBackend : public ILogBackend {
+   public:
+    explicit GatedLogBackend(LogLevel level = LogLevel::kDebug)
+        : level_(level) {}
+
+    bool Enabled(LogLevel level) noexcept override { return level >= level_; }
+
+    void Write(LogLevel level, std::string message) noexcept override {
+        std::unique_lock lock(mutex_);
+        writes_.emplace_back(level, std::move(message));
+        changed_.notify_all();
+        changed_.wait(lock, [this] { return !held_; });
+    }
+
+    void Hold() {
+        std::lock_guard lock(mutex_);
+        held_ = true;
+    }
+
+    void Release() {
+        std::lock_guard lock(mutex_);
+        held_ = false;
+        changed_.notify_all();
+    }
+
+    void WaitForWrites(std::size_t count) {
+        std::unique_lock lock(mutex_);
+        changed_.wait(lock, [&] { return writes_.size() >= count; });
+    }
+
+    std::vector<std::string> Messages() {
+        std::lock_guard lock(mutex_);
+        std::vector<std::string> messages;
+        for (auto const& [level, message] : writes_) {
+            messages.push_back(message);
+        }
+        return messages;
+    }
+
+    std::vector<std::pair<LogLevel, std::string>> Writes() {
+        std::lock_guard lock(mutex_);
+        return writes_;
+    }
+
+   private:
+    LogLevel level_;
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    bool held_ = false;
+    std::vector<std::pair<LogLevel, std::string>> writes_;
+};
+
+TEST(AsyncBackendTests, WritesEveryRecordInOrder) {
+    auto inner = std::make_shared<GatedLogBackend>();
+    {
+        AsyncBackend backend(inner, 8);
+        for (int i = 0; i < 1000; i++) {
+            backend.Write(LogLevel::kInfo, std::to_string(i));
+            if (i % 8 == 7) {
+                inner->WaitForWrites(i + 1);
+            }
+        }
+        EXPECT_EQ(backend.Dropped(), 0);
+    }
+
+    auto const messages = inner->Messages();
+    ASSERT_EQ(messages.size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(messages[i], std::to_string(i));
+    }
+}
+
+TEST(AsyncBackendTests, DestructionWritesQueuedRecords) {
+    auto inner = std::make_shared<GatedLogBackend>();
+    {
+        AsyncBackend backend(inner, 16);
+        for (int i = 0; i < 16; i++) {
+            backend.Write(LogLevel::kInfo, std::to_string(i));
+        }
+    }
+    EXPECT_EQ(inner->Messages().size(), 16);
+}
+
+TEST(AsyncBackendTests, WritesFromManyThreads) {
+    auto inner = std::make_shared<GatedLogBackend>();
+    {
+        AsyncBackend backend(inner, 4096);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&backend] {
+                for (int i = 0; i < 500; i++) {
+                    backend.Write(LogLevel::kInfo, "message");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(backend.Dropped(), 0);
+    }
+    EXPECT_EQ(inner->Messages().size(), 2000);
+}
+
+TEST(AsyncBackendTests, DropsNewestRecordsWhenFull) {
+    auto inner = std::make_shared<GatedLogBackend>();
+    inner->Hold();
+    {
+        AsyncBackend backend(inner, 4,
+                             AsyncBackend::OverflowPolicy::kDropNewest);
+        backend.Write(LogLevel::kInfo, "0");
+        // The background thread is now blocked writing the first record.
+        inner->WaitForWrites(1);
+        for (int i = 1; i <= 6; i++) {
+            backend.Write(LogLevel::kInfo, std::to_string(i));
+        }
+        EXPECT_EQ(backend.Dropped(), 2);
+        inner->Release();
+    }
+
+    // The drops are reported once the write in progress completes.
+    auto const writes = inner->Writes();
+    ASSERT_EQ(writes.size(), 6);
+    EXPECT_EQ(writes[0].second, "0");
+    EXPECT_EQ(writes[1].first, LogLevel::kWarn);
+    EXPECT_EQ(writes[1].second,
+              "2 log messages dropped because the log queue was full");
+    for (int i = 1; i <= 4; i++) {
+        EXPECT_EQ(writes[i + 1].second, std::to_string(i));
+    }
+}
+
+TEST(AsyncBackendTests, DropsOldestRecordsWhenFull) {
+    auto inner = std::make_shared<GatedLogBackend>();
+    inner->Hold();
+    {
+        AsyncBackend backend(inner, 4,
+                             AsyncBackend::OverflowPolicy::kDropOldest);
+        backend.Write(LogLevel::kInfo, "0");
+        inner->WaitForWrites(1);
+        for (int i = 1; i <= 6; i++) {
+            backend.Write(LogLevel::kInfo, std::to_string(i));
+        }
+        EXPECT_EQ(backend.Dropped(), 2);
+        inner->Release();
+    }
+
+    auto const messages = inner->Messages();
+    ASSERT_EQ(messages.size(), 6);
+    EXPECT_EQ(messages[0], "0");
+    EXPECT_EQ(messages[1],
+              "2 log messages dropped because the log queue was full");
+    EXPECT_EQ(messages[2], "3");
+    EXPECT_EQ(messages[3], "4");
+    EXPECT_EQ(messages[4], "5");
+    EXPECT_EQ(messages[5], "6");
+}
+
+TEST(AsyncBackendTests, DropReportRespectsWrappedLevel) {
+    auto inner = std::make_shared<GatedLogBackend>(LogLevel::kError);
+    inner->Hold();
+    {
+        AsyncBackend backend(inner, 2);
+        backend.Write(LogLevel::kError, "0");
+        inner->WaitForWrites(1);
+        for (int i = 1; i <= 3; i++) {
+            backend.Write(LogLevel::kError, std::to_string(i));
+        }
+        EXPECT_EQ(backend.Dropped(), 1);
+        inner->Release();
+    }
+    EXPECT_EQ(inner->Messages().size(), 3);
+}
+
+TEST(AsyncBackendTests, EnabledUsesWrappedBackend) {
+    auto inner = std::make_shared<GatedLogBackend>(LogLevel::kWarn);
+    AsyncBackend backend(inner);
+    EXPECT_FALSE(backend.Enabled(LogLevel::kInfo));
+    EXPECT_TRUE(backend.Enabled(LogLevel::kWarn));
+    EXPECT_TRUE(backend.Enabled(LogLevel::kError));
+}
@@ -12,6 +12,7 @@
 #include <chrono>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace beast = boost::beast;
 namespace http = beast::http;
@@ -20,6 +21,7 @@ using tcp = boost::asio::ip::tcp;
 
 using launchdarkly::config::shared::ClientSDK;
 using launchdarkly::config::shared::builders::HttpPropertiesBuilder;
+using launchdarkly::network::CurlMultiManager;
 using launchdarkly::network::CurlRequester;
 using launchdarkly::network::HttpMethod;
 using launchdarkly::network::HttpRequest;
@@ -39,7 +41,8 @@ class TestHttpServer {
     void Accept() {
         acceptor_.async_accept(socket_, [this](const beast::error_code& ec) {
             if (!ec) {
-                std::make_shared<Session>(std::move(socket_), handler_)
+                std::make_shared<Session>(std::move(socket_), handler_,
+                                          keep_alive_)
                     ->Run();
             }
             Accept();
@@ -52,15 +55,23 @@ class TestHttpServer {
         handler_ = std::move(handler);
     }
 
+    // When enabled, connections are kept open between requests so that
+    // clients may reuse them.
+    void SetKeepAlive(bool const keep_alive) { keep_alive_ = keep_alive; }
+
    private:
     class Session : public std::enable_shared_from_this<Session> {
        public:
         Session(tcp::socket socket,
                 std::function<http::response<http::string_body>(
-                    http::request<http::string_body> const&)> handler)
-            : socket_(std::move(socket)), handler_(std::move(handler)) {}
+                    http::request<http::string_body> const&)> handler,
+                bool const keep_alive)
+            : socket_(std::move(socket)),
+              handler_(std::move(handler)),
+              keep_alive_(keep_alive) {}
 
         void Run() {
+            req_ = {};
             http::async_read(
                 socket_, buffer_, req_,
                 [self = shared_from_this()](const beast::error_code& ec,
@@ -75,11 +86,16 @@ class TestHttpServer {
        private:
         void HandleRequest() {
             res_ = handler_(req_);
+            res_.keep_alive(keep_alive_ && req_.keep_alive());
             res_.prepare_payload();
 
             http::async_write(socket_, res_,
                               [self = shared_from_this()](
                                   beast::error_code ec, std::size_t) {
+                                  if (!ec && self->res_.keep_alive()) {
+                                      self->Run();
+                                      return;
+                                  }
                                   self->socket_.shutdown(
                                       tcp::socket::shutdown_send, ec);
                               });
@@ -92,6 +108,7 @@ class TestHttpServer {
         std::function<http::response<http::string_body>(
             http::request<http::string_body> const&)>
             handler_;
+        bool keep_alive_;
     };
 
     tcp::acceptor acceptor_;
@@ -100,6 +117,7 @@ class TestHttpServer {
     std::function<http::response<http::string_body>(
         http::request<http::string_body> const&)>
         handler_;
+    bool keep_alive_ = false;
 };
 
 class CurlRequesterTest : public ::testing::Test {
@@ -329,4 +347,54 @@ TEST_F(CurlRequesterTest, HandlesInvalidUrl) {
     EXPECT_TRUE(result.IsError());
 }
 
+TEST_F(CurlRequesterTest, RequestersOnSameContextShareConnections) {
+    server_->SetKeepAlive(true);
+    server_->SetHandler([](http::request<http::string_body> const& req)
+                            -> http::response<http::string_body> {
+        http::response<http::string_body> res{http::status::ok,
+                                               req.version()};
+        res.body() = "ok";
+        return res;
+    });
+
+    net::io_context client_ioc;
+    // Separate requesters model separate SDK components, such as polling and
+    // event delivery, which run on the same io_context.
+    const CurlRequester polling_requester(
+        client_ioc.get_executor(),
+        launchdarkly::config::shared::built::TlsOptions());
+    const CurlRequester events_requester(
+        client_ioc.get_executor(),
+        launchdarkly::config::shared::built::TlsOptions());
+
+    std::vector<HttpResult> results;
+
+    polling_requester.Request(
+        HttpRequest(GetServerUrl("/poll"), HttpMethod::kGet,
+                    HttpPropertiesBuilder<ClientSDK>().Build(), std::nullopt),
+        [&](HttpResult const& res) {
+            results.push_back(res);
+            events_requester.Request(
+                HttpRequest(GetServerUrl("/bulk"), HttpMethod::kPost,
+                            HttpPropertiesBuilder<ClientSDK>().Build(),
+                            "[]"),
+                [&](HttpResult const& res) {
+                    results.push_back(res);
+                    client_ioc.stop();
+                });
+        });
+
+    client_ioc.run();
+
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(200, results[0].Status());
+    EXPECT_EQ(200, results[1].Status());
+
+    auto const stats =
+        CurlMultiManager::shared(client_ioc.get_executor())->stats();
+    EXPECT_EQ(2, stats.transfers);
+    EXPECT_EQ(1, stats.new_connections);
+    EXPECT_EQ(1, stats.reused_connections);
+}
+
 #endif  // LD_CURL_NETWORKING
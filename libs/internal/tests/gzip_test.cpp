@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <launchdarkly/config/shared/builders/http_properties_builder.hpp>
+#include <launchdarkly/config/shared/sdks.hpp>
+#include <launchdarkly/network/gzip.hpp>
+#include <launchdarkly/network/requester.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/crc.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace beast = boost::beast;
+namespace http = beast::http;
+namespace net = boost::asio;
+using tcp = boost::asio::ip::tcp;
+
+using launchdarkly::config::shared::ServerSDK;
+using launchdarkly::config::shared::builders::HttpPropertiesBuilder;
+using launchdarkly::network::GzipDecompress;
+using launchdarkly::network::HttpMethod;
+using launchdarkly::network::HttpRequest;
+using launchdarkly::network::HttpResult;
+using launchdarkly::network::IsGzipEncoded;
+using launchdarkly::network::Requester;
+
+// Produced with: echo -n '{"flags":{},"segments":{}}' | gzip -n
+static std::array<unsigned char, 42> const kGzippedEmptyPayload{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xab, 0x56,
+    0x4a, 0xcb, 0x49, 0x4c, 0x2f, 0x56, 0xb2, 0xaa, 0xae, 0xd5, 0x51, 0x2a,
+    0x4e, 0x4d, 0xcf, 0x4d, 0xcd, 0x2b, 0x01, 0xf3, 0x6a, 0x01, 0x8a, 0x54,
+    0x75, 0x28, 0x1a, 0x00, 0x00, 0x00};
+
+static std::string AsString(std::array<unsigned char, 42> const& bytes) {
+    return {reinterpret_cast<char const*>(bytes.data()), bytes.size()};
+}
+
+static void AppendLittleEndian32(std::string& out, std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+// Minimal gzip encoder used to produce test responses.
+static std::string GzipCompress(std::string const& input) {
+    std::string out{"\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\x03", 10};
+
+    beast::zlib::deflate_stream deflater;
+    beast::zlib::z_params params;
+    params.next_in = input.data();
+    params.avail_in = input.size();
+
+    std::array<char, 4096> chunk{};
+    while (true) {
+        params.next_out = chunk.data();
+        params.avail_out = chunk.size();
+        beast::error_code ec;
+        deflater.write(params, beast::zlib::Flush::finish, ec);
+        out.append(chunk.data(), chunk.size() - params.avail_out);
+        if (ec == beast::zlib::error::end_of_stream) {
+            break;
+        }
+    }
+
+    boost::crc_32_type crc;
+    crc.process_bytes(input.data(), input.size());
+    AppendLittleEndian32(out, crc.checksum());
+    AppendLittleEndian32(out, static_cast<std::uint32_t>(input.size()));
+    return out;
+}
+
+// A payload resembling a polling response with many similar flags.
+static std::string MakePayload() {
+    std::string payload = R"({"flags":{)";
+    for (int i = 0; i < 500; i++) {
+        if (i != 0) {
+            payload += ",";
+        }
+        auto const key = "flag-" + std::to_string(i);
+        payload += "\"" + key + "\":{\"key\":\"" + key +
+                   R"(","on":true,"version":1,"variations":[true,false],)"
+                   R"("fallthrough":{"variation":0},"offVariation":1})";
+    }
+    payload += R"(},"segments":{}})";
+    return payload;
+}
+
+TEST(GzipTests, DecompressesGzipPayload) {
+    EXPECT_EQ(R"({"flags":{},"segments":{}})",
+              GzipDecompress(AsString(kGzippedEmptyPayload)));
+}
+
+TEST(GzipTests, RoundTripsLargePayload) {
+    auto const payload = MakePayload();
+    auto const compressed = GzipCompress(payload);
+    EXPECT_LT(compressed.size(), payload.size());
+    EXPECT_EQ(payload, GzipDecompress(compressed));
+}
+
+TEST(GzipTests, RejectsNonGzipData) {
+    EXPECT_FALSE(GzipDecompress(R"({"flags":{}})"));
+    EXPECT_FALSE(GzipDecompress(""));
+}
+
+TEST(GzipTests, RejectsTruncatedData) {
+    auto const compressed = AsString(kGzippedEmptyPayload);
+    EXPECT_FALSE(GzipDecompress(compressed.substr(0, 20)));
+    // Deflate data intact, but trailer missing.
+    EXPECT_FALSE(GzipDecompress(compressed.substr(0, compressed.size() - 8)));
+}
+
+TEST(GzipTests, RejectsChecksumMismatch) {
+    auto compressed = AsString(kGzippedEmptyPayload);
+    // The trailer is CRC32 followed by ISIZE, four bytes each.
+    ASSERT_EQ(0x8a, static_cast<unsigned char>(compressed[34]));
+    compressed[compressed.size() - 8] ^= 0x01;
+    EXPECT_FALSE(GzipDecompress(compressed));
+}
+
+TEST(GzipTests, DetectsContentEncodingCaseInsensitively) {
+    EXPECT_TRUE(IsGzipEncoded({{"Content-Encoding", "GZIP"}}));
+    EXPECT_FALSE(IsGzipEncoded({{"Content-Encoding", "br"}}));
+    EXPECT_FALSE(IsGzipEncoded({}));
+}
+
+// Serves a fixed number of requests for a polling payload. Responses are
+// gzip encoded when requested, and 304 is returned when the If-None-Match
+// header matches the current ETag.
+class PollingEndpoint {
+   public:
+    PollingEndpoint(std::string payload, std::size_t request_count)
+        : payload_(std::move(payload)),
+          acceptor_(ioc_, {net::ip::make_address("127.0.0.1"), 0}) {
+        thread_ = std::thread([this, request_count]() {
+            for (std::size_t i = 0; i < request_count; i++) {
+                Serve();
+            }
+        });
+    }
+
+    ~PollingEndpoint() { Wait(); }
+
+    // Waits for all requests to be served.
+    void Wait() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    [[nodiscard]] std::string Url() const {
+        return "http://127.0.0.1:" +
+               std::to_string(acceptor_.local_endpoint().port()) +
+               "/sdk/latest-all";
+    }
+
+    // Body bytes written for each response, in order.
+    std::vector<std::size_t> body_bytes;
+
+   private:
+    static constexpr char const* kEtag = "\"payload-1\"";
+
+    void Serve() {
+        tcp::socket socket(ioc_);
+        acceptor_.accept(socket);
+
+        beast::flat_buffer buffer;
+        http::request<http::string_body> req;
+        http::read(socket, buffer, req);
+
+        http::response<http::string_body> res{http::status::ok, req.version()};
+        res.set(http::field::etag, kEtag);
+        if (req[http::field::if_none_match] == kEtag) {
+            res.result(http::status::not_modified);
+        } else if (req[http::field::accept_encoding] == "gzip") {
+            res.set(http::field::content_encoding, "gzip");
+            res.body() = GzipCompress(payload_);
+        } else {
+            res.body() = payload_;
+        }
+        body_bytes.push_back(res.body().size());
+        res.prepare_payload();
+
+        http::write(socket, res);
+        beast::error_code ec;
+        socket.shutdown(tcp::socket::shutdown_both, ec);
+    }
+
+    std::string payload_;
+    net::io_context ioc_;
+    tcp::acceptor acceptor_;
+    std::thread thread_;
+};
+
+static HttpResult Poll(net::io_context& ioc,
+                       Requester const& requester,
+                       std::string const& url,
+                       std::map<std::string, std::string> headers) {
+    auto properties =
+        HttpPropertiesBuilder<ServerSDK>().Headers(std::move(headers)).Build();
+    HttpResult result(std::nullopt);
+    requester.Request(
+        HttpRequest(url, HttpMethod::kGet, properties, std::nullopt),
+        [&](HttpResult const& res) {
+            result = res;
+            ioc.stop();
+        });
+    ioc.restart();
+    ioc.run();
+    return result;
+}
+
+TEST(GzipTests, CompressedAndConditionalPollingAgainstLocalEndpoint) {
+    auto const payload = MakePayload();
+    PollingEndpoint endpoint(payload, 3);
+
+    net::io_context ioc;
+    Requester const requester(ioc.get_executor(),
+                              launchdarkly::config::shared::built::TlsOptions());
+
+    auto const plain = Poll(ioc, requester, endpoint.Url(), {});
+    ASSERT_EQ(200, plain.Status());
+    EXPECT_EQ(payload, plain.Body());
+
+    auto const compressed =
+        Poll(ioc, requester, endpoint.Url(), {{"Accept-Encoding", "gzip"}});
+    ASSERT_EQ(200, compressed.Status());
+    EXPECT_EQ(payload, compressed.Body());
+
+    auto const not_modified = Poll(
+        ioc, requester, endpoint.Url(),
+        {{"Accept-Encoding", "gzip"}, {"If-None-Match", "\"payload-1\""}});
+    EXPECT_EQ(304, not_modified.Status());
+    EXPECT_TRUE(!not_modified.Body() || not_modified.Body()->empty());
+
+    endpoint.Wait();
+    ASSERT_EQ(3, endpoint.body_bytes.size());
+    auto const uncompressed_bytes = endpoint.body_bytes[0];
+    auto const compressed_bytes = endpoint.body_bytes[1];
+    auto const not_modified_bytes = endpoint.body_bytes[2];
+
+    // The repetitive flag payload compresses by well over an order of
+    // magnitude, and an unchanged payload costs nothing to transfer or parse.
+    EXPECT_EQ(payload.size(), uncompressed_bytes);
+    EXPECT_LT(compressed_bytes * 10, uncompressed_bytes);
+    EXPECT_EQ(0, not_modified_bytes);
+}
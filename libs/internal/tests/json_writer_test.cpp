@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <launchdarkly/serialization/json_writer.hpp>
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+using namespace launchdarkly;
+
+static std::string WriteValue(Value const& value) {
+    std::string out;
+    JsonWriter writer(out);
+    writer.Write(value);
+    return out;
+}
+
+TEST(JsonWriterTests, WritesNestedContainersWithSeparators) {
+    std::string out;
+    JsonWriter writer(out);
+    writer.BeginObject();
+    writer.Key("a");
+    writer.BeginArray();
+    writer.Int(-1);
+    writer.BeginObject();
+    writer.EndObject();
+    writer.BeginArray();
+    writer.EndArray();
+    writer.EndArray();
+    writer.Key("b");
+    writer.Null();
+    writer.Key("c");
+    writer.Uint(18446744073709551615ull);
+    writer.EndObject();
+
+    EXPECT_EQ(out, R"({"a":[-1,{},[]],"b":null,"c":18446744073709551615})");
+}
+
+TEST(JsonWriterTests, AppendsToExistingText) {
+    std::string out = "prefix ";
+    JsonWriter writer(out);
+    writer.Bool(true);
+    EXPECT_EQ(out, "prefix true");
+}
+
+TEST(JsonWriterTests, EscapesStrings) {
+    EXPECT_EQ(WriteValue("plain"), R"("plain")");
+    EXPECT_EQ(WriteValue("quote\" backslash\\"), R"("quote\" backslash\\")");
+    EXPECT_EQ(WriteValue("\b\f\n\r\t"), R"("\b\f\n\r\t")");
+    EXPECT_EQ(WriteValue(std::string("\x01\x1f", 2)), R"("\u0001\u001f")");
+    EXPECT_EQ(WriteValue("caf\xc3\xa9"), "\"caf\xc3\xa9\"");
+}
+
+TEST(JsonWriterTests, WritesNumbers) {
+    EXPECT_EQ(WriteValue(0), "0");
+    EXPECT_EQ(WriteValue(42), "42");
+    EXPECT_EQ(WriteValue(-7.0), "-7");
+    EXPECT_EQ(WriteValue(0.5), "0.5");
+    EXPECT_EQ(WriteValue(1.234), "1.234");
+    EXPECT_EQ(WriteValue(0.1), "0.1");
+    EXPECT_EQ(WriteValue(std::stod(WriteValue(1.0 / 3))), WriteValue(1.0 / 3));
+    EXPECT_EQ(WriteValue(std::numeric_limits<double>::infinity()), "null");
+    EXPECT_EQ(WriteValue(std::numeric_limits<double>::quiet_NaN()), "null");
+}
+
+TEST(JsonWriterTests, WritesValues) {
+    EXPECT_EQ(WriteValue(Value::Null()), "null");
+    EXPECT_EQ(WriteValue(false), "false");
+    EXPECT_EQ(WriteValue(Value({"a", 1, true})), R"(["a",1,true])");
+    EXPECT_EQ(WriteValue(Value(std::map<std::string, Value>{
+                  {"k", Value({Value::Null()})}})),
+              R"({"k":[null]})");
+}
+
+static std::string WriteReason(EvaluationReason const& reason) {
+    std::string out;
+    JsonWriter writer(out);
+    writer.Write(reason);
+    return out;
+}
+
+TEST(JsonWriterTests, WritesReasons) {
+    EXPECT_EQ(WriteReason(EvaluationReason::Fallthrough(true)),
+              R"({"kind":"FALLTHROUGH","inExperiment":true})");
+    EXPECT_EQ(WriteReason(
+                  EvaluationReason(EvaluationReason::ErrorKind::kFlagNotFound)),
+              R"({"kind":"ERROR","errorKind":"FLAG_NOT_FOUND"})");
+    EXPECT_EQ(WriteReason(EvaluationReason::RuleMatch(2, "rule-id", false)),
+              R"({"kind":"RULE_MATCH","ruleId":"rule-id","ruleIndex":2})");
+}
+
+TEST(JsonWriterTests, WritesIntoBuffer) {
+    char buffer[16];
+    JsonWriter writer(JsonOutput(buffer, sizeof(buffer)));
+    writer.Write(Value({"a", 1}));
+    ASSERT_EQ(writer.Length(), 7);
+    EXPECT_EQ(std::string(buffer, writer.Length()), R"(["a",1])");
+}
+
+TEST(JsonWriterTests, CountsTextWhichDoesNotFitBuffer) {
+    std::string const expected = R"({"key":"a longer value"})";
+
+    char buffer[8];
+    std::memset(buffer, '#', sizeof(buffer));
+    // Only the first four bytes are offered to the writer.
+    JsonWriter writer(JsonOutput(buffer, 4));
+    writer.BeginObject();
+    writer.Key("key");
+    writer.String("a longer value");
+    writer.EndObject();
+
+    EXPECT_EQ(writer.Length(), expected.size());
+    EXPECT_EQ(std::string(buffer, 4), expected.substr(0, 4));
+    EXPECT_EQ(std::string(buffer + 4, 4), "####");
+
+    JsonWriter counter(JsonOutput(nullptr, 0));
+    counter.String("a longer value");
+    EXPECT_EQ(counter.Length(), 16);
+}
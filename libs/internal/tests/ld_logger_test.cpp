@@ -127,3 +127,79 @@ TEST(LDLoggerTest, LogFromConstMethod) {
     EXPECT_EQ(1, messages.count(LogLevel::kInfo));
     EXPECT_EQ("const log", messages[LogLevel::kInfo][0]);
 }
+
+TEST(LDLoggerTest, DoesNotEvaluateStreamedExpressionsForDisabledLevel) {
+    Messages messages;
+    Logger logger(std::make_unique<TestLogBackend>(LogLevel::kError,
+                                                   "TestLogger", messages));
+
+    int evaluations = 0;
+    auto expensive = [&evaluations] {
+        evaluations++;
+        return "expensive";
+    };
+
+    LD_LOG(logger, LogLevel::kDebug) << expensive();
+    EXPECT_EQ(0, evaluations);
+
+    LD_LOG(logger, LogLevel::kError) << expensive();
+    EXPECT_EQ(1, evaluations);
+    EXPECT_EQ("expensive", messages[LogLevel::kError][0]);
+}
+
+TEST(LDLoggerTest, LogCanBeTheBodyOfAnIfWithAnElse) {
+    Messages messages;
+    Logger logger(std::make_unique<TestLogBackend>(LogLevel::kDebug,
+                                                   "TestLogger", messages));
+
+    bool const condition = false;
+    if (condition)
+        LD_LOG(logger, LogLevel::kInfo) << "then";
+    else
+        LD_LOG(logger, LogLevel::kInfo) << "else";
+
+    ASSERT_EQ(1, messages[LogLevel::kInfo].size());
+    EXPECT_EQ("else", messages[LogLevel::kInfo][0]);
+}
+
+TEST(LDLoggerTest, RateLimitedLogWritesOncePerInterval) {
+    Messages messages;
+    Logger logger(std::make_unique<TestLogBackend>(LogLevel::kDebug,
+                                                   "TestLogger", messages));
+
+    auto now = std::chrono::steady_clock::time_point{};
+    launchdarkly::LogRateLimiter limiter(std::chrono::minutes(1),
+                                         [&now] { return now; });
+
+    for (int i = 0; i < 5; i++) {
+        LD_LOG_RATE_LIMITED(logger, LogLevel::kWarn, limiter) << "repeated";
+        now += std::chrono::seconds(1);
+    }
+    ASSERT_EQ(1, messages[LogLevel::kWarn].size());
+    EXPECT_EQ("repeated", messages[LogLevel::kWarn][0]);
+
+    now += std::chrono::minutes(1);
+    LD_LOG_RATE_LIMITED(logger, LogLevel::kWarn, limiter) << "repeated";
+    ASSERT_EQ(2, messages[LogLevel::kWarn].size());
+    EXPECT_EQ("repeated (4 similar messages suppressed since last logged)",
+              messages[LogLevel::kWarn][1]);
+
+    now += std::chrono::minutes(1);
+    LD_LOG_RATE_LIMITED(logger, LogLevel::kWarn, limiter) << "repeated";
+    ASSERT_EQ(3, messages[LogLevel::kWarn].size());
+    EXPECT_EQ("repeated", messages[LogLevel::kWarn][2]);
+}
+
+TEST(LDLoggerTest, RateLimitedLogDoesNotCountDisabledLevel) {
+    Messages messages;
+    Logger logger(std::make_unique<TestLogBackend>(LogLevel::kError,
+                                                   "TestLogger", messages));
+
+    launchdarkly::LogRateLimiter limiter;
+    for (int i = 0; i < 3; i++) {
+        LD_LOG_RATE_LIMITED(logger, LogLevel::kWarn, limiter) << "disabled";
+    }
+    EXPECT_EQ(0, messages.count(LogLevel::kWarn));
+    EXPECT_TRUE(limiter.TryAcquire());
+    EXPECT_EQ(0, limiter.TakeSuppressed());
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <launchdarkly/metrics/registry.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using launchdarkly::metrics::Histogram;
+using launchdarkly::metrics::Registry;
+
+TEST(MetricsRegistryTests, CounterSumsAddsFromManyThreads) {
+    Registry registry;
+    auto& counter = registry.GetCounter("count");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 1000; i++) {
+                counter.Add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    counter.Add(5);
+
+    EXPECT_EQ(counter.Value(), 8005);
+    EXPECT_EQ(registry.Snapshot().counters.at("count"), 8005);
+}
+
+TEST(MetricsRegistryTests, SameNameReturnsSameMetric) {
+    Registry registry;
+    EXPECT_EQ(&registry.GetCounter("a"), &registry.GetCounter("a"));
+    EXPECT_NE(&registry.GetCounter("a"), &registry.GetCounter("b"));
+    EXPECT_EQ(&registry.GetGauge("a"), &registry.GetGauge("a"));
+    EXPECT_EQ(&registry.GetHistogram("a"), &registry.GetHistogram("a"));
+}
+
+TEST(MetricsRegistryTests, GaugeReportsLatestLevel) {
+    Registry registry;
+    auto& gauge = registry.GetGauge("level");
+    gauge.Set(10);
+    gauge.Add(-3);
+    EXPECT_EQ(registry.Snapshot().gauges.at("level"), 7);
+}
+
+TEST(MetricsRegistryTests, HistogramCountsSmallValuesExactly) {
+    Histogram histogram;
+    for (std::uint64_t value = 0; value < 8; value++) {
+        histogram.Record(value);
+    }
+
+    auto const snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.count, 8);
+    EXPECT_EQ(snapshot.sum, 28);
+    EXPECT_EQ(snapshot.max, 7);
+    ASSERT_EQ(snapshot.buckets.size(), 8);
+    for (std::uint64_t value = 0; value < 8; value++) {
+        EXPECT_EQ(snapshot.buckets[value].upper_bound, value);
+        EXPECT_EQ(snapshot.buckets[value].count, 1);
+    }
+}
+
+TEST(MetricsRegistryTests, HistogramBucketsBoundValuesWithinAnEighth) {
+    for (std::uint64_t value : std::vector<std::uint64_t>{
+             8, 9, 15, 16, 17, 1000, 123456789,
+             std::numeric_limits<std::uint64_t>::max()}) {
+        Histogram histogram;
+        histogram.Record(value);
+        auto const snapshot = histogram.Snapshot();
+        ASSERT_EQ(snapshot.buckets.size(), 1);
+        auto const upper_bound = snapshot.buckets[0].upper_bound;
+        EXPECT_GE(upper_bound, value);
+        EXPECT_LE(upper_bound - value, value / 8);
+    }
+}
+
+TEST(MetricsRegistryTests, HistogramPercentiles) {
+    Histogram histogram;
+    for (std::uint64_t value = 1; value <= 1000; value++) {
+        histogram.Record(value);
+    }
+
+    auto const snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.max, 1000);
+    EXPECT_DOUBLE_EQ(snapshot.Mean(), 500.5);
+
+    for (double percentile : {1.0, 50.0, 90.0, 99.0}) {
+        auto const expected = static_cast<std::uint64_t>(percentile * 10);
+        auto const actual = snapshot.Percentile(percentile);
+        EXPECT_GE(actual, expected);
+        EXPECT_LE(actual - expected, expected / 8);
+    }
+    EXPECT_EQ(snapshot.Percentile(100), 1000);
+}
+
+TEST(MetricsRegistryTests, EmptyHistogram) {
+    Registry registry;
+    (void)registry.GetHistogram("latency");
+
+    auto const snapshot = registry.Snapshot().histograms.at("latency");
+    EXPECT_EQ(snapshot.count, 0);
+    EXPECT_TRUE(snapshot.buckets.empty());
+    EXPECT_EQ(snapshot.Percentile(50), 0);
+    EXPECT_EQ(snapshot.Mean(), 0);
+}
@@ -7,6 +7,8 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/steady_timer.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -25,6 +27,13 @@ using SocketHandle = boost::asio::ip::tcp::socket;
  * multi interface with Boost.ASIO. Instead of blocking threads, CURL notifies
  * us via callbacks when sockets need attention, and we use ASIO to monitor
  * those sockets asynchronously.
+ *
+ * Managers obtained through shared() are pooled per execution context, so
+ * every component running on the same context (polling, streaming, event
+ * delivery) adds its transfers to one multi handle. This lets CURL reuse
+ * connections between components and multiplex concurrent requests to the
+ * same host over a single HTTP/2 connection. All managers additionally share
+ * a process-wide DNS cache and TLS session cache.
  */
 class CurlMultiManager : public std::enable_shared_from_this<CurlMultiManager> {
 public:
@@ -56,12 +65,36 @@ public:
     using CompletionCallback = std::function<void(std::shared_ptr<CURL>, Result)>;
 
     /**
-     * Create a CurlMultiManager on the given executor.
+     * Connection reuse statistics for the transfers completed by a manager.
+     */
+    struct Stats {
+        // Number of transfers that completed (successfully or not).
+        std::uint64_t transfers;
+        // Number of transfers which had to establish a new connection.
+        std::uint64_t new_connections;
+        // Number of transfers which were able to use an existing connection.
+        std::uint64_t reused_connections;
+    };
+
+    /**
+     * Create a CurlMultiManager on the given executor. The manager has its
+     * own connection cache and is not shared with other components.
      * @param executor The ASIO executor to run operations on
      */
     static std::shared_ptr<CurlMultiManager> create(
         boost::asio::any_io_executor executor);
 
+    /**
+     * Get the CurlMultiManager shared by all components running on the
+     * execution context of the given executor, creating it if needed.
+     *
+     * Operations of the shared manager are serialized on a strand, so it is
+     * safe to use from contexts which are run by multiple threads.
+     * @param executor An executor of the execution context to pool on
+     */
+    static std::shared_ptr<CurlMultiManager> shared(
+        boost::asio::any_io_executor executor);
+
     ~CurlMultiManager();
 
     // Non-copyable and non-movable
@@ -82,6 +115,11 @@ public:
                     CompletionCallback callback,
                     std::optional<std::chrono::milliseconds> read_timeout = std::nullopt);
 
+    /**
+     * @return Connection reuse statistics for the transfers completed so far.
+     */
+    [[nodiscard]] Stats stats() const;
+
 private:
     explicit CurlMultiManager(boost::asio::any_io_executor executor);
 
@@ -107,6 +145,18 @@ private:
     // Handle read timeout for a specific handle
     void handle_read_timeout(CURL* easy);
 
+    // Register an easy handle with the multi handle. Must run on executor_.
+    void do_add_handle(const std::shared_ptr<CURL>& easy,
+                       curl_slist* headers,
+                       CompletionCallback callback,
+                       std::optional<std::chrono::milliseconds> read_timeout);
+
+    // Stop an easy handle from using the share handle.
+    void detach_share(CURL* easy) const;
+
+    // Update connection reuse statistics for a completed transfer.
+    void record_transfer(CURL* easy);
+
     // Per-socket data
     struct SocketInfo {
         curl_socket_t sockfd;
@@ -139,6 +189,14 @@ private:
     std::map<CURL*, HandleTimeoutInfo> handle_timeouts_;
     std::map<curl_socket_t, SocketInfo> sockets_; // Managed socket info
     int still_running_{0};
+
+    // Process-wide DNS and TLS session cache. Held so that it outlives the
+    // easy handles which reference it.
+    std::shared_ptr<CURLSH> share_handle_;
+
+    std::atomic<std::uint64_t> transfers_{0};
+    std::atomic<std::uint64_t> new_connections_{0};
+    std::atomic<std::uint64_t> reused_connections_{0};
 };
 } // namespace launchdarkly::network
 
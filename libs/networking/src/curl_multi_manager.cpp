@@ -2,9 +2,57 @@
 
 #include "launchdarkly/network/curl_multi_manager.hpp"
 
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/execution/context.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/query.hpp>
+#include <boost/asio/strand.hpp>
+
+#include <array>
 
 namespace launchdarkly::network {
+
+namespace {
+
+// One mutex per kind of data that can be placed in a share handle.
+std::array<std::mutex, CURL_LOCK_DATA_LAST> share_locks;
+
+void ShareLock(CURL*, curl_lock_data data, curl_lock_access, void*) {
+    share_locks[data].lock();
+}
+
+void ShareUnlock(CURL*, curl_lock_data data, void*) {
+    share_locks[data].unlock();
+}
+
+// Returns the process-wide share handle, creating it if no manager currently
+// holds one. DNS results and TLS sessions are shared between all managers.
+// Connections themselves are pooled per multi handle, which is why shared()
+// pools managers per execution context.
+std::shared_ptr<CURLSH> AcquireShareHandle() {
+    static std::mutex mutex;
+    static std::weak_ptr<CURLSH> current;
+
+    std::lock_guard lock(mutex);
+    if (auto share = current.lock()) {
+        return share;
+    }
+
+    std::shared_ptr<CURLSH> share(curl_share_init(), curl_share_cleanup);
+    if (!share) {
+        return nullptr;
+    }
+    curl_share_setopt(share.get(), CURLSHOPT_LOCKFUNC, ShareLock);
+    curl_share_setopt(share.get(), CURLSHOPT_UNLOCKFUNC, ShareUnlock);
+    curl_share_setopt(share.get(), CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share.get(), CURLSHOPT_SHARE,
+                      CURL_LOCK_DATA_SSL_SESSION);
+    current = share;
+    return share;
+}
+
+}  // namespace
+
 std::shared_ptr<CurlMultiManager> CurlMultiManager::create(
     boost::asio::any_io_executor executor) {
     // Can't use make_shared because constructor is private
@@ -12,10 +60,41 @@ std::shared_ptr<CurlMultiManager> CurlMultiManager::create(
         new CurlMultiManager(std::move(executor)));
 }
 
+std::shared_ptr<CurlMultiManager> CurlMultiManager::shared(
+    boost::asio::any_io_executor executor) {
+    static std::mutex mutex;
+    static std::map<boost::asio::execution_context*,
+                    std::weak_ptr<CurlMultiManager>>
+        managers;
+
+    auto* context =
+        &boost::asio::query(executor, boost::asio::execution::context);
+
+    std::lock_guard lock(mutex);
+    for (auto it = managers.begin(); it != managers.end();) {
+        if (it->second.expired()) {
+            it = managers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (auto const it = managers.find(context); it != managers.end()) {
+        if (auto manager = it->second.lock()) {
+            return manager;
+        }
+    }
+
+    auto manager = create(boost::asio::make_strand(std::move(executor)));
+    managers[context] = manager;
+    return manager;
+}
+
 CurlMultiManager::CurlMultiManager(boost::asio::any_io_executor executor)
     : executor_(std::move(executor)),
       multi_handle_(curl_multi_init(), &curl_multi_cleanup),
-      timer_(executor_) {
+      timer_(executor_),
+      share_handle_(AcquireShareHandle()) {
     if (!multi_handle_) {
         throw std::runtime_error("Failed to initialize CURL multi handle");
     }
@@ -26,6 +105,9 @@ CurlMultiManager::CurlMultiManager(boost::asio::any_io_executor executor)
     curl_multi_setopt(pmulti, CURLMOPT_SOCKETDATA, this);
     curl_multi_setopt(pmulti, CURLMOPT_TIMERFUNCTION, timer_callback);
     curl_multi_setopt(pmulti, CURLMOPT_TIMERDATA, this);
+    // Allow concurrent transfers to the same host to be multiplexed over a
+    // single HTTP/2 connection instead of opening additional connections.
+    curl_multi_setopt(pmulti, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
 }
 
 CurlMultiManager::~CurlMultiManager() {
@@ -34,6 +116,7 @@ CurlMultiManager::~CurlMultiManager() {
         // Do NOT invoke callbacks as they may access destroyed objects
         for (auto& [easy, callback] : callbacks_) {
             curl_multi_remove_handle(multi_handle_.get(), easy);
+            detach_share(easy);
 
             // Free headers if they exist for this handle
             if (auto header_it = headers_.find(easy);
@@ -49,9 +132,63 @@ void CurlMultiManager::add_handle(const std::shared_ptr<CURL>& easy,
                                   CompletionCallback callback,
                                   std::optional<std::chrono::milliseconds>
                                   read_timeout) {
+    // The multi handle may only be used from the manager's executor, which
+    // for a shared manager is a strand distinct from the caller's executor.
+    boost::asio::dispatch(
+        executor_, [self = shared_from_this(), easy, headers,
+                    callback = std::move(callback), read_timeout]() mutable {
+            self->do_add_handle(easy, headers, std::move(callback),
+                                read_timeout);
+        });
+}
+
+CurlMultiManager::Stats CurlMultiManager::stats() const {
+    return Stats{transfers_.load(std::memory_order_relaxed),
+                 new_connections_.load(std::memory_order_relaxed),
+                 reused_connections_.load(std::memory_order_relaxed)};
+}
+
+void CurlMultiManager::record_transfer(CURL* easy) {
+    transfers_.fetch_add(1, std::memory_order_relaxed);
+
+    // CURLINFO_NUM_CONNECTS is the number of new connections the transfer
+    // had to create; zero means an existing connection was reused.
+    long num_connects = 0;
+    if (curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &num_connects) !=
+        CURLE_OK) {
+        return;
+    }
+    if (num_connects > 0) {
+        new_connections_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        reused_connections_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void CurlMultiManager::detach_share(CURL* easy) const {
+    // Easy handles may outlive the manager, so they must not keep a reference
+    // to the share handle once their transfer is finished.
+    if (share_handle_) {
+        curl_easy_setopt(easy, CURLOPT_SHARE, nullptr);
+    }
+}
+
+void CurlMultiManager::do_add_handle(const std::shared_ptr<CURL>& easy,
+                                     curl_slist* headers,
+                                     CompletionCallback callback,
+                                     std::optional<std::chrono::milliseconds>
+                                     read_timeout) {
+    if (share_handle_) {
+        curl_easy_setopt(easy.get(), CURLOPT_SHARE, share_handle_.get());
+    }
+    // Prefer waiting for an in-progress connection which may support
+    // multiplexing over opening a new connection to the same host.
+    curl_easy_setopt(easy.get(), CURLOPT_PIPEWAIT, 1L);
+
     if (const CURLMcode rc = curl_multi_add_handle(
             multi_handle_.get(), easy.get());
         rc != CURLM_OK) {
+        detach_share(easy.get());
         // Free headers on error
         if (headers) {
             curl_slist_free_all(headers);
@@ -204,8 +341,11 @@ void CurlMultiManager::check_multi_info() {
                 }
             }
 
+            record_transfer(easy);
+
             // Remove from multi handle
             curl_multi_remove_handle(multi_handle_.get(), easy);
+            detach_share(easy);
 
             // Free headers
             if (headers) {
@@ -420,6 +560,7 @@ void CurlMultiManager::handle_read_timeout(CURL* easy) {
 
     // Remove from multi handle
     curl_multi_remove_handle(multi_handle_.get(), easy);
+    detach_share(easy);
 
     // Free headers
     if (headers) {
@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Aws::DynamoDB {
 class DynamoDBClient;
@@ -61,6 +62,9 @@ class DynamoDBDataSource final : public ISerializedDataReader {
 
     [[nodiscard]] GetResult Get(ISerializedItemKind const& kind,
                                 std::string const& itemKey) const override;
+    [[nodiscard]] GetManyResult GetMany(
+        ISerializedItemKind const& kind,
+        std::vector<std::string> const& itemKeys) const override;
     [[nodiscard]] AllResult All(ISerializedItemKind const& kind) const override;
     [[nodiscard]] std::string const& Identity() const override;
     [[nodiscard]] bool Initialized() const override;
@@ -8,10 +8,16 @@
 #include <aws/core/utils/Outcome.h>
 #include <aws/dynamodb/DynamoDBClient.h>
 #include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
 #include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/KeysAndAttributes.h>
 #include <aws/dynamodb/model/QueryRequest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
+#include <set>
+#include <thread>
 #include <utility>
 
 namespace launchdarkly::server_side::integrations {
@@ -24,6 +30,16 @@ using detail::kPartitionKey;
 using detail::kSortKey;
 using detail::PrefixedNamespace;
 
+// BatchGetItem accepts at most 100 keys per request.
+constexpr std::size_t kMaxBatchGetKeys = 100;
+
+// BatchGetItem may return some keys as unprocessed (for instance when the
+// table's throughput is exceeded); they are re-requested this many times in
+// total before giving up, with an exponential backoff between attempts as
+// recommended by AWS.
+constexpr std::size_t kMaxBatchGetAttempts = 5;
+constexpr std::chrono::milliseconds kBatchGetBaseBackoff{25};
+
 }  // namespace
 
 tl::expected<std::unique_ptr<DynamoDBDataSource>, std::string>
@@ -98,6 +114,86 @@ ISerializedDataReader::GetResult DynamoDBDataSource::Get(
     return SerializedItemDescriptor::Present(0, serialized);
 }
 
+ISerializedDataReader::GetManyResult DynamoDBDataSource::GetMany(
+    ISerializedItemKind const& kind,
+    std::vector<std::string> const& itemKeys) const {
+    GetManyResult::value_type items;
+
+    // BatchGetItem rejects requests containing duplicate keys.
+    std::set<std::string> const unique_keys(itemKeys.begin(), itemKeys.end());
+    std::vector<std::string> const keys(unique_keys.begin(),
+                                        unique_keys.end());
+
+    auto const item_namespace = PrefixedNamespace(prefix_, kind.Namespace());
+
+    for (std::size_t offset = 0; offset < keys.size();
+         offset += kMaxBatchGetKeys) {
+        auto const end = std::min(keys.size(), offset + kMaxBatchGetKeys);
+
+        Aws::DynamoDB::Model::KeysAndAttributes keys_and_attributes;
+        keys_and_attributes.SetConsistentRead(true);
+        for (std::size_t i = offset; i < end; i++) {
+            Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> key;
+            key.emplace(kPartitionKey, Aws::DynamoDB::Model::AttributeValue{
+                                           item_namespace});
+            key.emplace(kSortKey,
+                        Aws::DynamoDB::Model::AttributeValue{keys[i]});
+            keys_and_attributes.AddKeys(std::move(key));
+        }
+
+        Aws::DynamoDB::Model::BatchGetItemRequest request;
+        request.AddRequestItems(table_name_, std::move(keys_and_attributes));
+
+        for (std::size_t attempt = 0;; attempt++) {
+            auto outcome = client_->BatchGetItem(request);
+            if (!outcome.IsSuccess()) {
+                return tl::make_unexpected(
+                    Error{outcome.GetError().GetMessage()});
+            }
+
+            auto const& result = outcome.GetResult();
+            auto const responses = result.GetResponses().find(table_name_);
+            if (responses != result.GetResponses().end()) {
+                for (auto const& row : responses->second) {
+                    auto const key_it = row.find(kSortKey);
+                    if (key_it == row.end()) {
+                        continue;
+                    }
+                    auto const item_it = row.find(kItemAttribute);
+                    if (item_it == row.end()) {
+                        return tl::make_unexpected(Error{
+                            "DynamoDB row missing expected 'item' attribute"});
+                    }
+                    // See note in Get(): a non-String 'item' attribute
+                    // silently produces an empty GetS().
+                    auto const& serialized = item_it->second.GetS();
+                    if (serialized.empty()) {
+                        return tl::make_unexpected(
+                            Error{"DynamoDB 'item' attribute is empty or not "
+                                  "of type S"});
+                    }
+                    items.emplace(
+                        key_it->second.GetS(),
+                        SerializedItemDescriptor::Present(0, serialized));
+                }
+            }
+
+            auto const& unprocessed = result.GetUnprocessedKeys();
+            if (unprocessed.empty()) {
+                break;
+            }
+            if (attempt + 1 >= kMaxBatchGetAttempts) {
+                return tl::make_unexpected(
+                    Error{"DynamoDB BatchGetItem left keys unprocessed"});
+            }
+            std::this_thread::sleep_for(kBatchGetBaseBackoff * (1 << attempt));
+            request.SetRequestItems(unprocessed);
+        }
+    }
+
+    return items;
+}
+
 ISerializedDataReader::AllResult DynamoDBDataSource::All(
     ISerializedItemKind const& kind) const {
     AllResult::value_type items;
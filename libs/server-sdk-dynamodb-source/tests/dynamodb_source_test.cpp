@@ -21,6 +21,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace launchdarkly::server_side::integrations;
 using namespace launchdarkly::data_model;
@@ -420,6 +421,37 @@ TEST_F(DynamoDBTests, AllPaginatesAcrossMultiplePages) {
     ASSERT_EQ(result->size(), kFlagCount);
 }
 
+TEST_F(DynamoDBTests, GetManyFlags) {
+    Flag const foo{"foo", 1, true};
+    Flag const bar{"bar", 2, false};
+    PutFlag(foo);
+    PutFlag(bar);
+
+    auto const result =
+        source->GetMany(FlagKind{}, {"foo", "missing", "bar", "foo"});
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), 2);
+    ASSERT_EQ(result->at("foo").serializedItem,
+              serialize(boost::json::value_from(foo)));
+    ASSERT_EQ(result->at("bar").serializedItem,
+              serialize(boost::json::value_from(bar)));
+}
+
+TEST_F(DynamoDBTests, GetManySpansMultipleBatches) {
+    // BatchGetItem is limited to 100 keys per request.
+    constexpr std::size_t kFlagCount = 150;
+
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < kFlagCount; ++i) {
+        keys.push_back("flag_" + std::to_string(i));
+        PutFlag(Flag{keys.back(), 1, true});
+    }
+
+    auto const result = source->GetMany(FlagKind{}, keys);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), kFlagCount);
+}
+
 TEST_F(DynamoDBTests, GetReturnsErrorWhenRowIsMissingItemAttribute) {
     WithPrefixedClient(prefix_, [&](auto const& client) {
         client.PutRowWithoutItem("features", "foo");
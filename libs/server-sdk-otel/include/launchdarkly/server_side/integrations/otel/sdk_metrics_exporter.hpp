@@ -0,0 +1,102 @@
+/**
+ * @file sdk_metrics_exporter.hpp
+ * @brief Publishes the LaunchDarkly C++ Server SDK's internal metrics through
+ * OpenTelemetry
+ */
+
+#pragma once
+
+#include <launchdarkly/server_side/client.hpp>
+
+#include <opentelemetry/metrics/async_instruments.h>
+#include <opentelemetry/metrics/observer_result.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace launchdarkly::server_side::integrations::otel {
+
+/**
+ * @brief Publishes a client's internal metrics (see IClient::Metrics) as
+ * OpenTelemetry observable instruments on the global meter provider.
+ *
+ * Each counter and gauge becomes an instrument of the same name, prefixed
+ * with "launchdarkly.sdk.". Since OpenTelemetry has no observable histogram,
+ * each histogram becomes instruments suffixed ".count", ".sum", ".max",
+ * ".p50" and ".p99".
+ *
+ * The metrics are only read when the meter provider collects them. The
+ * instruments of one collection share a single read of the client's metrics.
+ *
+ * Construct the exporter after configuring the global meter provider, and
+ * destroy it before the client.
+ */
+class SdkMetricsExporter {
+   public:
+    /**
+     * @brief Registers an instrument for every metric the client has. The
+     * client registers all the metrics of its configuration when it is
+     * constructed, so none is missed by registering them once here.
+     * @param client The client whose metrics are published. Must outlive the
+     * exporter.
+     */
+    explicit SdkMetricsExporter(IClient const& client);
+
+    /**
+     * @brief Unregisters the instruments' callbacks.
+     */
+    ~SdkMetricsExporter();
+
+    SdkMetricsExporter(SdkMetricsExporter const&) = delete;
+    SdkMetricsExporter(SdkMetricsExporter&&) = delete;
+    SdkMetricsExporter& operator=(SdkMetricsExporter const&) = delete;
+    SdkMetricsExporter& operator=(SdkMetricsExporter&&) = delete;
+
+   private:
+    // What an instrument reports about one of the client's metrics.
+    enum class Reading {
+        kCounter,
+        kGauge,
+        kHistogramCount,
+        kHistogramSum,
+        kHistogramMax,
+        kHistogramP50,
+        kHistogramP99,
+    };
+
+    // State passed to an instrument's callback.
+    struct Observation {
+        SdkMetricsExporter* exporter;
+        std::string metric;
+        Reading reading;
+        opentelemetry::nostd::shared_ptr<
+            opentelemetry::metrics::ObservableInstrument>
+            instrument;
+    };
+
+    static void Observe(opentelemetry::metrics::ObserverResult result,
+                        void* state);
+
+    void AddInstrument(
+        opentelemetry::nostd::shared_ptr<
+            opentelemetry::metrics::ObservableInstrument> instrument,
+        std::string metric,
+        Reading reading);
+
+    // Returns the client's metrics, reading them again only if the last read
+    // is too old to belong to the current collection.
+    std::shared_ptr<metrics::MetricsSnapshot const> Snapshot();
+
+    IClient const& client_;
+
+    std::vector<std::unique_ptr<Observation>> observations_;
+
+    std::mutex snapshot_mutex_;
+    std::shared_ptr<metrics::MetricsSnapshot const> snapshot_;
+    std::chrono::steady_clock::time_point snapshot_time_;
+};
+
+}  // namespace launchdarkly::server_side::integrations::otel
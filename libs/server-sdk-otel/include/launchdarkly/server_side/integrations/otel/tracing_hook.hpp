@@ -13,10 +13,13 @@
 
 #include <launchdarkly/server_side/hooks/hook.hpp>
 
+#include <opentelemetry/metrics/sync_instruments.h>
 #include <opentelemetry/trace/provider.h>
 #include <opentelemetry/trace/span.h>
 #include <opentelemetry/trace/tracer.h>
 
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -53,12 +56,28 @@ class TracingHookOptions {
         return environment_id_;
     }
 
+    /**
+     * @brief Fraction of evaluations which get a span event, or a dedicated
+     * span when those are enabled
+     * @return Sampling rate between 0 and 1
+     */
+    [[nodiscard]] double SamplingRate() const { return sampling_rate_; }
+
+    /**
+     * @brief Whether evaluations are recorded as aggregated metrics instead of
+     * span events
+     * @return true if evaluations are aggregated into metrics
+     */
+    [[nodiscard]] bool AggregateMetrics() const { return aggregate_metrics_; }
+
    private:
     friend class TracingHookOptionsBuilder;
 
     bool include_value_ = false;
     bool create_spans_ = false;
     std::optional<std::string> environment_id_;
+    double sampling_rate_ = 1.0;
+    bool aggregate_metrics_ = false;
 
     TracingHookOptions() = default;
 };
@@ -134,6 +153,54 @@ class TracingHookOptionsBuilder {
         return *this;
     }
 
+    /**
+     * @brief Set the fraction of evaluations to trace
+     *
+     * Each evaluation is independently chosen with this probability. Only
+     * chosen evaluations add a span event, or create a dedicated span when
+     * CreateSpans is enabled. Use this to reduce the volume of telemetry sent
+     * to the collector for frequently evaluated flags. With CreateSpans, the
+     * choice is made before the evaluation and the span event, which is still
+     * added to the caller's active span, follows it.
+     *
+     * Aggregated metrics (see AggregateMetrics) are not sampled; they always
+     * count every evaluation.
+     *
+     * @param sampling_rate Value between 0 and 1 (default: 1, trace every
+     * evaluation). Values outside that range are clamped, and NaN is ignored.
+     * @return Reference to this builder for chaining
+     */
+    TracingHookOptionsBuilder& SamplingRate(double sampling_rate) {
+        if (!std::isnan(sampling_rate)) {
+            options_.sampling_rate_ =
+                sampling_rate < 0.0 ? 0.0
+                                    : (sampling_rate > 1.0 ? 1.0 : sampling_rate);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Set whether to record evaluations as aggregated metrics
+     *
+     * When enabled, evaluations no longer add span events. Instead each one
+     * increments the `feature_flag.evaluations` counter, obtained from the
+     * global OpenTelemetry meter provider, with the `feature_flag.key`,
+     * `feature_flag.provider.name`, `feature_flag.result.variationIndex` and
+     * (if known) `feature_flag.set.id` attributes. The meter provider's
+     * aggregation then yields a per-flag count of evaluations and a histogram
+     * of the variations served, at a fraction of the cost of span events.
+     *
+     * The global meter provider must be set before the hook is constructed.
+     * Dedicated spans (see CreateSpans) are still created if enabled.
+     *
+     * @param aggregate_metrics true to record metrics (default: false)
+     * @return Reference to this builder for chaining
+     */
+    TracingHookOptionsBuilder& AggregateMetrics(bool aggregate_metrics) {
+        options_.aggregate_metrics_ = aggregate_metrics;
+        return *this;
+    }
+
     /**
      * @brief Build the TracingHookOptions
      *
@@ -175,6 +242,19 @@ class TracingHookOptionsBuilder {
  *                   .value();
  * ```
  *
+ * ### High-Volume Usage (Sampling or Metrics)
+ * ```cpp
+ * // Add span events for only 1% of evaluations.
+ * auto sampled = launchdarkly::server_side::integrations::otel::TracingHookOptionsBuilder()
+ *                    .SamplingRate(0.01)
+ *                    .Build();
+ *
+ * // Or, count every evaluation in a metric instead of adding span events.
+ * auto aggregated = launchdarkly::server_side::integrations::otel::TracingHookOptionsBuilder()
+ *                       .AggregateMetrics(true)
+ *                       .Build();
+ * ```
+ *
  * ### Providing a Parent Span via HookContext
  * ```cpp
  * // Get current OpenTelemetry span
@@ -261,6 +341,16 @@ class TracingHook : public hooks::Hook {
         hooks::EvaluationSeriesContext const& series_context,
         EvaluationDetail<Value> const& detail) const;
 
+    /**
+     * @brief Count an evaluation in the aggregated evaluation metric
+     *
+     * @param series_context Context with flag key
+     * @param detail Evaluation result with variation index
+     */
+    void RecordEvaluationMetric(
+        hooks::EvaluationSeriesContext const& series_context,
+        EvaluationDetail<Value> const& detail) const;
+
     /**
      * @brief Get the environment ID to use in telemetry
      *
@@ -270,8 +360,18 @@ class TracingHook : public hooks::Hook {
     [[nodiscard]] std::optional<std::string> GetEnvironmentId(
         hooks::EvaluationSeriesContext const& series_context) const;
 
+    /**
+     * @brief Decide whether to trace an evaluation, according to the
+     * configured sampling rate
+     * @return true if the evaluation should be traced
+     */
+    [[nodiscard]] bool Sample() const;
+
     TracingHookOptions options_;
     hooks::HookMetadata metadata_;
+    // Only present when aggregating metrics.
+    opentelemetry::nostd::unique_ptr<opentelemetry::metrics::Counter<uint64_t>>
+        evaluation_counter_;
 };
 
 /**
@@ -0,0 +1,151 @@
+/**
+ * @file sdk_metrics_exporter.cpp
+ * @brief Implementation of the OpenTelemetry exporter for the SDK's internal
+ * metrics
+ */
+
+#include <launchdarkly/server_side/integrations/otel/sdk_metrics_exporter.hpp>
+
+#include <opentelemetry/metrics/provider.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace launchdarkly::server_side::integrations::otel {
+
+constexpr auto kInstrumentPrefix = "launchdarkly.sdk.";
+
+// The instruments of one collection are observed in quick succession; a
+// snapshot younger than this is assumed to belong to the current collection.
+constexpr std::chrono::seconds kSnapshotMaxAge{1};
+
+static std::int64_t ToInt64(std::uint64_t const value) {
+    return static_cast<std::int64_t>(std::min<std::uint64_t>(
+        value, std::numeric_limits<std::int64_t>::max()));
+}
+
+SdkMetricsExporter::SdkMetricsExporter(IClient const& client)
+    : client_(client) {
+    auto const meter =
+        opentelemetry::metrics::Provider::GetMeterProvider()->GetMeter(
+            "launchdarkly-cpp-server", Client::Version());
+
+    auto const snapshot = client_.Metrics();
+    for (auto const& [name, value] : snapshot.counters) {
+        AddInstrument(meter->CreateInt64ObservableCounter(kInstrumentPrefix +
+                                                          name),
+                      name, Reading::kCounter);
+    }
+    for (auto const& [name, value] : snapshot.gauges) {
+        AddInstrument(
+            meter->CreateInt64ObservableGauge(kInstrumentPrefix + name), name,
+            Reading::kGauge);
+    }
+    for (auto const& [name, value] : snapshot.histograms) {
+        auto const prefix = kInstrumentPrefix + name;
+        AddInstrument(meter->CreateInt64ObservableCounter(prefix + ".count"),
+                      name, Reading::kHistogramCount);
+        AddInstrument(meter->CreateInt64ObservableCounter(prefix + ".sum"),
+                      name, Reading::kHistogramSum);
+        AddInstrument(meter->CreateInt64ObservableGauge(prefix + ".max"), name,
+                      Reading::kHistogramMax);
+        AddInstrument(meter->CreateInt64ObservableGauge(prefix + ".p50"), name,
+                      Reading::kHistogramP50);
+        AddInstrument(meter->CreateInt64ObservableGauge(prefix + ".p99"), name,
+                      Reading::kHistogramP99);
+    }
+}
+
+SdkMetricsExporter::~SdkMetricsExporter() {
+    for (auto const& observation : observations_) {
+        observation->instrument->RemoveCallback(&SdkMetricsExporter::Observe,
+                                                observation.get());
+    }
+}
+
+void SdkMetricsExporter::AddInstrument(
+    opentelemetry::nostd::shared_ptr<
+        opentelemetry::metrics::ObservableInstrument> instrument,
+    std::string metric,
+    Reading const reading) {
+    if (!instrument) {
+        return;
+    }
+    auto observation = std::make_unique<Observation>(
+        Observation{this, std::move(metric), reading, std::move(instrument)});
+    observation->instrument->AddCallback(&SdkMetricsExporter::Observe,
+                                         observation.get());
+    observations_.push_back(std::move(observation));
+}
+
+std::shared_ptr<metrics::MetricsSnapshot const>
+SdkMetricsExporter::Snapshot() {
+    std::lock_guard lock(snapshot_mutex_);
+    auto const now = std::chrono::steady_clock::now();
+    if (!snapshot_ || now - snapshot_time_ > kSnapshotMaxAge) {
+        snapshot_ =
+            std::make_shared<metrics::MetricsSnapshot const>(client_.Metrics());
+        snapshot_time_ = now;
+    }
+    return snapshot_;
+}
+
+void SdkMetricsExporter::Observe(
+    opentelemetry::metrics::ObserverResult result,
+    void* state) {
+    auto const& observation = *static_cast<Observation const*>(state);
+    auto const snapshot = observation.exporter->Snapshot();
+
+    std::int64_t value = 0;
+    switch (observation.reading) {
+        case Reading::kCounter: {
+            auto const it = snapshot->counters.find(observation.metric);
+            if (it == snapshot->counters.end()) {
+                return;
+            }
+            value = ToInt64(it->second);
+        } break;
+        case Reading::kGauge: {
+            auto const it = snapshot->gauges.find(observation.metric);
+            if (it == snapshot->gauges.end()) {
+                return;
+            }
+            value = it->second;
+        } break;
+        default: {
+            auto const it = snapshot->histograms.find(observation.metric);
+            if (it == snapshot->histograms.end()) {
+                return;
+            }
+            auto const& histogram = it->second;
+            switch (observation.reading) {
+                case Reading::kHistogramCount:
+                    value = ToInt64(histogram.count);
+                    break;
+                case Reading::kHistogramSum:
+                    value = ToInt64(histogram.sum);
+                    break;
+                case Reading::kHistogramMax:
+                    value = ToInt64(histogram.max);
+                    break;
+                case Reading::kHistogramP50:
+                    value = ToInt64(histogram.Percentile(50));
+                    break;
+                default:
+                    value = ToInt64(histogram.Percentile(99));
+                    break;
+            }
+        } break;
+    }
+
+    if (auto const* observer = opentelemetry::nostd::get_if<
+            opentelemetry::nostd::shared_ptr<
+                opentelemetry::metrics::ObserverResultT<std::int64_t>>>(
+            &result)) {
+        (*observer)->Observe(value);
+    }
+}
+
+}  // namespace launchdarkly::server_side::integrations::otel
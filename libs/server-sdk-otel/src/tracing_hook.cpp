@@ -8,16 +8,25 @@
 #include <launchdarkly/context.hpp>
 #include <launchdarkly/data/evaluation_detail.hpp>
 #include <launchdarkly/data/evaluation_reason.hpp>
+#include <launchdarkly/server_side/client.hpp>
 #include <launchdarkly/value.hpp>
 #include <launchdarkly/detail/serialization/json_value.hpp>
 
+#include <opentelemetry/common/key_value_iterable_view.h>
 #include <opentelemetry/context/context.h>
+#include <opentelemetry/metrics/provider.h>
+#include <opentelemetry/nostd/span.h>
 #include <opentelemetry/trace/context.h>
 #include <opentelemetry/trace/span_context.h>
 
 #include <boost/json.hpp>
 
+#include <array>
+#include <random>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace launchdarkly::server_side::integrations::otel {
 // OpenTelemetry semantic convention attribute names
@@ -37,9 +46,18 @@ constexpr auto PROVIDER_NAME = "LaunchDarkly";
 constexpr auto EVENT_NAME = "feature_flag";
 } // namespace otel_attrs
 
+// Instruments recorded when aggregating metrics
+namespace otel_metrics {
+constexpr auto EVALUATIONS = "feature_flag.evaluations";
+constexpr auto EVALUATIONS_DESCRIPTION = "Number of feature flag evaluations";
+constexpr auto EVALUATIONS_UNIT = "{evaluation}";
+} // namespace otel_metrics
+
 // Keys for series data
 namespace series_keys {
 constexpr auto SPAN = "otel.span";
+// Marks a sampled evaluation for which no span was started.
+constexpr auto SAMPLED = "otel.sampled";
 }
 
 // Keys for hook context
@@ -55,6 +73,14 @@ TracingHook::TracingHook(TracingHookOptions options)
     : options_(std::move(options)),
       metadata_("LaunchDarkly OpenTelemetry Tracing Hook") {
     // Options are validated by the builder
+    if (options_.AggregateMetrics()) {
+        const auto meter =
+            opentelemetry::metrics::Provider::GetMeterProvider()->GetMeter(
+                "launchdarkly-cpp-server", Client::Version());
+        evaluation_counter_ = meter->CreateUInt64Counter(
+            otel_metrics::EVALUATIONS, otel_metrics::EVALUATIONS_DESCRIPTION,
+            otel_metrics::EVALUATIONS_UNIT);
+    }
 }
 
 hooks::HookMetadata const& TracingHook::Metadata() const {
@@ -105,11 +131,23 @@ std::optional<std::string> TracingHook::GetEnvironmentId(
     return std::nullopt;
 }
 
+bool TracingHook::Sample() const {
+    const auto rate = options_.SamplingRate();
+    if (rate >= 1.0) {
+        return true;
+    }
+    if (rate <= 0.0) {
+        return false;
+    }
+    thread_local std::minstd_rand engine{std::random_device{}()};
+    return std::uniform_real_distribution<double>(0.0, 1.0)(engine) < rate;
+}
+
 hooks::EvaluationSeriesData TracingHook::BeforeEvaluation(
     hooks::EvaluationSeriesContext const& series_context,
     hooks::EvaluationSeriesData data) {
-    // Only create spans if configured to do so
-    if (!options_.CreateSpans()) {
+    // Only create spans if configured to do so, and for sampled evaluations
+    if (!options_.CreateSpans() || !Sample()) {
         return data;
     }
 
@@ -141,7 +179,10 @@ hooks::EvaluationSeriesData TracingHook::BeforeEvaluation(
         return builder.Build();
     }
 
-    return data;
+    // Record the sampling decision for AfterEvaluation even without a span.
+    return hooks::EvaluationSeriesDataBuilder(data)
+        .Set(series_keys::SAMPLED, Value(true))
+        .Build();
 }
 
 void TracingHook::AddFeatureFlagEvent(
@@ -210,11 +251,53 @@ void TracingHook::AddFeatureFlagEvent(
     span->AddEvent(otel_attrs::EVENT_NAME, attributes);
 }
 
+void TracingHook::RecordEvaluationMetric(
+    hooks::EvaluationSeriesContext const& series_context,
+    EvaluationDetail<Value> const& detail) const {
+    // The attributes only need to live for the duration of the call, so they
+    // view the strings rather than copying them.
+    const auto to_attribute = [](std::string_view const str) {
+        return opentelemetry::nostd::string_view(str.data(), str.size());
+    };
+
+    using Attribute = std::pair<opentelemetry::nostd::string_view,
+                                opentelemetry::common::AttributeValue>;
+
+    // At most four attributes are recorded, so they are kept on the stack.
+    std::array<Attribute, 4> attributes;
+    std::size_t count = 0;
+
+    attributes[count++] = {otel_attrs::FEATURE_FLAG_KEY,
+                           to_attribute(series_context.FlagKey())};
+    attributes[count++] = {otel_attrs::FEATURE_FLAG_PROVIDER_NAME,
+                           otel_attrs::PROVIDER_NAME};
+
+    if (options_.EnvironmentId().has_value()) {
+        attributes[count++] = {otel_attrs::FEATURE_FLAG_SET_ID,
+                               to_attribute(*options_.EnvironmentId())};
+    } else if (const auto env_id = series_context.EnvironmentId();
+               env_id.has_value()) {
+        attributes[count++] = {otel_attrs::FEATURE_FLAG_SET_ID,
+                               to_attribute(*env_id)};
+    }
+
+    if (const auto variation_index = detail.VariationIndex();
+        variation_index.has_value()) {
+        attributes[count++] = {otel_attrs::FEATURE_FLAG_RESULT_VARIATION_INDEX,
+                               static_cast<int64_t>(*variation_index)};
+    }
+
+    evaluation_counter_->Add(
+        1, opentelemetry::nostd::span<Attribute const>(attributes.data(),
+                                                       count));
+}
+
 hooks::EvaluationSeriesData TracingHook::AfterEvaluation(
     hooks::EvaluationSeriesContext const& series_context,
     hooks::EvaluationSeriesData data,
     EvaluationDetail<Value> const& detail) {
     // First, end any span we created in BeforeEvaluation
+    bool span_created = false;
     if (options_.CreateSpans()) {
         if (const auto maybe_span_any = data.GetShared(series_keys::SPAN);
             maybe_span_any.has_value()) {
@@ -224,15 +307,38 @@ hooks::EvaluationSeriesData TracingHook::AfterEvaluation(
                     opentelemetry::trace::Span>>(&span_any);
             if (span_ptr && *span_ptr) {
                 (*span_ptr)->End();
+                span_created = true;
             }
         }
     }
 
+    // Aggregated metrics replace span events, and count every evaluation
+    if (options_.AggregateMetrics()) {
+        RecordEvaluationMetric(series_context, detail);
+        return data;
+    }
+
+    // When creating spans, the evaluation was sampled in BeforeEvaluation,
+    // which recorded the decision in the series data as the span or, if no
+    // span was started, as a marker. If neither is present, for example
+    // because BeforeEvaluation failed, the evaluation is traced only when
+    // every evaluation is, as before sampling existed.
+    bool const sampled = options_.CreateSpans()
+                             ? span_created ||
+                                   data.Has(series_keys::SAMPLED) ||
+                                   options_.SamplingRate() >= 1.0
+                             : Sample();
+    if (!sampled) {
+        return data;
+    }
+
     // Get the active span (either from hook context or global context)
 
-    // Only add event if there's an active span
+    // Only add event if there's an active span which is recording; events
+    // on a span which isn't recording would be discarded.
     if (const auto active_span = GetActiveSpan(series_context.HookCtx());
-        active_span && active_span->GetContext().IsValid()) {
+        active_span && active_span->GetContext().IsValid() &&
+        active_span->IsRecording()) {
         AddFeatureFlagEvent(active_span, series_context, detail);
     }
     return data;
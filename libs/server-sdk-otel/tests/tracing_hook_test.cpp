@@ -5,8 +5,12 @@
 
 #include <gtest/gtest.h>
 
+#include <launchdarkly/context_builder.hpp>
 #include <launchdarkly/server_side/integrations/otel/tracing_hook.hpp>
 
+#include <cmath>
+#include <string>
+
 namespace launchdarkly::server_side::integrations::otel {
 
 // Basic construction tests
@@ -125,6 +129,78 @@ TEST(TracingHookOptionsBuilderTest, BuilderIsReusable) {
     EXPECT_TRUE(options2.EnvironmentId().has_value());
 }
 
+TEST(TracingHookOptionsBuilderTest, SamplingRateDefaultsToOne) {
+    auto options = TracingHookOptionsBuilder().Build();
+
+    EXPECT_EQ(options.SamplingRate(), 1.0);
+    EXPECT_FALSE(options.AggregateMetrics());
+}
+
+TEST(TracingHookOptionsBuilderTest, ClampsSamplingRate) {
+    EXPECT_EQ(TracingHookOptionsBuilder().SamplingRate(0.25).Build().SamplingRate(),
+              0.25);
+    EXPECT_EQ(TracingHookOptionsBuilder().SamplingRate(-1).Build().SamplingRate(),
+              0.0);
+    EXPECT_EQ(TracingHookOptionsBuilder().SamplingRate(2).Build().SamplingRate(),
+              1.0);
+    EXPECT_EQ(TracingHookOptionsBuilder()
+                  .SamplingRate(0.5)
+                  .SamplingRate(std::nan(""))
+                  .Build()
+                  .SamplingRate(),
+              0.5);
+}
+
+TEST(TracingHookOptionsBuilderTest, SetsAggregateMetrics) {
+    auto options = TracingHookOptionsBuilder().AggregateMetrics(true).Build();
+
+    EXPECT_TRUE(options.AggregateMetrics());
+}
+
+// Evaluation stage tests. Without a configured provider these use
+// OpenTelemetry's no-op tracer and meter.
+class TracingHookStageTest : public ::testing::Test {
+   protected:
+    Context context_ = ContextBuilder().Kind("user", "user-key").Build();
+    std::string flag_key_ = "flag-key";
+    std::string method_ = "BoolVariation";
+    Value default_value_ = Value(false);
+    hooks::HookContext hook_context_;
+    hooks::EvaluationSeriesContext series_context_{
+        flag_key_, context_, default_value_, method_, hook_context_,
+        std::nullopt};
+};
+
+TEST_F(TracingHookStageTest, CreatesSpanForSampledEvaluation) {
+    TracingHook hook(
+        TracingHookOptionsBuilder().CreateSpans(true).SamplingRate(1).Build());
+
+    auto data = hook.BeforeEvaluation(series_context_, {});
+
+    EXPECT_TRUE(data.GetShared("otel.span").has_value());
+}
+
+TEST_F(TracingHookStageTest, CreatesNoSpanForUnsampledEvaluation) {
+    TracingHook hook(
+        TracingHookOptionsBuilder().CreateSpans(true).SamplingRate(0).Build());
+
+    auto data = hook.BeforeEvaluation(series_context_, {});
+
+    EXPECT_FALSE(data.Has("otel.span"));
+}
+
+TEST_F(TracingHookStageTest, AggregatesEvaluationWithoutSpanEvent) {
+    TracingHook hook(TracingHookOptionsBuilder().AggregateMetrics(true).Build());
+
+    auto data = hook.BeforeEvaluation(series_context_, {});
+    data = hook.AfterEvaluation(
+        series_context_, data,
+        EvaluationDetail<Value>(Value(true), 1,
+                                EvaluationReason::Fallthrough(false)));
+
+    EXPECT_TRUE(data.Keys().empty());
+}
+
 // Metadata tests
 TEST(TracingHookTest, MetadataNameIsCorrect) {
     TracingHook hook;
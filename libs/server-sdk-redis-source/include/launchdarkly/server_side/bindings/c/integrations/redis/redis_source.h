@@ -107,6 +107,25 @@ LDServerLazyLoadRedisSource_New(char const* uri,
                                 char const* prefix,
                                 struct LDServerLazyLoadRedisResult* out_result);
 
+/**
+ * @brief Creates a new Redis data source which also notifies the SDK of
+ * changes to the data in Redis, so that the SDK can refresh its cache without
+ * waiting for the cache TTL to elapse.
+ *
+ * Changes are detected through messages of the form "<namespace>:<key>" (for
+ * example, "features:my-flag") published to the channel "<prefix>:changes",
+ * and through keyspace notifications for the prefixed "features" and
+ * "segments" hashes, if enabled on the Redis server.
+ *
+ * See @ref LDServerLazyLoadRedisSource_New for the parameters and return
+ * value.
+ */
+LD_EXPORT(bool)
+LDServerLazyLoadRedisSource_NewWithChangeNotifications(
+    char const* uri,
+    char const* prefix,
+    struct LDServerLazyLoadRedisResult* out_result);
+
 /**
  * @brief Frees a Redis data source pointer. Only necessary to call if not
  * passing ownership to SDK configuration.
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace sw::redis {
 class Redis;
@@ -56,6 +57,13 @@ class RedisBigSegmentStore final : public IBigSegmentStore {
 
     [[nodiscard]] GetMembershipResult GetMembership(
         std::string const& context_hash) const noexcept override;
+    /**
+     * @brief Fetches the include and exclude sets of every context in a single
+     * pipelined round trip.
+     */
+    [[nodiscard]] GetMembershipsResult GetMemberships(
+        std::vector<std::string> const& context_hashes) const noexcept override;
+    [[nodiscard]] bool BatchesMemberships() const noexcept override;
     [[nodiscard]] GetMetadataResult GetMetadata() const noexcept override;
 
     ~RedisBigSegmentStore() override;
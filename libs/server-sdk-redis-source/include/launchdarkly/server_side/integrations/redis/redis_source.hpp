@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace sw::redis {
 class Redis;
@@ -25,12 +26,43 @@ namespace launchdarkly::server_side::integrations {
  * can be passed into the SDK's DataSystem configuration via the LazyLoad
  * builder.
  *
+ * The source can optionally notify the SDK of changes to the data in Redis,
+ * so that the SDK refreshes its cache without waiting for the cache TTL to
+ * elapse. See Options::change_notifications.
+ *
  * This implementation is backed by <a
  * href="https://github.com/sewenew/redis-plus-plus">Redis++</a>, a C++ wrapper
  * for the <a href="https://github.com/redis/hiredis">hiredis</a> library.
  */
 class RedisDataSource final : public ISerializedDataReader {
    public:
+    /**
+     * @brief Optional behavior of a RedisDataSource.
+     */
+    struct Options {
+        /**
+         * If true, the source listens for changes to the data in Redis on a
+         * dedicated connection, and notifies the SDK so that it can refresh
+         * the changed items in its cache. Two kinds of notification are
+         * supported:
+         *
+         * - Messages published to the channel "<prefix>:changes", of the form
+         * "<namespace>:<key>" (for example, "features:my-flag"), identify a
+         * single changed item.
+         *
+         * - Keyspace notifications for the "<prefix>:features" and
+         * "<prefix>:segments" hashes indicate that some item of that kind
+         * changed. These require the Redis server's notify-keyspace-events
+         * setting to include keyspace events for hash commands (for example,
+         * "Kh"); Redis doesn't report which hash field changed, so the SDK
+         * treats every cached item of the kind as changed.
+         *
+         * If the connection is lost, it is re-established in the background,
+         * and every cached item is treated as changed.
+         */
+        bool change_notifications = false;
+    };
+
     /**
      * @brief Creates a new RedisDataSource, or returns an error if construction
      * failed.
@@ -50,23 +82,46 @@ class RedisDataSource final : public ISerializedDataReader {
         std::string uri,
         std::string prefix);
 
+    /**
+     * @brief Creates a new RedisDataSource with the given options, or returns
+     * an error if construction failed.
+     *
+     * @param uri Redis URI. See the other overload.
+     * @param prefix Prefix to use when reading SDK data from Redis.
+     * @param options Optional behavior of the source.
+     * @return A RedisDataSource, or an error if construction failed.
+     */
+    static tl::expected<std::unique_ptr<RedisDataSource>, std::string> Create(
+        std::string uri,
+        std::string prefix,
+        Options options);
+
     [[nodiscard]] GetResult Get(ISerializedItemKind const& kind,
                                 std::string const& itemKey) const override;
+    [[nodiscard]] GetManyResult GetMany(
+        ISerializedItemKind const& kind,
+        std::vector<std::string> const& itemKeys) const override;
     [[nodiscard]] AllResult All(ISerializedItemKind const& kind) const override;
     [[nodiscard]] std::string const& Identity() const override;
     [[nodiscard]] bool Initialized() const override;
+    [[nodiscard]] std::unique_ptr<IConnection> SubscribeToChanges(
+        ChangeHandler handler) override;
 
     ~RedisDataSource() override;  // = default
 
    private:
     RedisDataSource(std::unique_ptr<sw::redis::Redis> redis,
-                    std::string prefix);
+                    std::string uri,
+                    std::string prefix,
+                    Options options);
 
     [[nodiscard]] std::string key_for_kind(
         ISerializedItemKind const& kind) const;
 
+    std::string const uri_;
     std::string const prefix_;
     std::string const inited_key_;
+    Options const options_;
     std::unique_ptr<sw::redis::Redis> redis_;
 };
 }  // namespace launchdarkly::server_side::integrations
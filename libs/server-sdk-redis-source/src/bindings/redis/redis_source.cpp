@@ -9,10 +9,10 @@
 
 using namespace launchdarkly::server_side::integrations;
 
-LD_EXPORT(bool)
-LDServerLazyLoadRedisSource_New(char const* uri,
-                                char const* prefix,
-                                LDServerLazyLoadRedisResult* out_result) {
+static bool NewRedisSource(char const* uri,
+                           char const* prefix,
+                           RedisDataSource::Options const options,
+                           LDServerLazyLoadRedisResult* out_result) {
     LD_ASSERT_NOT_NULL(uri);
     LD_ASSERT_NOT_NULL(prefix);
     LD_ASSERT_NOT_NULL(out_result);
@@ -25,7 +25,7 @@ LDServerLazyLoadRedisSource_New(char const* uri,
     // Ensure the source pointer isn't garbage.
     out_result->source = nullptr;
 
-    auto maybe_source = RedisDataSource::Create(uri, prefix);
+    auto maybe_source = RedisDataSource::Create(uri, prefix, options);
     if (!maybe_source) {
         // Avoid heap allocating another string to pass back to the caller;
         // instead, we copy into the buffer and ensure a terminator is present.
@@ -46,6 +46,23 @@ LDServerLazyLoadRedisSource_New(char const* uri,
     return true;
 }
 
+LD_EXPORT(bool)
+LDServerLazyLoadRedisSource_New(char const* uri,
+                                char const* prefix,
+                                LDServerLazyLoadRedisResult* out_result) {
+    return NewRedisSource(uri, prefix, RedisDataSource::Options{}, out_result);
+}
+
+LD_EXPORT(bool)
+LDServerLazyLoadRedisSource_NewWithChangeNotifications(
+    char const* uri,
+    char const* prefix,
+    LDServerLazyLoadRedisResult* out_result) {
+    RedisDataSource::Options options;
+    options.change_notifications = true;
+    return NewRedisSource(uri, prefix, options, out_result);
+}
+
 LD_EXPORT(void)
 LDServerLazyLoadRedisSource_Free(LDServerLazyLoadRedisSource source) {
     delete reinterpret_cast<RedisDataSource*>(source);
@@ -3,8 +3,10 @@
 #include <sw/redis++/redis++.h>
 
 #include <cerrno>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -58,22 +60,47 @@ RedisBigSegmentStore::~RedisBigSegmentStore() = default;
 
 IBigSegmentStore::GetMembershipResult RedisBigSegmentStore::GetMembership(
     std::string const& context_hash) const noexcept {
-    std::string const include_key = include_key_prefix_ + context_hash;
-    std::string const exclude_key = exclude_key_prefix_ + context_hash;
+    auto memberships = GetMemberships({context_hash});
+    if (!memberships) {
+        return tl::make_unexpected(std::move(memberships.error()));
+    }
+    return std::move(memberships->begin()->second);
+}
 
-    std::vector<std::string> included;
-    std::vector<std::string> excluded;
+IBigSegmentStore::GetMembershipsResult RedisBigSegmentStore::GetMemberships(
+    std::vector<std::string> const& context_hashes) const noexcept {
+    std::unordered_map<std::string, Membership> memberships;
 
     try {
-        redis_->smembers(include_key, std::back_inserter(included));
-        redis_->smembers(exclude_key, std::back_inserter(excluded));
+        // Borrow a pooled connection rather than opening a new one for the
+        // pipeline; it is returned when the pipeline is destroyed.
+        auto pipeline = redis_->pipeline(false);
+        for (auto const& context_hash : context_hashes) {
+            pipeline.smembers(include_key_prefix_ + context_hash)
+                .smembers(exclude_key_prefix_ + context_hash);
+        }
+        auto replies = pipeline.exec();
+
+        for (std::size_t i = 0; i < context_hashes.size(); i++) {
+            std::vector<std::string> included;
+            std::vector<std::string> excluded;
+            replies.get(2 * i, std::back_inserter(included));
+            replies.get(2 * i + 1, std::back_inserter(excluded));
+            memberships.emplace(
+                context_hashes[i],
+                Membership::FromSegmentRefs(included, excluded));
+        }
     } catch (sw::redis::Error const& e) {
         return tl::make_unexpected(e.what());
     } catch (std::exception const& e) {
         return tl::make_unexpected(e.what());
     }
 
-    return Membership::FromSegmentRefs(included, excluded);
+    return memberships;
+}
+
+bool RedisBigSegmentStore::BatchesMemberships() const noexcept {
+    return true;
 }
 
 IBigSegmentStore::GetMetadataResult RedisBigSegmentStore::GetMetadata()
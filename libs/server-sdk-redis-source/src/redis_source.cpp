@@ -1,14 +1,188 @@
 #include <launchdarkly/server_side/integrations/redis/redis_source.hpp>
 
+#include <launchdarkly/server_side/integrations/data_reader/kinds.hpp>
+
 #include <sw/redis++/redis++.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace launchdarkly::server_side::integrations {
+
+namespace {
+
+// Bounds how long the listener blocks waiting for a message, and therefore
+// how long disconnecting can take if the wake-up message can't be delivered.
+constexpr auto kListenerSocketTimeout = std::chrono::seconds(1);
+
+// Delay before re-establishing a lost listener connection.
+constexpr auto kListenerRetryDelay = std::chrono::seconds(1);
+
+// Escapes characters which have special meaning in PSUBSCRIBE patterns.
+std::string EscapePattern(std::string const& literal) {
+    std::string escaped;
+    escaped.reserve(literal.size());
+    for (char const c : literal) {
+        if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+/**
+ * Listens for change notifications on a dedicated connection and thread.
+ *
+ * The listener blocks in Subscriber::consume, which returns when a message
+ * arrives or the socket timeout elapses. To stop promptly, Disconnect
+ * publishes an empty message to the change channel, which listeners ignore.
+ */
+class ChangeListener final : public IConnection {
+   public:
+    ChangeListener(std::string const& uri,
+                   std::string const& prefix,
+                   ISerializedDataReader::ChangeHandler handler)
+        : options_(uri),
+          waker_(options_),
+          changes_channel_(prefix + ":changes"),
+          handler_(std::move(handler)),
+          stopping_(false) {
+        options_.socket_timeout = kListenerSocketTimeout;
+        for (std::string const& kind_namespace :
+             {FlagKind().Namespace(), SegmentKind().Namespace()}) {
+            keyspace_patterns_.emplace(
+                "__keyspace@*__:" + EscapePattern(prefix) + ":" +
+                    kind_namespace,
+                kind_namespace);
+        }
+        thread_ = std::thread([this] { Run(); });
+    }
+
+    ~ChangeListener() override { Disconnect(); }
+
+    void Disconnect() override {
+        {
+            std::lock_guard lock(mutex_);
+            if (stopping_) {
+                return;
+            }
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        try {
+            waker_.publish(changes_channel_, "");
+        } catch (sw::redis::Error const&) {
+            // The listener will notice at its next socket timeout.
+        }
+        if (thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        } else if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+   private:
+    void Run() {
+        bool reconnecting = false;
+        while (!Stopping()) {
+            try {
+                sw::redis::Redis redis(options_);
+                auto subscriber = redis.subscriber();
+                subscriber.on_message(
+                    [this](std::string const& channel, std::string const& msg) {
+                        OnMessage(msg);
+                    });
+                subscriber.on_pmessage([this](std::string const& pattern,
+                                              std::string const& channel,
+                                              std::string const& msg) {
+                    if (auto const it = keyspace_patterns_.find(pattern);
+                        it != keyspace_patterns_.end()) {
+                        handler_(it->second, std::nullopt);
+                    }
+                });
+                subscriber.subscribe(changes_channel_);
+                for (auto const& [pattern, kind_namespace] :
+                     keyspace_patterns_) {
+                    subscriber.psubscribe(pattern);
+                }
+
+                if (reconnecting) {
+                    // Changes may have been missed while disconnected.
+                    for (auto const& [pattern, kind_namespace] :
+                         keyspace_patterns_) {
+                        handler_(kind_namespace, std::nullopt);
+                    }
+                }
+                reconnecting = true;
+
+                while (!Stopping()) {
+                    try {
+                        subscriber.consume();
+                    } catch (sw::redis::TimeoutError const&) {
+                        // Nothing was published; check whether to stop.
+                    }
+                }
+            } catch (sw::redis::Error const&) {
+                std::unique_lock lock(mutex_);
+                cv_.wait_for(lock, kListenerRetryDelay,
+                             [this] { return stopping_; });
+            }
+        }
+    }
+
+    void OnMessage(std::string const& msg) const {
+        auto const separator = msg.find(':');
+        if (separator == std::string::npos || separator + 1 == msg.size()) {
+            return;
+        }
+        auto const kind_namespace = msg.substr(0, separator);
+        for (auto const& [pattern, known_namespace] : keyspace_patterns_) {
+            if (kind_namespace == known_namespace) {
+                handler_(kind_namespace, msg.substr(separator + 1));
+                return;
+            }
+        }
+    }
+
+    bool Stopping() {
+        std::lock_guard lock(mutex_);
+        return stopping_;
+    }
+
+    sw::redis::ConnectionOptions options_;
+    sw::redis::Redis waker_;
+    std::string const changes_channel_;
+    // Keyspace notification pattern to the namespace of the hash it matches.
+    std::map<std::string, std::string> keyspace_patterns_;
+    ISerializedDataReader::ChangeHandler const handler_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_;
+    std::thread thread_;
+};
+
+}  // namespace
+
 tl::expected<std::unique_ptr<RedisDataSource>, std::string>
 RedisDataSource::Create(std::string uri, std::string prefix) {
+    return Create(std::move(uri), std::move(prefix), Options{});
+}
+
+tl::expected<std::unique_ptr<RedisDataSource>, std::string>
+RedisDataSource::Create(std::string uri, std::string prefix, Options options) {
     try {
-        return std::unique_ptr<RedisDataSource>(new RedisDataSource(
-            std::make_unique<sw::redis::Redis>(std::move(uri)),
-            std::move(prefix)));
+        auto redis = std::make_unique<sw::redis::Redis>(uri);
+        return std::unique_ptr<RedisDataSource>(
+            new RedisDataSource(std::move(redis), std::move(uri),
+                                std::move(prefix), options));
     } catch (sw::redis::Error const& e) {
         return tl::make_unexpected(e.what());
     }
@@ -22,9 +196,13 @@ std::string RedisDataSource::key_for_kind(
 }
 
 RedisDataSource::RedisDataSource(std::unique_ptr<sw::redis::Redis> redis,
-                                 std::string prefix)
-    : prefix_(std::move(prefix)),
+                                 std::string uri,
+                                 std::string prefix,
+                                 Options options)
+    : uri_(std::move(uri)),
+      prefix_(std::move(prefix)),
       inited_key_(prefix_ + ":$inited"),
+      options_(options),
       redis_(std::move(redis)) {}
 
 ISerializedDataReader::GetResult RedisDataSource::Get(
@@ -41,6 +219,35 @@ ISerializedDataReader::GetResult RedisDataSource::Get(
     }
 }
 
+ISerializedDataReader::GetManyResult RedisDataSource::GetMany(
+    ISerializedItemKind const& kind,
+    std::vector<std::string> const& itemKeys) const {
+    GetManyResult::value_type items;
+    if (itemKeys.empty()) {
+        return items;
+    }
+
+    // A single HMGET fetches every key in one round trip; the reply holds one
+    // entry per requested key, in order, with nil for missing keys.
+    std::vector<sw::redis::OptionalString> values;
+    values.reserve(itemKeys.size());
+
+    try {
+        redis_->hmget(key_for_kind(kind), itemKeys.begin(), itemKeys.end(),
+                      std::back_inserter(values));
+    } catch (sw::redis::Error const& e) {
+        return tl::make_unexpected(Error{e.what()});
+    }
+
+    for (std::size_t i = 0; i < values.size() && i < itemKeys.size(); i++) {
+        if (values[i]) {
+            items.emplace(itemKeys[i], SerializedItemDescriptor::Present(
+                                           0, std::move(*values[i])));
+        }
+    }
+    return items;
+}
+
 ISerializedDataReader::AllResult RedisDataSource::All(
     ISerializedItemKind const& kind) const {
     std::unordered_map<std::string, std::string> raw_items;
@@ -70,4 +277,19 @@ bool RedisDataSource::Initialized() const {
         return false;
     }
 }
+
+std::unique_ptr<IConnection> RedisDataSource::SubscribeToChanges(
+    ChangeHandler handler) {
+    if (!options_.change_notifications) {
+        return nullptr;
+    }
+    try {
+        return std::make_unique<ChangeListener>(uri_, prefix_,
+                                                std::move(handler));
+    } catch (sw::redis::Error const&) {
+        // The URI was already validated when the source was created, so this
+        // is unexpected; the SDK will rely on the cache TTL alone.
+        return nullptr;
+    }
+}
 }  // namespace launchdarkly::server_side::integrations
@@ -20,6 +20,14 @@ TEST(RedisBindings, SourcePointerIsStoredOnSuccessfulCreation) {
     LDServerLazyLoadRedisSource_Free(result.source);
 }
 
+TEST(RedisBindings, SourceWithChangeNotificationsCanBeCreated) {
+    LDServerLazyLoadRedisResult result;
+    ASSERT_TRUE(LDServerLazyLoadRedisSource_NewWithChangeNotifications(
+        "tcp://localhost:1234", "foo", &result));
+    ASSERT_NE(result.source, nullptr);
+    LDServerLazyLoadRedisSource_Free(result.source);
+}
+
 TEST(RedisBindings, ErrorMessageIsPropagatedOnFailure) {
     LDServerLazyLoadRedisResult result;
     ASSERT_FALSE(
@@ -132,6 +132,19 @@ TEST_F(RedisBigSegmentTests, GetMembershipWithEmptyPrefix) {
     ASSERT_EQ(result->CheckMembership("seg1.g1"), true);
 }
 
+TEST_F(RedisBigSegmentTests, GetMembershipsReturnsEveryContext) {
+    AddIncludes("alice", {"seg1.g1"});
+    AddExcludes("bob", {"seg1.g1"});
+
+    auto const result = store_->GetMemberships({"alice", "bob", "nobody"});
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), 3);
+
+    ASSERT_EQ(result->at("alice").CheckMembership("seg1.g1"), true);
+    ASSERT_EQ(result->at("bob").CheckMembership("seg1.g1"), false);
+    ASSERT_FALSE(result->at("nobody").CheckMembership("seg1.g1").has_value());
+}
+
 TEST_F(RedisBigSegmentTests, GetMetadataWithEmptyPrefix) {
     auto maybe_store = RedisBigSegmentStore::Create(uri_, "");
     ASSERT_TRUE(maybe_store) << maybe_store.error();
@@ -172,5 +185,6 @@ TEST(RedisBigSegmentStoreErrors, GetReturnsErrorOnUnreachableServer) {
 
     auto const store = std::move(*maybe_store);
     ASSERT_FALSE(store->GetMembership("anyone"));
+    ASSERT_FALSE(store->GetMemberships({"anyone", "someone"}));
     ASSERT_FALSE(store->GetMetadata());
 }
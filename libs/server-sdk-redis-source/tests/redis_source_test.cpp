@@ -13,7 +13,15 @@
 
 #include <boost/json.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 using namespace launchdarkly::server_side::integrations;
 using namespace launchdarkly::data_model;
@@ -188,6 +196,27 @@ TEST_F(RedisTests, GetSegmentDoesNotFindFlag) {
     ASSERT_FALSE(*result);
 }
 
+TEST_F(RedisTests, GetManyFlags) {
+    Flag const foo{"foo", 1, true};
+    Flag const bar{"bar", 2, false};
+    PutFlag(foo);
+    PutFlag(bar);
+
+    auto const result = source->GetMany(FlagKind{}, {"foo", "missing", "bar"});
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), 2);
+    ASSERT_EQ(result->at("foo").serializedItem,
+              serialize(boost::json::value_from(foo)));
+    ASSERT_EQ(result->at("bar").serializedItem,
+              serialize(boost::json::value_from(bar)));
+}
+
+TEST_F(RedisTests, GetManyWithNoKeys) {
+    auto const result = source->GetMany(FlagKind{}, {});
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(result->empty());
+}
+
 TEST_F(RedisTests, GetAllSegmentsWhenEmpty) {
     auto const result = source->All(SegmentKind{});
     ASSERT_TRUE(result);
@@ -396,6 +425,95 @@ TEST_F(RedisTests, CanUseAsSDKLazyLoadDataSource) {
     ASSERT_EQ(all_flags.Values(), expected);
 }
 
+// Records change notifications, which arrive on the source's listener thread.
+class RecordingChangeHandler {
+   public:
+    using Change = std::pair<std::string, std::optional<std::string>>;
+
+    ISerializedDataReader::ChangeHandler Handler() {
+        return [this](std::string const& kind_namespace,
+                      std::optional<std::string> const& item_key) {
+            std::lock_guard lock(mutex_);
+            changes_.emplace_back(kind_namespace, item_key);
+            cv_.notify_all();
+        };
+    }
+
+    // The listener subscribes asynchronously, so the trigger is repeated
+    // until the expected change is received.
+    bool WaitFor(Change const& expected, std::function<void()> const& trigger) {
+        auto const deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            trigger();
+            std::unique_lock lock(mutex_);
+            if (cv_.wait_for(lock, std::chrono::milliseconds(100), [&] {
+                    return std::find(changes_.begin(), changes_.end(),
+                                     expected) != changes_.end();
+                })) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Change> changes_;
+};
+
+TEST_F(RedisTests, ChangeNotificationsAreDisabledByDefault) {
+    RecordingChangeHandler changes;
+    ASSERT_FALSE(source->SubscribeToChanges(changes.Handler()));
+}
+
+TEST_F(RedisTests, PublishedChangeIdentifiesItem) {
+    RedisDataSource::Options options;
+    options.change_notifications = true;
+    auto maybe_source =
+        RedisDataSource::Create("tcp://localhost:6379", "testprefix", options);
+    ASSERT_TRUE(maybe_source);
+
+    RecordingChangeHandler changes;
+    auto const connection =
+        (*maybe_source)->SubscribeToChanges(changes.Handler());
+    ASSERT_TRUE(connection);
+
+    sw::redis::Redis publisher("tcp://localhost:6379");
+    ASSERT_TRUE(changes.WaitFor({"features", "foo"}, [&] {
+        publisher.publish("testprefix:changes", "features:foo");
+    }));
+    ASSERT_TRUE(changes.WaitFor({"segments", "bar:baz"}, [&] {
+        publisher.publish("testprefix:changes", "segments:bar:baz");
+    }));
+
+    connection->Disconnect();
+}
+
+TEST_F(RedisTests, KeyspaceNotificationIdentifiesKind) {
+    sw::redis::Redis admin("tcp://localhost:6379");
+    admin.command("CONFIG", "SET", "notify-keyspace-events", "Kh");
+
+    RedisDataSource::Options options;
+    options.change_notifications = true;
+    auto maybe_source =
+        RedisDataSource::Create("tcp://localhost:6379", "testprefix", options);
+    ASSERT_TRUE(maybe_source);
+
+    RecordingChangeHandler changes;
+    auto const connection =
+        (*maybe_source)->SubscribeToChanges(changes.Handler());
+    ASSERT_TRUE(connection);
+
+    bool const notified = changes.WaitFor(
+        {"features", std::nullopt}, [&] { PutFlag(Flag{"foo", 1, true}); });
+
+    connection->Disconnect();
+    admin.command("CONFIG", "SET", "notify-keyspace-events", "");
+    ASSERT_TRUE(notified);
+}
+
 TEST(RedisErrorTests, InvalidURIs) {
     std::vector<std::string> const uris = {"nope, not a redis URI",
                                            "http://foo",
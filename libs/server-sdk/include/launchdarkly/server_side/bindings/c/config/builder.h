@@ -103,6 +103,19 @@ LDServerConfigBuilder_AppInfo_Version(LDServerConfigBuilder b,
 LD_EXPORT(void)
 LDServerConfigBuilder_Offline(LDServerConfigBuilder b, bool offline);
 
+/**
+ * Sets the number of threads which run the SDK's background work: receiving
+ * and applying flag data, delivering analytics events, and polling the Big
+ * Segments store. The default is 1. Values less than 1 are treated as 1.
+ *
+ * With more than one thread, each component's work remains ordered, but
+ * different components may run in parallel.
+ * @param b Server config builder. Must not be NULL.
+ * @param threads Number of background threads.
+ */
+LD_EXPORT(void)
+LDServerConfigBuilder_IoThreads(LDServerConfigBuilder b, size_t threads);
+
 /**
  * Specify if event-sending should be enabled or not. By default,
  * events are enabled.
@@ -30,6 +30,19 @@ enum LDLazyLoadCacheEvictionPolicy {
     LD_LAZYLOAD_CACHE_EVICTION_POLICY_DISABLED = 0
 };
 
+/**
+ * @brief Specifies how a data item within the in-memory cache is refreshed
+ * when it expires.
+ */
+enum LDLazyLoadCacheRefreshPolicy {
+    /* The item is refreshed on the evaluating thread before it is used. This
+     * is the default. */
+    LD_LAZYLOAD_CACHE_REFRESH_POLICY_SYNCHRONOUS = 0,
+    /* The stale item is used immediately and refreshed on a background
+     * thread. */
+    LD_LAZYLOAD_CACHE_REFRESH_POLICY_STALE_WHILE_REVALIDATE = 1
+};
+
 /**
  * Creates a Lazy Load builder which can be used as the SDK's data system.
  *
@@ -91,6 +104,40 @@ LD_EXPORT(void)
 LDServerLazyLoadBuilder_CachePolicy(LDServerLazyLoadBuilder b,
                                     enum LDLazyLoadCacheEvictionPolicy policy);
 
+/**
+ * @brief Specify how data items are refreshed when their TTL expires.
+ * With LD_LAZYLOAD_CACHE_REFRESH_POLICY_STALE_WHILE_REVALIDATE, evaluations
+ * use stale items immediately while they are refreshed in the background.
+ * @param b The builder. Must not be NULL.
+ * @param policy The refresh policy.
+ */
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheRefreshPolicy(
+    LDServerLazyLoadBuilder b,
+    enum LDLazyLoadCacheRefreshPolicy policy);
+
+/**
+ * @brief Bound the number of flags and segments held in the in-memory cache.
+ * When bounded, the most frequently and recently used items are retained and
+ * the rest are evicted, to be loaded from the database again if needed.
+ * @param b The builder. Must not be NULL.
+ * @param max_items Maximum number of items, or 0 for no limit (the default).
+ */
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheMaxItems(LDServerLazyLoadBuilder b,
+                                      size_t max_items);
+
+/**
+ * @brief Bound the approximate memory used by flags and segments held in the
+ * in-memory cache. See LDServerLazyLoadBuilder_CacheMaxItems.
+ * @param b The builder. Must not be NULL.
+ * @param max_bytes Maximum approximate size in bytes, or 0 for no limit (the
+ * default).
+ */
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheMaxBytes(LDServerLazyLoadBuilder b,
+                                      size_t max_bytes);
+
 #ifdef __cplusplus
 }
 #endif
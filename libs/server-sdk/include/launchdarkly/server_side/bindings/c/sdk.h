@@ -729,6 +729,87 @@ LDServerSDK_JsonVariationDetail_WithHookContext(LDServerSDK sdk,
                                                 LDHookContext hook_context,
                                                 LDEvalDetail* out_detail);
 
+/**
+ * The result of evaluating one flag with LDServerSDK_JsonVariationDetails.
+ */
+struct LDServerEvaluationResult {
+    /**
+     * The flag's value, or the default value if the flag could not be
+     * evaluated. Owned by the result; freed by LDServerEvaluationResults_Free.
+     */
+    LDValue Value;
+    /**
+     * The index of the returned variation, or -1 if the default value was
+     * returned.
+     */
+    int VariationIndex;
+    /**
+     * The kind of reason the value was returned.
+     */
+    enum LDEvalReason_Kind ReasonKind;
+    /**
+     * The kind of error. Only meaningful if ReasonKind is LD_EVALREASON_ERROR;
+     * otherwise its value is unspecified.
+     */
+    enum LDEvalReason_ErrorKind ErrorKind;
+};
+
+/**
+ * Evaluates several flags for the same context in one call, with the same
+ * results and analytics events as calling LDServerSDK_JsonVariationDetail for
+ * each of them.
+ *
+ * This is intended for language bindings, where each call into the SDK has a
+ * fixed cost: only one call crosses the language boundary. Checks that depend
+ * only on the context are made once for the whole batch, and the context's Big
+ * Segment memberships are looked up at most once; each flag is otherwise
+ * evaluated as by LDServerSDK_JsonVariationDetail.
+ *
+ * @code
+ * char const* keys[] = {"flag-a", "flag-b"};
+ * LDValue defaults[] = {LDValue_NewBool(false), LDValue_NewString("blue")};
+ * struct LDServerEvaluationResult results[2];
+ *
+ * LDServerSDK_JsonVariationDetails(sdk, context, keys, defaults, 2, results);
+ *
+ * // Use the results, then:
+ * LDServerEvaluationResults_Free(results, 2);
+ * @endcode
+ *
+ * @param sdk SDK. Must not be NULL.
+ * @param context The context. Ownership is NOT transferred. Must not be NULL.
+ * @param flag_keys Array of count flag keys. Ownership is NOT transferred, and
+ * the keys are not copied. Must not be NULL if count is non-zero, and no key
+ * may be NULL.
+ * @param default_values Array of count default values, one per key. Ownership
+ * is NOT transferred, and the values are only copied into results which
+ * return them. Must not be NULL if count is non-zero, and no value may be
+ * NULL.
+ * @param count The number of flags to evaluate.
+ * @param out_results Caller-allocated array of count results, written in the
+ * same order as flag_keys. Must not be NULL if count is non-zero. The results
+ * must be freed with LDServerEvaluationResults_Free when no longer needed.
+ */
+LD_EXPORT(void)
+LDServerSDK_JsonVariationDetails(LDServerSDK sdk,
+                                 LDContext context,
+                                 char const* const* flag_keys,
+                                 LDValue const* default_values,
+                                 size_t count,
+                                 struct LDServerEvaluationResult* out_results);
+
+/**
+ * Frees the values held by an array of results written by
+ * LDServerSDK_JsonVariationDetails. The array itself is owned by the caller
+ * and is not freed.
+ *
+ * @param results Array of results. May be NULL if count is zero.
+ * @param count The number of results.
+ */
+LD_EXPORT(void)
+LDServerEvaluationResults_Free(struct LDServerEvaluationResult* results,
+                               size_t count);
+
 /**
  * Evaluates all flags for a context, returning a data structure containing
  * the results and additional flag metadata.
@@ -754,6 +835,58 @@ LDServerSDK_AllFlagsState(LDServerSDK sdk,
                           LDContext context,
                           enum LDAllFlagsState_Options options);
 
+/**
+ * Evaluates all flags for a context and writes the JSON serialization of the
+ * result into a caller-provided buffer, as LDAllFlagsState_SerializeJSON would
+ * for the result of LDServerSDK_AllFlagsState, but without building an
+ * LDAllFlagsState.
+ *
+ * The JSON has the same members as LDAllFlagsState_SerializeJSON produces,
+ * though possibly in a different order.
+ *
+ * The JSON is written into the buffer as it is generated. If the buffer is
+ * too small, it holds only the beginning of the JSON and the function returns
+ * false; call it again with a buffer of at least *out_length + 1 bytes. The
+ * result is not kept between calls, so the retry evaluates the flags again.
+ * If they have changed in the meantime, the retry's JSON differs from the
+ * first call's and may be longer, so retry until the function returns true.
+ * Reusing a buffer sized from earlier calls avoids most retries.
+ *
+ * @code
+ * size_t size = 65536;
+ * char* buffer = malloc(size);
+ * size_t length;
+ * while (!LDServerSDK_AllFlagsStateJSON(sdk, context, LD_ALLFLAGSSTATE_DEFAULT,
+ *                                       buffer, size, &length)) {
+ *     size = length + 1;
+ *     buffer = realloc(buffer, size);
+ * }
+ * // buffer holds length bytes of JSON, followed by a NUL.
+ * @endcode
+ *
+ * This method will not send analytics events back to LaunchDarkly.
+ *
+ * @param sdk SDK. Must not be NULL.
+ * @param context The context against which all flags will be evaluated.
+ * Ownership is NOT transferred. Must not be NULL.
+ * @param options A combination of one or more options. Pass
+ * LD_ALLFLAGSSTATE_DEFAULT for default behavior.
+ * @param buffer Buffer receiving the NUL-terminated JSON. May be NULL if
+ * buffer_size is zero.
+ * @param buffer_size Size of the buffer in bytes.
+ * @param out_length Receives the length of the JSON, excluding the NUL,
+ * whether or not it fit. May be NULL.
+ * @return True if all of the JSON, and a terminating NUL, was written to the
+ * buffer.
+ */
+LD_EXPORT(bool)
+LDServerSDK_AllFlagsStateJSON(LDServerSDK sdk,
+                              LDContext context,
+                              enum LDAllFlagsState_Options options,
+                              char* buffer,
+                              size_t buffer_size,
+                              size_t* out_length);
+
 /**
  * Frees the SDK's resources, shutting down any connections. May block.
  * @param sdk SDK.
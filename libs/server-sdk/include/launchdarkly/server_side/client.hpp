@@ -2,6 +2,7 @@
 
 #include <launchdarkly/context.hpp>
 #include <launchdarkly/data/evaluation_detail.hpp>
+#include <launchdarkly/metrics/metrics_snapshot.hpp>
 #include <launchdarkly/server_side/config/config.hpp>
 #include <launchdarkly/server_side/hooks/hook.hpp>
 #include <launchdarkly/value.hpp>
@@ -11,10 +12,14 @@
 #include <launchdarkly/server_side/data_source_status.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace launchdarkly::server_side {
 /**
@@ -93,6 +98,56 @@ class IClient {
         Context const& context,
         AllFlagsState::Options options = AllFlagsState::Options::Default) = 0;
 
+    /**
+     * Evaluates all flags for a context and writes the JSON serialization of
+     * the resulting AllFlagsState, without building the AllFlagsState.
+     *
+     * The JSON has the same members as serializing the result of
+     * AllFlagsState, though possibly in a different order. This is the
+     * faster way to generate data for bootstrapping the client-side
+     * JavaScript SDK.
+     *
+     * This method will not send analytics events back to LaunchDarkly.
+     *
+     * @param context The context against which all flags will be
+     * evaluated.
+     * @param out Replaced with the JSON. Its capacity is reused, so passing
+     * the same string for successive calls avoids reallocating it.
+     * @param options A combination of one or more options. Omitting this
+     * argument is equivalent to passing AllFlagsState::Options::Default.
+     */
+    virtual void AllFlagsStateJson(
+        Context const& context,
+        std::string& out,
+        AllFlagsState::Options options = AllFlagsState::Options::Default) = 0;
+
+    /**
+     * Evaluates all flags for a context and writes the JSON serialization of
+     * the resulting AllFlagsState into a fixed buffer, as the JSON is
+     * generated, rather than into a string.
+     *
+     * If the JSON doesn't fit, the buffer holds only its beginning. The
+     * result isn't kept, so calling again with a larger buffer evaluates the
+     * flags again. They may have changed meanwhile, so the JSON may differ
+     * from the first call's, including in length.
+     *
+     * This method will not send analytics events back to LaunchDarkly.
+     *
+     * @param context The context against which all flags will be
+     * evaluated.
+     * @param buffer The buffer to write to. May be null if size is zero.
+     * @param size Size of the buffer in bytes.
+     * @param options A combination of one or more options. Omitting this
+     * argument is equivalent to passing AllFlagsState::Options::Default.
+     * @return The length of the JSON, whether or not it fit. If it is less
+     * than size, the buffer holds the whole JSON followed by a NUL.
+     */
+    virtual std::size_t AllFlagsStateJson(
+        Context const& context,
+        char* buffer,
+        std::size_t size,
+        AllFlagsState::Options options = AllFlagsState::Options::Default) = 0;
+
     /**
      * Tracks that the current context performed an event for the given event
      * name, and associates it with a numeric metric value.
@@ -494,6 +549,34 @@ class IClient {
         Value default_value,
         hooks::HookContext const& hook_context) = 0;
 
+    /**
+     * The key and default value of a flag to evaluate with
+     * JsonVariationDetails. Neither is copied, so both must remain valid for
+     * the duration of the call.
+     */
+    using FlagKeyAndDefault = std::pair<std::string_view, Value const*>;
+
+    /**
+     * Evaluates several flags for the same context, with the same results and
+     * analytics events as calling JsonVariationDetail for each of them.
+     *
+     * Checks that depend only on the context, such as whether it is valid,
+     * are made once for the whole batch, and the context's Big Segment
+     * memberships are looked up at most once for all of the flags. Each flag
+     * is otherwise evaluated as by JsonVariationDetail, and each of its
+     * analytics events holds its own copy of the context. This is intended
+     * for bindings that would otherwise cross a language boundary once per
+     * flag.
+     *
+     * @param ctx The context.
+     * @param flags The key and default value of each flag to evaluate. No
+     * default value may be null.
+     * @return One evaluation detail per flag, in the same order as flags.
+     */
+    virtual std::vector<EvaluationDetail<Value>> JsonVariationDetails(
+        Context const& ctx,
+        std::vector<FlagKeyAndDefault> const& flags) = 0;
+
     /**
      * Returns an interface which provides methods for subscribing to data
      * source status.
@@ -509,6 +592,65 @@ class IClient {
      */
     virtual IBigSegmentStoreStatusProvider& BigSegmentStoreStatus() = 0;
 
+    /**
+     * Begins loading a context's Big Segment memberships into the SDK's
+     * membership cache, without waiting for the store.
+     *
+     * Evaluating a flag which references a Big Segment queries the store on
+     * the calling thread if the context's memberships aren't cached. Calling
+     * this early, for example when a request arrives, lets that query overlap
+     * with the application's own work. The memberships of every key in the
+     * context (one per context kind) are queried together on the SDK's
+     * background threads. An evaluation which needs them while the query is
+     * running waits for its result rather than querying again.
+     *
+     * Calling this method is never required for correct evaluation.
+     *
+     * @param context The context whose memberships should be loaded.
+     * @return A future which resolves to true once the memberships are cached,
+     * or to false if the store query failed, the context is invalid, or Big
+     * Segments are not configured.
+     */
+    virtual std::future<bool> PrefetchBigSegments(Context const& context) = 0;
+
+    /**
+     * Returns the current values of the SDK's internal performance metrics.
+     * Recording them is cheap enough to be always on; this method only reads
+     * them, and may be called as often as a metrics exporter requires.
+     *
+     * Counters:
+     * - evaluations: flag evaluations made through the variation methods.
+     * - events.dropped: events dropped because the event queue was full.
+     * - big_segments.cache_hits, big_segments.cache_misses: Big Segment
+     * membership lookups answered by, or missing from, the membership cache.
+     * - data_source.stream_reconnects: times the streaming connection was
+     * restarted.
+     * - lazy_load.cache_hits, lazy_load.cache_misses: Lazy Load lookups of
+     * individual flags and segments which found them cached, or not.
+     * - lazy_load.refreshes: reads of the Lazy Load source made to load or
+     * refresh items; concurrent refreshes of the same item are read once.
+     *
+     * Gauges:
+     * - events.inbox_depth: events waiting to be processed.
+     *
+     * Histograms:
+     * - evaluation.duration_ns: the duration of a sample of the evaluations
+     * made through the variation methods, including any hooks.
+     * - store.lock_wait_ns: how long reads and writes of the in-memory store
+     * waited for one another, recorded only for those which had to wait.
+     * - events.payload_bytes: the size of each event payload sent.
+     * - events.delivery_duration_ns: how long each event payload took to
+     * deliver, including a retry.
+     *
+     * A metric is present from the client's construction if the component
+     * recording it is configured, even if that component is only created
+     * later, and absent otherwise; for example, there are no Big Segment
+     * metrics unless Big Segments are configured.
+     *
+     * @return The value of every metric.
+     */
+    [[nodiscard]] virtual metrics::MetricsSnapshot Metrics() const = 0;
+
     virtual ~IClient() = default;
     IClient(IClient const& item) = delete;
     IClient(IClient&& item) = delete;
@@ -533,6 +675,17 @@ class Client : public IClient {
         enum AllFlagsState::Options options =
             AllFlagsState::Options::Default) override;
 
+    void AllFlagsStateJson(Context const& context,
+                           std::string& out,
+                           enum AllFlagsState::Options options =
+                               AllFlagsState::Options::Default) override;
+
+    std::size_t AllFlagsStateJson(Context const& context,
+                                  char* buffer,
+                                  std::size_t size,
+                                  enum AllFlagsState::Options options =
+                                      AllFlagsState::Options::Default) override;
+
     void Track(Context const& ctx,
                std::string event_name,
                Value data,
@@ -659,10 +812,18 @@ class Client : public IClient {
         Value default_value,
         hooks::HookContext const& hook_context) override;
 
+    std::vector<EvaluationDetail<Value>> JsonVariationDetails(
+        Context const& ctx,
+        std::vector<FlagKeyAndDefault> const& flags) override;
+
     IDataSourceStatusProvider& DataSourceStatus() override;
 
     IBigSegmentStoreStatusProvider& BigSegmentStoreStatus() override;
 
+    std::future<bool> PrefetchBigSegments(Context const& context) override;
+
+    [[nodiscard]] metrics::MetricsSnapshot Metrics() const override;
+
     /**
      * Returns the version of the SDK.
      * @return String representing version of the SDK.
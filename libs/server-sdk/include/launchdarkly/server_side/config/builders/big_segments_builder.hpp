@@ -34,9 +34,9 @@ class BigSegmentsBuilder {
      * @brief Sets the maximum number of context membership lookups cached
      * by the SDK. Defaults to 1000.
      *
-     * To reduce store traffic, the SDK maintains an LRU cache keyed by
-     * context key. A higher value reduces store queries for
-     * recently-referenced contexts at the cost of memory.
+     * To reduce store traffic, the SDK maintains an approximately
+     * least-recently-used cache keyed by context key. A higher value reduces
+     * store queries for recently-referenced contexts at the cost of memory.
      */
     BigSegmentsBuilder& ContextCacheSize(std::size_t size);
 
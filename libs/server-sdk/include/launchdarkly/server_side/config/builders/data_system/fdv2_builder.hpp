@@ -36,6 +36,21 @@ class FDv2Builder {
         std::optional<std::string> base_url_override_;
     };
 
+    class LocalSnapshot {
+       public:
+        /**
+         * @param path File in which the snapshot is stored. Its directory
+         *     must exist and be writable.
+         */
+        explicit LocalSnapshot(std::string path);
+        LocalSnapshot& WriteInterval(std::chrono::milliseconds interval);
+        [[nodiscard]] built::FDv2Config::SnapshotConfig Build() const;
+
+       private:
+        std::string path_;
+        std::chrono::milliseconds write_interval_{30000};
+    };
+
     /**
      * @return A builder pre-populated with the spec-recommended initializers,
      *     synchronizers, and FDv1 fallback. Equivalent to calling
@@ -57,6 +72,20 @@ class FDv2Builder {
      */
     FDv2Builder& Initializer(Polling source);
 
+    /**
+     * @brief Persists the SDK's flag data to a local snapshot file, and loads
+     * it on startup before any other initializer runs.
+     *
+     * The snapshot is rewritten at most once per write interval while the
+     * data is changing. On the next start the SDK serves evaluations from
+     * the snapshot immediately, and the synchronizers then request only the
+     * changes made since the snapshot was written. A missing or corrupt
+     * snapshot is ignored, and the remaining initializers run as usual.
+     * @param source Snapshot configuration.
+     * @return Reference to this.
+     */
+    FDv2Builder& Snapshot(LocalSnapshot source);
+
     /**
      * @brief Appends a streaming synchronizer to the synchronizers list.
      * Order in the list determines preference: the first entry is the
@@ -6,6 +6,7 @@
 #include <launchdarkly/error.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace launchdarkly::server_side::config::builders {
@@ -27,6 +28,7 @@ namespace launchdarkly::server_side::config::builders {
 struct LazyLoadBuilder {
     using SourcePtr = std::shared_ptr<integrations::ISerializedDataReader>;
     using EvictionPolicy = built::LazyLoadConfig::EvictionPolicy;
+    using RefreshPolicy = built::LazyLoadConfig::RefreshPolicy;
     /**
      * @brief Constructs a new LazyLoadBuilder.
      */
@@ -58,6 +60,51 @@ struct LazyLoadBuilder {
      */
     LazyLoadBuilder& CacheEviction(EvictionPolicy policy);
 
+    /**
+     * @brief Specify how data items are refreshed when their TTL expires.
+     *
+     * With RefreshPolicy::Synchronous (the default), the evaluation which
+     * encounters a stale item waits for it to be refreshed from the database.
+     *
+     * With RefreshPolicy::StaleWhileRevalidate, the stale item is used
+     * immediately and refreshed in the background, so evaluations never wait
+     * on the database for items that are already cached. Items that have
+     * never been cached are still fetched synchronously.
+     * @param policy The RefreshPolicy.
+     * @return Reference to this.
+     */
+    LazyLoadBuilder& CacheRefreshPolicy(RefreshPolicy policy);
+
+    /**
+     * @brief Bound the number of flags and segments held in-memory.
+     *
+     * By default the cache is unbounded: once loaded, an item stays in memory
+     * for the lifetime of the SDK. This is undesirable for large environments
+     * of which each application only evaluates a small part, especially if
+     * AllFlags is used.
+     *
+     * When bounded, the cache retains the items which are used most
+     * frequently and recently (using the W-TinyLFU policy), and evicts the
+     * rest. Evicted items are loaded from the database again if needed.
+     * Items which remain in the cache are refreshed according to the TTL as
+     * usual.
+     *
+     * @param max_items Maximum number of items, or 0 for no limit (the
+     * default).
+     * @return Reference to this.
+     */
+    LazyLoadBuilder& CacheMaxItems(std::size_t max_items);
+
+    /**
+     * @brief Bound the approximate memory used by flags and segments held
+     * in-memory. See @ref CacheMaxItems.
+     *
+     * @param max_bytes Maximum approximate size in bytes, or 0 for no limit
+     * (the default).
+     * @return Reference to this.
+     */
+    LazyLoadBuilder& CacheMaxBytes(std::size_t max_bytes);
+
     [[nodiscard]] tl::expected<built::LazyLoadConfig, Error> Build() const;
 
    private:
@@ -34,6 +34,17 @@ struct FDv2Config {
         }
     };
 
+    struct SnapshotConfig {
+        std::string path;
+        std::chrono::milliseconds write_interval;
+
+        friend bool operator==(SnapshotConfig const& lhs,
+                               SnapshotConfig const& rhs) {
+            return lhs.path == rhs.path &&
+                   lhs.write_interval == rhs.write_interval;
+        }
+    };
+
     using FDv1StreamingConfig =
         launchdarkly::config::shared::built::StreamingConfig<
             launchdarkly::config::shared::ServerSDK>;
@@ -47,6 +58,7 @@ struct FDv2Config {
         fdv1_fallback;
     std::chrono::milliseconds fallback_timeout;
     std::chrono::milliseconds recovery_timeout;
+    std::optional<SnapshotConfig> snapshot;
 };
 
 }  // namespace launchdarkly::server_side::config::built
@@ -3,6 +3,7 @@
 #include <launchdarkly/server_side/integrations/data_reader/iserialized_data_reader.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace launchdarkly::server_side::config::built {
@@ -20,8 +21,29 @@ struct LazyLoadConfig {
         Disabled = 0
     };
 
+    /**
+     * \brief Specifies how a data item is refreshed once its TTL expires.
+     *
+     * The values must not be changed to ensure backwards compatibility
+     * with the C API.
+     */
+    enum class RefreshPolicy {
+        /* The item is refreshed on the evaluating thread before it is
+         * returned. */
+        Synchronous = 0,
+        /* The stale item is returned immediately, and refreshed on a
+         * background thread. Concurrent requests for the same stale item
+         * share a single refresh. */
+        StaleWhileRevalidate = 1
+    };
+
     EvictionPolicy eviction_policy;
     std::chrono::milliseconds refresh_ttl;
     std::shared_ptr<integrations::ISerializedDataReader> source;
+    RefreshPolicy refresh_policy = RefreshPolicy::Synchronous;
+
+    /* Upper bounds on the in-memory cache. Zero means unbounded. */
+    std::size_t cache_max_items = 0;
+    std::size_t cache_max_bytes = 0;
 };
 }  // namespace launchdarkly::server_side::config::built
@@ -5,6 +5,7 @@
 #include <launchdarkly/server_side/config/built/data_system/data_system_config.hpp>
 #include <launchdarkly/server_side/hooks/hook.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -21,7 +22,8 @@ struct Config {
            config::built::DataSystemConfig data_system_config,
            std::optional<config::built::BigSegmentsConfig> big_segments,
            config::built::HttpProperties http_properties,
-           std::vector<std::shared_ptr<hooks::Hook>> hooks);
+           std::vector<std::shared_ptr<hooks::Hook>> hooks,
+           std::size_t io_threads);
 
     [[nodiscard]] std::string const& SdkKey() const;
 
@@ -48,6 +50,12 @@ struct Config {
     [[nodiscard]] std::vector<std::shared_ptr<hooks::Hook>> const& Hooks()
         const;
 
+    /**
+     * The number of threads which run the SDK's background work. Always at
+     * least 1.
+     */
+    [[nodiscard]] std::size_t IoThreads() const;
+
    private:
     std::string sdk_key_;
     bool offline_;
@@ -59,5 +67,6 @@ struct Config {
     std::optional<config::built::BigSegmentsConfig> big_segments_;
     config::built::HttpProperties http_properties_;
     std::vector<std::shared_ptr<hooks::Hook>> hooks_;
+    std::size_t io_threads_;
 };
 }  // namespace launchdarkly::server_side
@@ -4,6 +4,7 @@
 #include <launchdarkly/server_side/config/config.hpp>
 #include <launchdarkly/server_side/hooks/hook.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -88,6 +89,23 @@ class ConfigBuilder {
      */
     ConfigBuilder& Offline(bool offline);
 
+    /**
+     * Sets the number of threads which run the SDK's background work:
+     * receiving and applying flag data, delivering analytics events, and
+     * polling the Big Segments store.
+     *
+     * With the default of one thread, all of this work is serialized, so a
+     * large flag payload or a large event flush delays everything else.
+     * With more than one thread, each component's work remains ordered, but
+     * different components may run in parallel.
+     *
+     * Values less than 1 are treated as 1.
+     *
+     * @param threads Number of background threads.
+     * @return Reference to this.
+     */
+    ConfigBuilder& IoThreads(std::size_t threads);
+
     /**
      * Adds a hook to the SDK configuration.
      *
@@ -105,6 +123,7 @@ class ConfigBuilder {
    private:
     std::string sdk_key_;
     bool offline_;
+    std::size_t io_threads_;
 
     config::builders::EndpointsBuilder service_endpoints_builder_;
     config::builders::AppInfoBuilder app_info_builder_;
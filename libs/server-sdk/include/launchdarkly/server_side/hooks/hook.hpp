@@ -5,11 +5,11 @@
 #include <launchdarkly/value.hpp>
 
 #include <any>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace launchdarkly::server_side::hooks {
@@ -61,7 +61,9 @@ class HookContext {
     [[nodiscard]] bool Has(std::string const& key) const;
 
    private:
-    std::map<std::string, std::shared_ptr<std::any>> data_;
+    // Sorted by key. Callers set few keys, so a flat vector is cheaper to
+    // search and copy than a map.
+    std::vector<std::pair<std::string, std::shared_ptr<std::any>>> data_;
 };
 
 /**
@@ -171,9 +173,14 @@ class EvaluationSeriesData {
         std::optional<std::shared_ptr<std::any>> shared;
     };
 
-    explicit EvaluationSeriesData(std::map<std::string, DataEntry> data);
+    // Sorted by key. A hook typically passes a single entry between its
+    // stages, such as a span, so a flat vector is cheaper than a map. Empty
+    // data, which every before stage starts with, doesn't allocate.
+    using Entries = std::vector<std::pair<std::string, DataEntry>>;
 
-    std::map<std::string, DataEntry> data_;
+    explicit EvaluationSeriesData(Entries data);
+
+    Entries data_;
 };
 
 /**
@@ -227,7 +234,7 @@ class EvaluationSeriesDataBuilder {
     [[nodiscard]] EvaluationSeriesData Build() const;
 
    private:
-    std::map<std::string, EvaluationSeriesData::DataEntry> data_;
+    EvaluationSeriesData::Entries data_;
 };
 
 /**
@@ -238,6 +245,11 @@ class EvaluationSeriesDataBuilder {
  * the execution of a hook stage. Do not store references, pointers, or
  * string_views from this context. If you need any data beyond the stage
  * execution, copy it to owned types (e.g., std::string, Value).
+ *
+ * The context refers to the flag key, evaluation context, default value,
+ * method name and hook context it is constructed with, rather than copying
+ * them; they must outlive it. Constructing it from a temporary for any of
+ * them doesn't compile.
  */
 class EvaluationSeriesContext {
    public:
@@ -250,13 +262,45 @@ class EvaluationSeriesContext {
      * @param hook_context Additional context data provided by the caller.
      * @param environment_id Optional environment ID.
      */
-    EvaluationSeriesContext(std::string flag_key,
+    EvaluationSeriesContext(std::string const& flag_key,
                             Context const& context,
-                            Value default_value,
-                            std::string method,
+                            Value const& default_value,
+                            std::string const& method,
                             HookContext const& hook_context,
                             std::optional<std::string> environment_id);
 
+    // The context would outlive a temporary argument it refers to.
+    EvaluationSeriesContext(std::string&&,
+                            Context const&,
+                            Value const&,
+                            std::string const&,
+                            HookContext const&,
+                            std::optional<std::string>) = delete;
+    EvaluationSeriesContext(std::string const&,
+                            Context&&,
+                            Value const&,
+                            std::string const&,
+                            HookContext const&,
+                            std::optional<std::string>) = delete;
+    EvaluationSeriesContext(std::string const&,
+                            Context const&,
+                            Value&&,
+                            std::string const&,
+                            HookContext const&,
+                            std::optional<std::string>) = delete;
+    EvaluationSeriesContext(std::string const&,
+                            Context const&,
+                            Value const&,
+                            std::string&&,
+                            HookContext const&,
+                            std::optional<std::string>) = delete;
+    EvaluationSeriesContext(std::string const&,
+                            Context const&,
+                            Value const&,
+                            std::string const&,
+                            HookContext&&,
+                            std::optional<std::string>) = delete;
+
     /**
      * Returns the flag key being evaluated.
      *
@@ -329,10 +373,10 @@ class EvaluationSeriesContext {
     [[nodiscard]] HookContext const& HookCtx() const;
 
    private:
-    std::string flag_key_;
+    std::string const& flag_key_;
     Context const& context_;
-    Value default_value_;
-    std::string method_;
+    Value const& default_value_;
+    std::string const& method_;
     HookContext const& hook_context_;
     std::optional<std::string> environment_id_;
 };
@@ -72,6 +72,21 @@ class Membership {
         return it->second;
     }
 
+    /**
+     * @brief Calls a function with each segment ref that has an entry in this
+     * membership.
+     *
+     * @param fn Callable as `fn(std::string const& segment_ref, bool
+     * included)`, where `included` is `true` if the context is included in the
+     * segment and `false` if it is excluded.
+     */
+    template <typename Fn>
+    void ForEachSegmentRef(Fn&& fn) const {
+        for (auto const& [segment_ref, included] : entries_) {
+            fn(segment_ref, included);
+        }
+    }
+
    private:
     explicit Membership(std::unordered_map<std::string, bool> entries)
         : entries_(std::move(entries)) {}
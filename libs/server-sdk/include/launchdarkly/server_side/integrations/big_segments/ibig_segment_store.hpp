@@ -6,6 +6,9 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace launchdarkly::server_side::integrations {
 
@@ -25,8 +28,8 @@ namespace launchdarkly::server_side::integrations {
  * the SDK asks for.
  *
  * The SDK hashes the context key (SHA-256 then base64-encoded) before
- * calling @ref GetMembership, so an implementation only ever sees opaque
- * hashes; raw context keys are never sent to the store.
+ * calling @ref GetMembership or @ref GetMemberships, so an implementation only
+ * ever sees opaque hashes; raw context keys are never sent to the store.
  *
  * Implementations must be thread-safe.
  */
@@ -39,6 +42,8 @@ class IBigSegmentStore {
     IBigSegmentStore& operator=(IBigSegmentStore&&) = delete;
 
     using GetMembershipResult = tl::expected<Membership, std::string>;
+    using GetMembershipsResult =
+        tl::expected<std::unordered_map<std::string, Membership>, std::string>;
     using GetMetadataResult =
         tl::expected<std::optional<StoreMetadata>, std::string>;
 
@@ -56,6 +61,49 @@ class IBigSegmentStore {
     [[nodiscard]] virtual GetMembershipResult GetMembership(
         std::string const& context_hash) const noexcept = 0;
 
+    /**
+     * @brief Looks up the Big Segments memberships for several contexts at
+     * once.
+     *
+     * The SDK calls this when one evaluation needs the memberships of several
+     * context keys, such as for a multi-kind context. Implementations backed
+     * by a network store should override it to fetch every membership in a
+     * single round trip; the default implementation calls @ref GetMembership
+     * for each hash in turn.
+     *
+     * @param context_hashes Base64-encoded SHA-256 hashes of the context
+     * keys.
+     *
+     * @return A map containing a @ref Membership for every requested hash, or
+     * an error if any lookup failed.
+     */
+    [[nodiscard]] virtual GetMembershipsResult GetMemberships(
+        std::vector<std::string> const& context_hashes) const noexcept {
+        std::unordered_map<std::string, Membership> memberships;
+        for (auto const& context_hash : context_hashes) {
+            auto membership = GetMembership(context_hash);
+            if (!membership) {
+                return tl::make_unexpected(std::move(membership.error()));
+            }
+            memberships.emplace(context_hash, std::move(*membership));
+        }
+        return memberships;
+    }
+
+    /**
+     * @brief Reports whether @ref GetMemberships fetches several memberships
+     * for about the cost of one.
+     *
+     * When true, the SDK may request the memberships of context keys that an
+     * evaluation might need later together with the one it needs now. When
+     * false, it requests each membership only when the evaluation reaches it.
+     * Implementations that override @ref GetMemberships with a batched or
+     * pipelined lookup should return true.
+     */
+    [[nodiscard]] virtual bool BatchesMemberships() const noexcept {
+        return false;
+    }
+
     /**
      * @brief Returns store-level metadata used by the SDK to detect staleness.
      *
@@ -3,11 +3,16 @@
 #include <launchdarkly/server_side/integrations/data_reader/iserialized_item_kind.hpp>
 #include <launchdarkly/server_side/integrations/data_reader/serialized_item_descriptor.hpp>
 
+#include <launchdarkly/connection.hpp>
+
 #include <tl/expected.hpp>
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace launchdarkly::server_side::integrations {
 
@@ -47,6 +52,10 @@ class ISerializedDataReader {
         tl::expected<std::unordered_map<std::string, SerializedItemDescriptor>,
                      Error>;
 
+    using GetManyResult =
+        tl::expected<std::unordered_map<std::string, SerializedItemDescriptor>,
+                     Error>;
+
     /**
      * Retrieves an item from the specified collection, if available.
      *
@@ -59,6 +68,35 @@ class ISerializedDataReader {
     [[nodiscard]] virtual GetResult Get(ISerializedItemKind const& kind,
                                         std::string const& itemKey) const = 0;
 
+    /**
+     * Retrieves several items from the specified collection.
+     *
+     * Sources should override this to fetch all of the items in as few round
+     * trips as the underlying database allows. The default implementation
+     * calls Get for each key in turn.
+     *
+     * @param kind The kind of the items.
+     * @param itemKeys The keys of the items.
+     * @return A map containing each item that existed, keyed by item key;
+     * items which did not exist are omitted. Or, an error if any item could
+     * not be retrieved.
+     */
+    [[nodiscard]] virtual GetManyResult GetMany(
+        ISerializedItemKind const& kind,
+        std::vector<std::string> const& itemKeys) const {
+        GetManyResult::value_type items;
+        for (auto const& key : itemKeys) {
+            auto item = Get(kind, key);
+            if (!item) {
+                return tl::make_unexpected(std::move(item.error()));
+            }
+            if (*item) {
+                items.emplace(key, std::move(**item));
+            }
+        }
+        return items;
+    }
+
     /**
      * Retrieves all items from the specified collection.
      *
@@ -85,6 +123,36 @@ class ISerializedDataReader {
      */
     [[nodiscard]] virtual bool Initialized() const = 0;
 
+    /**
+     * Handles a notification that items changed in the underlying store.
+     *
+     * @param kind_namespace The namespace of the changed item's kind (see
+     * ISerializedItemKind::Namespace.)
+     * @param item_key The key of the changed item, or std::nullopt if any
+     * item of the kind may have changed.
+     */
+    using ChangeHandler =
+        std::function<void(std::string const& kind_namespace,
+                           std::optional<std::string> const& item_key)>;
+
+    /**
+     * Subscribes to notifications of changes made to the underlying store by
+     * another process, such as the Relay Proxy. The SDK uses them to refresh
+     * cached items without waiting for their TTL to elapse.
+     *
+     * The handler may be invoked on any thread, but must not be invoked once
+     * the returned connection's Disconnect method has returned.
+     *
+     * @param handler Handler for change notifications.
+     * @return A connection which ends the subscription when disconnected, or
+     * nullptr if the reader doesn't support change notifications. The default
+     * implementation returns nullptr.
+     */
+    [[nodiscard]] virtual std::unique_ptr<IConnection> SubscribeToChanges(
+        ChangeHandler handler) {
+        return nullptr;
+    }
+
    protected:
     ISerializedDataReader() = default;
 };
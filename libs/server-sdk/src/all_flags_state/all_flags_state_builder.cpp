@@ -12,14 +12,10 @@ AllFlagsStateBuilder::AllFlagsStateBuilder(AllFlagsState::Options options)
 void AllFlagsStateBuilder::AddFlag(std::string const& key,
                                    Value value,
                                    AllFlagsState::State flag) {
-    if (IsSet(options_, AllFlagsState::Options::DetailsOnlyForTrackedFlags)) {
-        if (!flag.TrackEvents() && !flag.TrackReason() &&
-            !IsDebuggingEnabled(flag.DebugEventsUntilDate())) {
-            flag.omit_details_ = true;
-        }
+    if (OmitDetails(options_, flag)) {
+        flag.omit_details_ = true;
     }
-    if (NotSet(options_, AllFlagsState::Options::IncludeReasons) &&
-        !flag.TrackReason()) {
+    if (OmitReason(options_, flag)) {
         flag.reason_ = std::nullopt;
     }
     flags_state_.emplace(key, std::move(flag));
@@ -60,6 +56,19 @@ bool NotSet(AllFlagsState::Options options, AllFlagsState::Options flag) {
     return !IsSet(options, flag);
 }
 
+bool OmitDetails(AllFlagsState::Options options,
+                 AllFlagsState::State const& state) {
+    return IsSet(options, AllFlagsState::Options::DetailsOnlyForTrackedFlags) &&
+           !state.TrackEvents() && !state.TrackReason() &&
+           !IsDebuggingEnabled(state.DebugEventsUntilDate());
+}
+
+bool OmitReason(AllFlagsState::Options options,
+                AllFlagsState::State const& state) {
+    return NotSet(options, AllFlagsState::Options::IncludeReasons) &&
+           !state.TrackReason();
+}
+
 std::uint64_t NowUnixMillis() {
     return std::chrono::duration_cast<std::chrono::milliseconds>(
                std::chrono::system_clock::now().time_since_epoch())
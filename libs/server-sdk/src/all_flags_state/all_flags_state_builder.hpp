@@ -12,6 +12,18 @@ namespace launchdarkly::server_side {
 bool IsSet(AllFlagsState::Options options, AllFlagsState::Options flag);
 bool NotSet(AllFlagsState::Options options, AllFlagsState::Options flag);
 
+/**
+ * Whether the options remove a flag's version and reason from its state.
+ */
+bool OmitDetails(AllFlagsState::Options options,
+                 AllFlagsState::State const& state);
+
+/**
+ * Whether the options remove a flag's reason from its state.
+ */
+bool OmitReason(AllFlagsState::Options options,
+                AllFlagsState::State const& state);
+
 class AllFlagsStateBuilder {
    public:
     /**
@@ -0,0 +1,104 @@
+#include "all_flags_state_json_writer.hpp"
+#include "all_flags_state_builder.hpp"
+
+namespace launchdarkly::server_side {
+
+static JsonOutput Replacing(std::string& out) {
+    out.clear();
+    return JsonOutput(out);
+}
+
+AllFlagsStateJsonWriter::AllFlagsStateJsonWriter(
+    AllFlagsState::Options options,
+    std::string& out)
+    : AllFlagsStateJsonWriter(options, Replacing(out)) {}
+
+AllFlagsStateJsonWriter::AllFlagsStateJsonWriter(
+    AllFlagsState::Options options,
+    JsonOutput out)
+    : options_(options), states_(out), values_json_(), values_(values_json_) {
+    states_.BeginObject();
+    states_.Key("$valid");
+    states_.Bool(true);
+    states_.Key("$flagsState");
+    states_.BeginObject();
+}
+
+void AllFlagsStateJsonWriter::AddFlag(std::string const& key,
+                                      Value const& value,
+                                      AllFlagsState::State const& state) {
+    bool const omit_details = OmitDetails(options_, state);
+
+    states_.Key(key);
+    states_.BeginObject();
+    if (!omit_details) {
+        states_.Key("version");
+        states_.Uint(state.Version());
+        if (auto const& reason = state.Reason();
+            reason && !OmitReason(options_, state)) {
+            states_.Key("reason");
+            states_.Write(*reason);
+        }
+    }
+    if (auto const variation = state.Variation()) {
+        states_.Key("variation");
+        states_.Int(*variation);
+    }
+    if (state.TrackEvents()) {
+        states_.Key("trackEvents");
+        states_.Bool(true);
+    }
+    if (state.TrackReason()) {
+        states_.Key("trackReason");
+        states_.Bool(true);
+    }
+    if (auto const& date = state.DebugEventsUntilDate(); date && *date > 0) {
+        states_.Key("debugEventsUntilDate");
+        states_.Uint(*date);
+    }
+    if (auto const& prerequisites = state.Prerequisites();
+        !prerequisites.empty()) {
+        states_.Key("prerequisites");
+        states_.BeginArray();
+        for (auto const& prerequisite : prerequisites) {
+            states_.String(prerequisite);
+        }
+        states_.EndArray();
+    }
+    states_.EndObject();
+
+    values_.Key(key);
+    values_.Write(value);
+}
+
+void AllFlagsStateJsonWriter::Finish() {
+    // Closes $flagsState; the values are members of the outer object.
+    states_.EndObject();
+    if (!values_json_.empty()) {
+        states_.Raw(",");
+        states_.Raw(values_json_);
+    }
+    states_.EndObject();
+}
+
+std::size_t AllFlagsStateJsonWriter::Length() const {
+    return states_.Length();
+}
+
+void AllFlagsStateJsonWriter::WriteInvalid(std::string& out) {
+    WriteInvalid(Replacing(out));
+}
+
+std::size_t AllFlagsStateJsonWriter::WriteInvalid(JsonOutput out) {
+    JsonWriter writer(out);
+    writer.BeginObject();
+    writer.Key("$valid");
+    writer.Bool(false);
+    writer.Key("$flagsState");
+    writer.BeginObject();
+    writer.EndObject();
+    writer.EndObject();
+    return writer.Length();
+}
+
+}  // namespace launchdarkly::server_side
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <launchdarkly/server_side/all_flags_state.hpp>
+
+#include <launchdarkly/serialization/json_writer.hpp>
+#include <launchdarkly/value.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace launchdarkly::server_side {
+
+/**
+ * Writes the JSON serialization of an AllFlagsState (as produced by
+ * json_all_flags_state.hpp) while flags are added, without building the
+ * AllFlagsState or a boost::json DOM.
+ *
+ * The members of the output may be in a different order than boost::json
+ * produces.
+ */
+class AllFlagsStateJsonWriter {
+   public:
+    /**
+     * Constructs a writer for a valid state.
+     * @param options Options affecting the output, as for
+     * AllFlagsStateBuilder.
+     * @param out Replaced with the JSON. Its capacity is reused. Must outlive
+     * the writer.
+     */
+    AllFlagsStateJsonWriter(AllFlagsState::Options options, std::string& out);
+
+    /**
+     * Constructs a writer for a valid state.
+     * @param options Options affecting the output, as for
+     * AllFlagsStateBuilder.
+     * @param out Receives the JSON.
+     */
+    AllFlagsStateJsonWriter(AllFlagsState::Options options, JsonOutput out);
+
+    /**
+     * Adds a flag, including its evaluation result and additional state.
+     * @param key Key of the flag.
+     * @param value Value of the flag.
+     * @param state State of the flag.
+     */
+    void AddFlag(std::string const& key,
+                 Value const& value,
+                 AllFlagsState::State const& state);
+
+    /**
+     * Completes the JSON. This must be called once, after all flags have been
+     * added.
+     */
+    void Finish();
+
+    /**
+     * @return The length of the JSON written so far, including any which
+     * didn't fit a fixed buffer.
+     */
+    [[nodiscard]] std::size_t Length() const;
+
+    /**
+     * Replaces out with the JSON serialization of an invalid state.
+     */
+    static void WriteInvalid(std::string& out);
+
+    /**
+     * Writes the JSON serialization of an invalid state to out.
+     * @return The length of the JSON, including any which didn't fit a fixed
+     * buffer.
+     */
+    static std::size_t WriteInvalid(JsonOutput out);
+
+   private:
+    AllFlagsState::Options options_;
+    JsonWriter states_;
+    // The flag values follow all of the states, so they are held here until
+    // Finish.
+    std::string values_json_;
+    JsonWriter values_;
+};
+
+}  // namespace launchdarkly::server_side
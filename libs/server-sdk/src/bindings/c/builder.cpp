@@ -138,6 +138,13 @@ LDServerConfigBuilder_Offline(LDServerConfigBuilder b, bool const offline) {
     TO_BUILDER(b)->Offline(offline);
 }
 
+LD_EXPORT(void)
+LDServerConfigBuilder_IoThreads(LDServerConfigBuilder b, size_t const threads) {
+    LD_ASSERT_NOT_NULL(b);
+
+    TO_BUILDER(b)->IoThreads(threads);
+}
+
 LD_EXPORT(void)
 LDServerConfigBuilder_Events_Enabled(LDServerConfigBuilder b, bool enabled) {
     LD_ASSERT_NOT_NULL(b);
@@ -338,6 +345,29 @@ LDServerLazyLoadBuilder_CachePolicy(LDServerLazyLoadBuilder b,
         static_cast<DataSystemBuilder::LazyLoad::EvictionPolicy>(policy));
 }
 
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheRefreshPolicy(
+    LDServerLazyLoadBuilder b,
+    LDLazyLoadCacheRefreshPolicy policy) {
+    LD_ASSERT_NOT_NULL(b);
+    TO_LAZYLOAD_BUILDER(b)->CacheRefreshPolicy(
+        static_cast<DataSystemBuilder::LazyLoad::RefreshPolicy>(policy));
+}
+
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheMaxItems(LDServerLazyLoadBuilder b,
+                                      size_t const max_items) {
+    LD_ASSERT_NOT_NULL(b);
+    TO_LAZYLOAD_BUILDER(b)->CacheMaxItems(max_items);
+}
+
+LD_EXPORT(void)
+LDServerLazyLoadBuilder_CacheMaxBytes(LDServerLazyLoadBuilder b,
+                                      size_t const max_bytes) {
+    LD_ASSERT_NOT_NULL(b);
+    TO_LAZYLOAD_BUILDER(b)->CacheMaxBytes(max_bytes);
+}
+
 LD_EXPORT(void)
 LDServerConfigBuilder_HttpProperties_WrapperName(LDServerConfigBuilder b,
                                                  char const* wrapper_name) {
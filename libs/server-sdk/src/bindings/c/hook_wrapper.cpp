@@ -55,7 +55,7 @@ hooks::EvaluationSeriesData CHookWrapper::BeforeEvaluation(
     // This gives the callback ownership that it can return or modify
     const auto c_data_input =
         reinterpret_cast<LDServerSDKEvaluationSeriesData>(
-            new hooks::EvaluationSeriesData(data));
+            new hooks::EvaluationSeriesData(std::move(data)));
 
     // Call the C callback - context stays alive for entire call
     LDServerSDKEvaluationSeriesData result_data =
@@ -99,7 +99,7 @@ hooks::EvaluationSeriesData CHookWrapper::AfterEvaluation(
     // This gives the callback ownership that it can return or modify
     const auto c_data_input =
         reinterpret_cast<LDServerSDKEvaluationSeriesData>(
-            new hooks::EvaluationSeriesData(data));
+            new hooks::EvaluationSeriesData(std::move(data)));
 
     const auto c_detail = AS_EVAL_DETAIL(&detail);
 
@@ -9,6 +9,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <cstring>
+#include <vector>
 
 using namespace launchdarkly::server_side;
 using namespace launchdarkly;
@@ -324,6 +325,67 @@ LDServerSDK_JsonVariationDetail(LDServerSDK sdk,
         })));
 }
 
+LD_EXPORT(void)
+LDServerSDK_JsonVariationDetails(LDServerSDK sdk,
+                                 LDContext context,
+                                 char const* const* flag_keys,
+                                 LDValue const* default_values,
+                                 size_t count,
+                                 struct LDServerEvaluationResult* out_results) {
+    LD_ASSERT_NOT_NULL(sdk);
+    LD_ASSERT_NOT_NULL(context);
+    LD_ASSERT(count == 0 || flag_keys);
+    LD_ASSERT(count == 0 || default_values);
+    LD_ASSERT(count == 0 || out_results);
+
+    // Only pointers are copied; the keys and values stay the caller's.
+    std::vector<Client::FlagKeyAndDefault> flags;
+    flags.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        LD_ASSERT_NOT_NULL(flag_keys[i]);
+        LD_ASSERT(default_values[i]);
+        flags.emplace_back(flag_keys[i], TO_VALUE(default_values[i]));
+    }
+
+    auto const details =
+        TO_SDK(sdk)->JsonVariationDetails(*TO_CONTEXT(context), flags);
+
+    for (size_t i = 0; i < count; i++) {
+        auto const& detail = details[i];
+        auto& result = out_results[i];
+
+        result.Value = FROM_VALUE(new Value(detail.Value()));
+        result.VariationIndex =
+            detail.VariationIndex() ? static_cast<int>(*detail.VariationIndex())
+                                    : -1;
+        // ErrorKind is unspecified unless ReasonKind is an error, so it is
+        // left zeroed rather than suggesting an error which didn't happen.
+        result.ErrorKind = {};
+        auto const& reason = detail.Reason();
+        if (!reason) {
+            result.ReasonKind = LD_EVALREASON_ERROR;
+            result.ErrorKind = LD_EVALREASON_ERROR_EXCEPTION;
+            continue;
+        }
+        result.ReasonKind = static_cast<enum LDEvalReason_Kind>(reason->Kind());
+        if (auto const error_kind = reason->ErrorKind()) {
+            result.ErrorKind =
+                static_cast<enum LDEvalReason_ErrorKind>(*error_kind);
+        }
+    }
+}
+
+LD_EXPORT(void)
+LDServerEvaluationResults_Free(struct LDServerEvaluationResult* results,
+                               size_t count) {
+    LD_ASSERT(count == 0 || results);
+
+    for (size_t i = 0; i < count; i++) {
+        LDValue_Free(results[i].Value);
+        results[i].Value = nullptr;
+    }
+}
+
 LD_EXPORT(LDAllFlagsState)
 LDServerSDK_AllFlagsState(LDServerSDK sdk,
                           LDContext context,
@@ -337,6 +399,27 @@ LDServerSDK_AllFlagsState(LDServerSDK sdk,
     return FROM_ALLFLAGS(new AllFlagsState(std::move(state)));
 }
 
+LD_EXPORT(bool)
+LDServerSDK_AllFlagsStateJSON(LDServerSDK sdk,
+                              LDContext context,
+                              enum LDAllFlagsState_Options options,
+                              char* buffer,
+                              size_t buffer_size,
+                              size_t* out_length) {
+    LD_ASSERT_NOT_NULL(sdk);
+    LD_ASSERT_NOT_NULL(context);
+    LD_ASSERT(buffer_size == 0 || buffer);
+
+    auto const length = TO_SDK(sdk)->AllFlagsStateJson(
+        *TO_CONTEXT(context), buffer, buffer_size,
+        static_cast<AllFlagsState::Options>(options));
+
+    if (out_length) {
+        *out_length = length;
+    }
+    return length < buffer_size;
+}
+
 LD_EXPORT(void) LDServerSDK_Free(LDServerSDK sdk) {
     delete TO_SDK(sdk);
 }
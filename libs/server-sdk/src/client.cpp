@@ -40,6 +40,19 @@ using FlagKey = std::string;
     return client->AllFlagsState(context, options);
 }
 
+void Client::AllFlagsStateJson(Context const& context,
+                               std::string& out,
+                               enum AllFlagsState::Options options) {
+    client->AllFlagsStateJson(context, out, options);
+}
+
+std::size_t Client::AllFlagsStateJson(Context const& context,
+                                      char* buffer,
+                                      std::size_t size,
+                                      enum AllFlagsState::Options options) {
+    return client->AllFlagsStateJson(context, buffer, size, options);
+}
+
 void Client::Track(Context const& ctx,
                    std::string event_name,
                    Value data,
@@ -225,6 +238,12 @@ EvaluationDetail<Value> Client::JsonVariationDetail(
                                        hook_context);
 }
 
+std::vector<EvaluationDetail<Value>> Client::JsonVariationDetails(
+    Context const& ctx,
+    std::vector<FlagKeyAndDefault> const& flags) {
+    return client->JsonVariationDetails(ctx, flags);
+}
+
 IDataSourceStatusProvider& Client::DataSourceStatus() {
     return client->DataSourceStatus();
 }
@@ -233,6 +252,14 @@ IBigSegmentStoreStatusProvider& Client::BigSegmentStoreStatus() {
     return client->BigSegmentStoreStatus();
 }
 
+std::future<bool> Client::PrefetchBigSegments(Context const& context) {
+    return client->PrefetchBigSegments(context);
+}
+
+metrics::MetricsSnapshot Client::Metrics() const {
+    return client->Metrics();
+}
+
 char const* Client::Version() {
     return kVersion;
 }
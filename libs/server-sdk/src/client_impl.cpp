@@ -1,6 +1,7 @@
 #include "client_impl.hpp"
 
 #include "all_flags_state/all_flags_state_builder.hpp"
+#include "all_flags_state/all_flags_state_json_writer.hpp"
 #include "data_systems/background_sync/background_sync_system.hpp"
 #include "data_systems/fdv2/conditions.hpp"
 #include "data_systems/fdv2/fdv2_data_system.hpp"
@@ -18,29 +19,47 @@
 #include <launchdarkly/encoding/sha_256.hpp>
 #include <launchdarkly/events/asio_event_processor.hpp>
 #include <launchdarkly/events/data/common_events.hpp>
+#include <launchdarkly/logging/async_backend.hpp>
 #include <launchdarkly/logging/console_backend.hpp>
 #include <launchdarkly/logging/null_logger.hpp>
 
 #include <launchdarkly/server_side/config/builders/all_builders.hpp>
 #include <launchdarkly/server_side/config/built/all_built.hpp>
 
+#include <boost/asio/strand.hpp>
+
 #include <chrono>
 #include <optional>
 #include <utility>
+#include <variant>
 
 namespace launchdarkly::server_side {
 
 using EventProcessor = events::AsioEventProcessor<config::builders::SDK>;
 
-// The ASIO implementation assumes that the io_context will be run from a
-// single thread, and applies several optimisations based on this
-// assumption.
+// With a single background thread, the ASIO implementation assumes that the
+// io_context will be run from that thread only, and applies several
+// optimisations based on this assumption. With more threads, the data system
+// is given its own strand and the event processor makes its own, so that
+// their handlers remain serialized. The Big Segments store wrapper is
+// internally synchronized and needs no strand.
 auto const kAsioConcurrencyHint = 1;
 
 // Client's destructor attempts to gracefully shut down the datasource
 // connection in this amount of time.
 auto const kDataSourceShutdownWait = std::chrono::milliseconds(100);
 
+// Threads running PrefetchBigSegments' store queries. The wrapper coalesces
+// lookups of the same key, so a small pool suffices.
+auto const kBigSegmentPrefetchThreads = 2;
+
+// One evaluation in every kEvaluationTimingInterval on each thread is timed,
+// so that evaluations don't all pay for reading the clock.
+static constexpr std::uint32_t kEvaluationTimingInterval = 16;
+
+static char const* const kEvaluationsMetric = "evaluations";
+static char const* const kEvaluationDurationMetric = "evaluation.duration_ns";
+
 // Hook method names
 // Method names for hooks
 static std::string const kMethodBoolVariation = "BoolVariation";
@@ -71,17 +90,20 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeBackgroundSyncSystem(
     config::built::HttpProperties const& http_properties,
     boost::asio::any_io_executor const& executor,
     data_components::DataSourceStatusManager& status_manager,
-    Logger& logger) {
+    Logger& logger,
+    metrics::Registry& metrics) {
     return std::make_unique<data_systems::BackgroundSync>(
-        endpoints, cfg, http_properties, executor, status_manager, logger);
+        endpoints, cfg, http_properties, executor, status_manager, logger,
+        &metrics);
 }
 
 static std::unique_ptr<data_interfaces::IDataSystem> MakeLazyLoadSystem(
     config::built::LazyLoadConfig const& cfg,
     data_components::DataSourceStatusManager& status_manager,
-    Logger& logger) {
-    return std::make_unique<data_systems::LazyLoad>(logger, cfg,
-                                                    status_manager);
+    Logger& logger,
+    metrics::Registry& metrics) {
+    return std::make_unique<data_systems::LazyLoad>(logger, cfg, status_manager,
+                                                    &metrics);
 }
 
 static std::unique_ptr<data_interfaces::IDataSystem> MakeFDv2System(
@@ -90,9 +112,20 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeFDv2System(
     config::built::HttpProperties const& http_properties,
     boost::asio::any_io_executor const& executor,
     data_components::DataSourceStatusManager& status_manager,
-    Logger const& logger) {
+    Logger const& logger,
+    metrics::Registry& metrics) {
     std::vector<std::unique_ptr<data_interfaces::IFDv2InitializerFactory>>
         initializer_factories;
+    std::unique_ptr<data_systems::FDv2SnapshotWriter> snapshot_writer;
+    if (cfg.snapshot) {
+        // The snapshot is tried first, so that a warm start doesn't wait on
+        // the network.
+        initializer_factories.push_back(
+            std::make_unique<data_systems::FDv2SnapshotInitializerFactory>(
+                logger, *cfg.snapshot));
+        snapshot_writer = std::make_unique<data_systems::FDv2SnapshotWriter>(
+            executor, logger, cfg.snapshot->path, cfg.snapshot->write_interval);
+    }
     for (auto const& initializer : cfg.initializers) {
         initializer_factories.push_back(
             std::make_unique<data_systems::FDv2PollingInitializerFactory>(
@@ -110,7 +143,7 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeFDv2System(
                         std::make_unique<
                             data_systems::FDv2StreamingSynchronizerFactory>(
                             executor, logger, endpoints, http_properties,
-                            streaming));
+                            streaming, &metrics));
                 },
                 [&](config::built::FDv2Config::PollingConfig const& polling) {
                     synchronizer_factories.push_back(
@@ -130,7 +163,7 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeFDv2System(
                                std::make_unique<
                                    data_systems::FDv1StreamingAdapterFactory>(
                                    executor, logger, endpoints, streaming,
-                                   http_properties));
+                                   http_properties, &metrics));
                        },
                        [&](config::built::FDv2Config::FDv1PollingConfig const&
                                polling) {
@@ -154,7 +187,8 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeFDv2System(
     return std::make_unique<data_systems::FDv2DataSystem>(
         std::move(initializer_factories), std::move(synchronizer_factories),
         std::move(fallback_cond_factory), std::move(recovery_cond_factory),
-        executor, &status_manager, logger);
+        executor, &status_manager, logger, std::move(snapshot_writer),
+        &metrics);
 }
 
 static std::unique_ptr<data_interfaces::IDataSystem> MakeDataSystem(
@@ -162,7 +196,8 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeDataSystem(
     Config const& config,
     boost::asio::any_io_executor const& executor,
     data_components::DataSourceStatusManager& status_manager,
-    Logger& logger) {
+    Logger& logger,
+    metrics::Registry& metrics) {
     if (config.DataSystemConfig().disabled) {
         return std::make_unique<data_systems::OfflineSystem>(status_manager);
     }
@@ -175,15 +210,15 @@ static std::unique_ptr<data_interfaces::IDataSystem> MakeDataSystem(
             [&](config::built::BackgroundSyncConfig const& cfg) {
                 return MakeBackgroundSyncSystem(
                     config.ServiceEndpoints(), cfg, data_source_properties,
-                    executor, status_manager, logger);
+                    executor, status_manager, logger, metrics);
             },
             [&](config::built::LazyLoadConfig const& cfg) {
-                return MakeLazyLoadSystem(cfg, status_manager, logger);
+                return MakeLazyLoadSystem(cfg, status_manager, logger, metrics);
             },
             [&](config::built::FDv2Config const& cfg) {
                 return MakeFDv2System(config.ServiceEndpoints(), cfg,
                                       data_source_properties, executor,
-                                      status_manager, logger);
+                                      status_manager, logger, metrics);
             },
         },
         config.DataSystemConfig().system_);
@@ -193,22 +228,27 @@ static Logger MakeLogger(config::built::Logging const& config) {
     if (config.disable_logging) {
         return {std::make_shared<logging::NullLoggerBackend>()};
     }
-    if (config.backend) {
-        return {config.backend};
+    std::shared_ptr<ILogBackend> backend =
+        config.backend ? config.backend
+                       : std::make_shared<logging::ConsoleBackend>(config.level,
+                                                                   config.tag);
+    if (config.async_capacity != 0) {
+        backend = std::make_shared<logging::AsyncBackend>(
+            std::move(backend), config.async_capacity);
     }
-    return {
-        std::make_shared<logging::ConsoleBackend>(config.level, config.tag)};
+    return {std::move(backend)};
 }
 
-std::unique_ptr<EventProcessor> MakeEventProcessor(
+std::unique_ptr<events::IEventProcessor> MakeEventProcessor(
     Config const& config,
     boost::asio::any_io_executor const& exec,
     config::built::HttpProperties const& http_properties,
-    Logger& logger) {
+    Logger& logger,
+    metrics::Registry& metrics) {
     if (config.Events().Enabled()) {
-        return std::make_unique<EventProcessor>(exec, config.ServiceEndpoints(),
-                                                config.Events(),
-                                                http_properties, logger);
+        return std::make_unique<EventProcessor>(
+            exec, config.ServiceEndpoints(), config.Events(), http_properties,
+            logger, &metrics);
     }
     return nullptr;
 }
@@ -221,6 +261,11 @@ bool IsFlagPresent(
     std::shared_ptr<data_model::FlagDescriptor> const& flag_desc);
 
 ClientImpl::ClientImpl(Config config, std::string const& version)
+    : ClientImpl(std::move(config), version, nullptr) {}
+
+ClientImpl::ClientImpl(Config config,
+                       std::string const& version,
+                       std::unique_ptr<events::IEventProcessor> event_processor)
     : config_(config),
       http_properties_(
           config::builders::HttpPropertiesBuilder(config.HttpProperties())
@@ -236,26 +281,39 @@ ClientImpl::ClientImpl(Config config, std::string const& version)
               .Header(kInstanceIdHeader, MakeInstanceId())
               .Build()),
       logger_(MakeLogger(config.Logging())),
-      ioc_(kAsioConcurrencyHint),
+      ioc_(config.IoThreads() > 1 ? static_cast<int>(config.IoThreads())
+                                  : kAsioConcurrencyHint),
       work_(boost::asio::make_work_guard(ioc_)),
+      metrics_(),
+      evaluations_(metrics_.GetCounter(kEvaluationsMetric)),
+      evaluation_duration_(metrics_.GetHistogram(kEvaluationDurationMetric)),
       status_manager_(),
       data_system_(MakeDataSystem(http_properties_,
                                   config_,
-                                  ioc_.get_executor(),
+                                  boost::asio::make_strand(ioc_),
                                   status_manager_,
-                                  logger_)),
-      event_processor_(MakeEventProcessor(config,
-                                          ioc_.get_executor(),
-                                          http_properties_,
-                                          logger_)),
+                                  logger_,
+                                  metrics_)),
+      event_processor_(event_processor
+                           ? std::move(event_processor)
+                           : MakeEventProcessor(config,
+                                                ioc_.get_executor(),
+                                                http_properties_,
+                                                logger_,
+                                                metrics_)),
       big_segment_store_(
           config_.BigSegments()
               ? std::make_shared<data_components::BigSegmentStoreWrapper>(
                     *config_.BigSegments(),
                     ioc_.get_executor(),
-                    logger_)
+                    logger_,
+                    &metrics_)
               : nullptr),
       big_segment_status_provider_(big_segment_store_),
+      big_segment_prefetch_pool_(
+          big_segment_store_ ? std::make_unique<boost::asio::thread_pool>(
+                                   kBigSegmentPrefetchThreads)
+                             : nullptr),
       evaluator_(logger_, *data_system_, big_segment_store_.get()),
       events_default_(event_processor_.get(), EventFactory::WithoutReasons()),
       events_with_reasons_(event_processor_.get(),
@@ -277,7 +335,9 @@ ClientImpl::ClientImpl(Config config, std::string const& version)
         big_segment_store_->Start();
     }
 
-    run_thread_ = std::move(std::thread([&]() { ioc_.run(); }));
+    for (std::size_t i = 0; i < config_.IoThreads(); i++) {
+        run_threads_.emplace_back([&]() { ioc_.run(); });
+    }
 }
 
 void ClientImpl::Identify(Context context) {
@@ -308,20 +368,18 @@ bool ClientImpl::Initialized() const {
     return data_system_->Initialized();
 }
 
-AllFlagsState ClientImpl::AllFlagsState(Context const& context,
-                                        AllFlagsState::Options options) {
-    std::unordered_map<Client::FlagKey, Value> result;
-
+template <typename Sink>
+bool ClientImpl::EvaluateAllFlags(Context const& context,
+                                  AllFlagsState::Options options,
+                                  Sink& sink) {
     if (!Initialized()) {
         LD_LOG(logger_, LogLevel::kWarn)
             << "AllFlagsState() called before client has finished "
                "initializing. Data source not available. Returning empty state";
 
-        return {};
+        return false;
     }
 
-    AllFlagsStateBuilder builder{options};
-
     auto all_flags = data_system_->AllFlags();
 
     // Because evaluating the flags may access many segments, tell the data
@@ -350,17 +408,57 @@ AllFlagsState ClientImpl::AllFlagsState(Context const& context,
 
         bool in_experiment = flag.IsExperimentationEnabled(detail.Reason());
 
-        builder.AddFlag(key, detail.Value(),
-                        AllFlagsState::State{
-                            flag.Version(), detail.VariationIndex(),
-                            detail.Reason(), flag.trackEvents || in_experiment,
-                            in_experiment, flag.debugEventsUntilDate,
-                            std::move(recorder).TakePrerequisites()});
+        sink.AddFlag(key, detail.Value(),
+                     AllFlagsState::State{
+                         flag.Version(), detail.VariationIndex(),
+                         detail.Reason(), flag.trackEvents || in_experiment,
+                         in_experiment, flag.debugEventsUntilDate,
+                         std::move(recorder).TakePrerequisites()});
     }
 
+    return true;
+}
+
+AllFlagsState ClientImpl::AllFlagsState(Context const& context,
+                                        AllFlagsState::Options options) {
+    AllFlagsStateBuilder builder{options};
+    if (!EvaluateAllFlags(context, options, builder)) {
+        return {};
+    }
     return builder.Build();
 }
 
+void ClientImpl::AllFlagsStateJson(Context const& context,
+                                   std::string& out,
+                                   AllFlagsState::Options options) {
+    AllFlagsStateJsonWriter writer{options, out};
+    if (!EvaluateAllFlags(context, options, writer)) {
+        AllFlagsStateJsonWriter::WriteInvalid(out);
+        return;
+    }
+    writer.Finish();
+}
+
+std::size_t ClientImpl::AllFlagsStateJson(Context const& context,
+                                          char* buffer,
+                                          std::size_t const size,
+                                          AllFlagsState::Options options) {
+    AllFlagsStateJsonWriter writer{options, JsonOutput(buffer, size)};
+    std::size_t length = 0;
+    if (EvaluateAllFlags(context, options, writer)) {
+        writer.Finish();
+        length = writer.Length();
+    } else {
+        // The writer has begun a valid state; this overwrites it.
+        length =
+            AllFlagsStateJsonWriter::WriteInvalid(JsonOutput(buffer, size));
+    }
+    if (length < size) {
+        buffer[length] = '\0';
+    }
+    return length;
+}
+
 void ClientImpl::TrackInternal(Context const& ctx,
                                std::string event_name,
                                std::optional<Value> data,
@@ -442,19 +540,24 @@ void ClientImpl::FlushAsync() {
 
 void ClientImpl::LogVariationCall(std::string const& key,
                                   bool flag_present) const {
+    // These can be logged on every evaluation, so each is rate limited.
     if (Initialized()) {
         if (!flag_present) {
-            LD_LOG(logger_, LogLevel::kInfo) << "Unknown feature flag " << key
-                                             << "; returning default value";
+            LD_LOG_RATE_LIMITED(logger_, LogLevel::kInfo,
+                                unknown_flag_log_limiter_)
+                << "Unknown feature flag " << key
+                << "; returning default value";
         }
     } else {
         if (flag_present) {
-            LD_LOG(logger_, LogLevel::kInfo)
+            LD_LOG_RATE_LIMITED(logger_, LogLevel::kInfo,
+                                not_initialized_log_limiter_)
                 << "LaunchDarkly client has not yet been initialized; using "
                    "last "
                    "known flag rules from data store";
         } else {
-            LD_LOG(logger_, LogLevel::kInfo)
+            LD_LOG_RATE_LIMITED(logger_, LogLevel::kInfo,
+                                not_initialized_no_flag_log_limiter_)
                 << "LaunchDarkly client has not yet been initialized; "
                    "returning default value";
         }
@@ -482,30 +585,81 @@ EvaluationDetail<Value> ClientImpl::VariationInternal(
     EventScope const& event_scope,
     hooks::HookContext const& hook_context,
     std::string const& method_name) {
+    return VariationInternal(context, key, default_value, event_scope,
+                             hook_context, method_name,
+                             PreEvaluationChecks(context), nullptr);
+}
+
+EvaluationDetail<Value> ClientImpl::VariationInternal(
+    Context const& context,
+    IClient::FlagKey const& key,
+    Value const& default_value,
+    EventScope const& event_scope,
+    hooks::HookContext const& hook_context,
+    std::string const& method_name,
+    std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+    evaluation::BigSegmentMemberships* memberships) {
+    evaluations_.Add();
+
+    thread_local std::uint32_t untimed_evaluations = 0;
+    if (++untimed_evaluations < kEvaluationTimingInterval) {
+        return EvaluateWithHooks(context, key, default_value, event_scope,
+                                 hook_context, method_name, context_error,
+                                 memberships);
+    }
+    untimed_evaluations = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+    auto detail = EvaluateWithHooks(context, key, default_value, event_scope,
+                                    hook_context, method_name, context_error,
+                                    memberships);
+    evaluation_duration_.Record(std::chrono::steady_clock::now() - start);
+    return detail;
+}
+
+EvaluationDetail<Value> ClientImpl::EvaluateWithHooks(
+    Context const& context,
+    IClient::FlagKey const& key,
+    Value const& default_value,
+    EventScope const& event_scope,
+    hooks::HookContext const& hook_context,
+    std::string const& method_name,
+    std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+    evaluation::BigSegmentMemberships* memberships) {
+    // Without hooks, avoid constructing the series context and executor at
+    // all, so that evaluations pay nothing for hook support.
+    if (config_.Hooks().empty()) {
+        return EvaluateFlag(context, key, default_value, event_scope,
+                            context_error, memberships);
+    }
+
+    // Both stages share one series context.
+    hooks::EvaluationSeriesContext const series_context(
+        key, context, default_value, method_name, hook_context, std::nullopt);
+    hooks::EvaluationSeriesExecutor executor(config_.Hooks(), logger_);
+
     // Execute beforeEvaluation hooks
-    std::optional<hooks::EvaluationSeriesExecutor> executor;
-    if (!config_.Hooks().empty()) {
-        hooks::EvaluationSeriesContext series_context(
-            key, context, default_value, method_name, hook_context,
-            std::nullopt);
-        // Executor only created if there are hooks.
-        executor.emplace(config_.Hooks(), logger_);
-        executor->BeforeEvaluation(series_context);
-    }
-
-    if (auto error = PreEvaluationChecks(context)) {
-        auto detail = PostEvaluation(key, context, default_value, *error,
-                                     event_scope, std::nullopt);
-
-        // Execute afterEvaluation hooks
-        if (executor) {
-            hooks::EvaluationSeriesContext series_context(
-                key, context, default_value, method_name, hook_context,
-                std::nullopt);
-            executor->AfterEvaluation(series_context, detail);
-        }
+    executor.BeforeEvaluation(series_context);
+
+    auto detail = EvaluateFlag(context, key, default_value, event_scope,
+                               context_error, memberships);
+
+    // Execute afterEvaluation hooks
+    executor.AfterEvaluation(series_context, detail);
 
-        return detail;
+    return detail;
+}
+
+EvaluationDetail<Value> ClientImpl::EvaluateFlag(
+    Context const& context,
+    IClient::FlagKey const& key,
+    Value const& default_value,
+    EventScope const& event_scope,
+    std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+    evaluation::BigSegmentMemberships* memberships) {
+    if (context_error) {
+        return PostEvaluation(key, context, default_value, *context_error,
+                              event_scope, std::nullopt);
     }
 
     auto flag_rule = data_system_->GetFlag(key);
@@ -515,35 +669,15 @@ EvaluationDetail<Value> ClientImpl::VariationInternal(
     LogVariationCall(key, flag_present);
 
     if (!flag_present) {
-        auto detail = PostEvaluation(key, context, default_value,
-                                     EvaluationReason::ErrorKind::kFlagNotFound,
-                                     event_scope, std::nullopt);
-
-        // Execute afterEvaluation hooks
-        if (executor) {
-            hooks::EvaluationSeriesContext series_context(
-                key, context, default_value, method_name, hook_context,
-                std::nullopt);
-            executor->AfterEvaluation(series_context, detail);
-        }
-
-        return detail;
-    }
-
-    EvaluationDetail<Value> result =
-        evaluator_.Evaluate(*flag_rule->item, context, event_scope);
-    auto detail = PostEvaluation(key, context, default_value, result,
-                                 event_scope, flag_rule.get()->item);
-
-    // Execute afterEvaluation hooks
-    if (executor) {
-        hooks::EvaluationSeriesContext series_context(
-            key, context, default_value, method_name, hook_context,
-            std::nullopt);
-        executor->AfterEvaluation(series_context, detail);
+        return PostEvaluation(key, context, default_value,
+                              EvaluationReason::ErrorKind::kFlagNotFound,
+                              event_scope, std::nullopt);
     }
 
-    return detail;
+    EvaluationDetail<Value> result = evaluator_.Evaluate(
+        *flag_rule->item, context, event_scope, memberships);
+    return PostEvaluation(key, context, default_value, std::move(result),
+                          event_scope, flag_rule.get()->item);
 }
 
 std::optional<enum EvaluationReason::ErrorKind> ClientImpl::PreEvaluationChecks(
@@ -581,9 +715,11 @@ EvaluationDetail<Value> ClientImpl::PostEvaluation(
             }
             // VARIANT: EvaluationDetail
             else if constexpr (std::is_same_v<T, EvaluationDetail<Value>>) {
-                auto detail = EvaluationDetail<Value>{
-                    (!arg.VariationIndex() ? default_value : arg.Value()),
-                    arg.VariationIndex(), arg.Reason()};
+                auto detail =
+                    arg.VariationIndex()
+                        ? std::move(arg)
+                        : EvaluationDetail<Value>{default_value, std::nullopt,
+                                                  arg.Reason()};
 
                 event_scope.Send([&](EventFactory const& factory) {
                     return factory.Eval(key, context, flag, detail,
@@ -761,6 +897,26 @@ EvaluationDetail<Value> ClientImpl::JsonVariationDetail(
                              hook_context, kMethodJsonVariationDetail);
 }
 
+std::vector<EvaluationDetail<Value>> ClientImpl::JsonVariationDetails(
+    Context const& ctx,
+    std::vector<FlagKeyAndDefault> const& flags) {
+    static hooks::HookContext empty_hook_context;
+    auto const context_error = PreEvaluationChecks(ctx);
+    evaluation::BigSegmentMemberships memberships;
+
+    std::vector<EvaluationDetail<Value>> details;
+    details.reserve(flags.size());
+    // Reused for every flag, so that a key usually needs no allocation.
+    FlagKey key;
+    for (auto const& [key_view, default_value] : flags) {
+        key.assign(key_view);
+        details.push_back(VariationInternal(
+            ctx, key, *default_value, events_with_reasons_, empty_hook_context,
+            kMethodJsonVariationDetail, context_error, &memberships));
+    }
+    return details;
+}
+
 Value ClientImpl::JsonVariation(Context const& ctx,
                                 IClient::FlagKey const& key,
                                 Value default_value) {
@@ -785,9 +941,50 @@ IBigSegmentStoreStatusProvider& ClientImpl::BigSegmentStoreStatus() {
     return big_segment_status_provider_;
 }
 
+metrics::MetricsSnapshot ClientImpl::Metrics() const {
+    return metrics_.Snapshot();
+}
+
+std::future<bool> ClientImpl::PrefetchBigSegments(Context const& context) {
+    auto pr = std::make_shared<std::promise<bool>>();
+    auto fut = pr->get_future();
+
+    if (!big_segment_store_ || !context.Valid()) {
+        pr->set_value(false);
+        return fut;
+    }
+
+    std::vector<std::string> context_keys;
+    for (auto const& [kind, key] : context.KindsToKeys()) {
+        context_keys.push_back(key);
+    }
+
+    // The wrapper is internally synchronized, so prefetches for different
+    // requests needn't share a strand.
+    big_segment_store_
+        ->Prefetch(std::move(context_keys),
+                   big_segment_prefetch_pool_->get_executor())
+        .Then(
+            [pr](data_components::BigSegmentsStatus const& status) {
+                pr->set_value(status !=
+                              data_components::BigSegmentsStatus::kStoreError);
+                return std::monostate{};
+            },
+            async::kInlineExecutor);
+
+    return fut;
+}
+
 ClientImpl::~ClientImpl() {
+    if (big_segment_prefetch_pool_) {
+        // Queued prefetches are allowed to finish, so that every future
+        // returned by PrefetchBigSegments is resolved.
+        big_segment_prefetch_pool_->join();
+    }
     ioc_.stop();
     // TODO(SC-219101)
-    run_thread_.join();
+    for (auto& thread : run_threads_) {
+        thread.join();
+    }
 }
 }  // namespace launchdarkly::server_side
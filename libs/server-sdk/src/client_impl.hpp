@@ -14,11 +14,13 @@
 #include <launchdarkly/error.hpp>
 #include <launchdarkly/events/event_processor_interface.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/server_side/client.hpp>
 #include <launchdarkly/value.hpp>
 
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
 
 #include <tl/expected.hpp>
 
@@ -29,6 +31,7 @@
 #include <shared_mutex>
 #include <thread>
 #include <tuple>
+#include <vector>
 
 namespace launchdarkly::server_side {
 
@@ -36,6 +39,14 @@ class ClientImpl : public IClient {
    public:
     ClientImpl(Config config, std::string const& version);
 
+    /**
+     * As above, but sends analytics events to the given processor instead of
+     * one built from the configuration. Used by tests to observe events.
+     */
+    ClientImpl(Config config,
+               std::string const& version,
+               std::unique_ptr<events::IEventProcessor> event_processor);
+
     ClientImpl(ClientImpl&&) = delete;
     ClientImpl(ClientImpl const&) = delete;
     ClientImpl& operator=(ClientImpl) = delete;
@@ -49,6 +60,17 @@ class ClientImpl : public IClient {
         AllFlagsState::Options options =
             AllFlagsState::Options::Default) override;
 
+    void AllFlagsStateJson(Context const& context,
+                           std::string& out,
+                           AllFlagsState::Options options =
+                               AllFlagsState::Options::Default) override;
+
+    std::size_t AllFlagsStateJson(Context const& context,
+                                  char* buffer,
+                                  std::size_t size,
+                                  AllFlagsState::Options options =
+                                      AllFlagsState::Options::Default) override;
+
     void Track(Context const& ctx,
                std::string event_name,
                Value data,
@@ -175,10 +197,18 @@ class ClientImpl : public IClient {
         Value default_value,
         hooks::HookContext const& hook_context) override;
 
+    std::vector<EvaluationDetail<Value>> JsonVariationDetails(
+        Context const& ctx,
+        std::vector<FlagKeyAndDefault> const& flags) override;
+
     IDataSourceStatusProvider& DataSourceStatus() override;
 
     IBigSegmentStoreStatusProvider& BigSegmentStoreStatus() override;
 
+    std::future<bool> PrefetchBigSegments(Context const& context) override;
+
+    [[nodiscard]] metrics::MetricsSnapshot Metrics() const override;
+
     ~ClientImpl();
 
     std::future<bool> StartAsync() override;
@@ -192,6 +222,39 @@ class ClientImpl : public IClient {
         hooks::HookContext const& hook_context,
         std::string const& method_name);
 
+    // As above, with the result of PreEvaluationChecks for the context
+    // already known, and the context's Big Segment memberships shared with
+    // other evaluations if memberships isn't null.
+    [[nodiscard]] EvaluationDetail<Value> VariationInternal(
+        Context const& ctx,
+        FlagKey const& key,
+        Value const& default_value,
+        EventScope const& scope,
+        hooks::HookContext const& hook_context,
+        std::string const& method_name,
+        std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+        evaluation::BigSegmentMemberships* memberships);
+
+    // Runs the hooks around an evaluation.
+    [[nodiscard]] EvaluationDetail<Value> EvaluateWithHooks(
+        Context const& ctx,
+        FlagKey const& key,
+        Value const& default_value,
+        EventScope const& scope,
+        hooks::HookContext const& hook_context,
+        std::string const& method_name,
+        std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+        evaluation::BigSegmentMemberships* memberships);
+
+    // Evaluates a flag and sends its events, without running hooks.
+    [[nodiscard]] EvaluationDetail<Value> EvaluateFlag(
+        Context const& ctx,
+        FlagKey const& key,
+        Value const& default_value,
+        EventScope const& scope,
+        std::optional<enum EvaluationReason::ErrorKind> const& context_error,
+        evaluation::BigSegmentMemberships* memberships);
+
     template <typename T>
     [[nodiscard]] EvaluationDetail<T> VariationDetail(
         Context const& ctx,
@@ -230,6 +293,14 @@ class ClientImpl : public IClient {
     [[nodiscard]] std::optional<enum EvaluationReason::ErrorKind>
     PreEvaluationChecks(Context const& context) const;
 
+    // Evaluates every flag for AllFlagsState, passing each result to
+    // sink.AddFlag(key, value, state). Returns false, without evaluating, if
+    // the client is not initialized.
+    template <typename Sink>
+    bool EvaluateAllFlags(Context const& context,
+                          AllFlagsState::Options options,
+                          Sink& sink);
+
     void TrackInternal(Context const& ctx,
                        std::string event_name,
                        std::optional<Value> data,
@@ -244,12 +315,22 @@ class ClientImpl : public IClient {
     Config config_;
     Logger logger_;
 
+    // Limit the per-evaluation messages of LogVariationCall.
+    mutable LogRateLimiter unknown_flag_log_limiter_;
+    mutable LogRateLimiter not_initialized_log_limiter_;
+    mutable LogRateLimiter not_initialized_no_flag_log_limiter_;
+
     launchdarkly::config::shared::built::HttpProperties http_properties_;
 
     boost::asio::io_context ioc_;
     boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
         work_;
 
+    // Declared before every component which records to it.
+    metrics::Registry metrics_;
+    metrics::Counter& evaluations_;
+    metrics::Histogram& evaluation_duration_;
+
     data_components::DataSourceStatusManager status_manager_;
 
     // This is the main polymorphic component that constitutes the
@@ -265,6 +346,11 @@ class ClientImpl : public IClient {
     std::shared_ptr<data_components::BigSegmentStoreWrapper> big_segment_store_;
     data_components::BigSegmentStoreStatusProvider big_segment_status_provider_;
 
+    // Runs PrefetchBigSegments' store queries, which block, so that they
+    // don't hold up network I/O on ioc_. Present only when Big Segments are
+    // configured. The destructor joins it while big_segment_store_ is alive.
+    std::unique_ptr<boost::asio::thread_pool> big_segment_prefetch_pool_;
+
     mutable std::mutex init_mutex_;
     std::condition_variable init_waiter_;
 
@@ -273,6 +359,7 @@ class ClientImpl : public IClient {
     EventScope const events_default_;
     EventScope const events_with_reasons_;
 
-    std::thread run_thread_;
+    // Threads running ioc_, one per Config::IoThreads().
+    std::vector<std::thread> run_threads_;
 };
 }  // namespace launchdarkly::server_side
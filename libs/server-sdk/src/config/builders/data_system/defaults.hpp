@@ -33,7 +33,8 @@ struct Defaults {
 
     static auto LazyLoadConfig() -> built::LazyLoadConfig {
         return {built::LazyLoadConfig::EvictionPolicy::Disabled,
-                std::chrono::minutes{5}, nullptr};
+                std::chrono::minutes{5}, nullptr,
+                built::LazyLoadConfig::RefreshPolicy::Synchronous, 0, 0};
     }
 
     static auto FDv2StreamingConfig() -> built::FDv2Config::StreamingConfig {
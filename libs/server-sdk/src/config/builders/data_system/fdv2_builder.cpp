@@ -34,12 +34,26 @@ built::FDv2Config::PollingConfig FDv2Builder::Polling::Build() const {
     return {poll_interval_, base_url_override_};
 }
 
+FDv2Builder::LocalSnapshot::LocalSnapshot(std::string path)
+    : path_(std::move(path)) {}
+
+FDv2Builder::LocalSnapshot& FDv2Builder::LocalSnapshot::WriteInterval(
+    std::chrono::milliseconds interval) {
+    write_interval_ = interval;
+    return *this;
+}
+
+built::FDv2Config::SnapshotConfig FDv2Builder::LocalSnapshot::Build() const {
+    return {path_, write_interval_};
+}
+
 FDv2Builder::FDv2Builder()
     : config_{{},
               {},
               std::nullopt,
               std::chrono::minutes{2},
-              std::chrono::minutes{5}} {}
+              std::chrono::minutes{5},
+              std::nullopt} {}
 
 FDv2Builder FDv2Builder::Default() {
     return FDv2Builder()
@@ -58,6 +72,11 @@ FDv2Builder& FDv2Builder::Initializer(Polling source) {
     return *this;
 }
 
+FDv2Builder& FDv2Builder::Snapshot(LocalSnapshot source) {
+    config_.snapshot = source.Build();
+    return *this;
+}
+
 FDv2Builder& FDv2Builder::Synchronizer(Streaming source) {
     config_.synchronizers.push_back(source.Build());
     return *this;
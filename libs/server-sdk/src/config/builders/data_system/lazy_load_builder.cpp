@@ -17,6 +17,22 @@ LazyLoadBuilder& LazyLoadBuilder::CacheEviction(EvictionPolicy const policy) {
     return *this;
 }
 
+LazyLoadBuilder& LazyLoadBuilder::CacheRefreshPolicy(
+    RefreshPolicy const policy) {
+    config_.refresh_policy = policy;
+    return *this;
+}
+
+LazyLoadBuilder& LazyLoadBuilder::CacheMaxItems(std::size_t const max_items) {
+    config_.cache_max_items = max_items;
+    return *this;
+}
+
+LazyLoadBuilder& LazyLoadBuilder::CacheMaxBytes(std::size_t const max_bytes) {
+    config_.cache_max_bytes = max_bytes;
+    return *this;
+}
+
 LazyLoadBuilder& LazyLoadBuilder::Source(SourcePtr source) {
     config_.source = std::move(source);
     return *this;
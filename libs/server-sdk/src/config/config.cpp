@@ -12,7 +12,8 @@ Config::Config(std::string sdk_key,
                config::built::DataSystemConfig data_system_config,
                std::optional<config::built::BigSegmentsConfig> big_segments,
                built::HttpProperties http_properties,
-               std::vector<std::shared_ptr<hooks::Hook>> hooks)
+               std::vector<std::shared_ptr<hooks::Hook>> hooks,
+               std::size_t const io_threads)
     : sdk_key_(std::move(sdk_key)),
       logging_(std::move(logging)),
       service_endpoints_(std::move(service_endpoints)),
@@ -21,7 +22,8 @@ Config::Config(std::string sdk_key,
       data_system_config_(std::move(data_system_config)),
       big_segments_(std::move(big_segments)),
       http_properties_(std::move(http_properties)),
-      hooks_(std::move(hooks)) {}
+      hooks_(std::move(hooks)),
+      io_threads_(io_threads) {}
 
 std::string const& Config::SdkKey() const {
     return sdk_key_;
@@ -60,4 +62,8 @@ std::vector<std::shared_ptr<hooks::Hook>> const& Config::Hooks() const {
     return hooks_;
 }
 
+std::size_t Config::IoThreads() const {
+    return io_threads_;
+}
+
 }  // namespace launchdarkly::server_side
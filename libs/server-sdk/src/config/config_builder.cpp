@@ -1,9 +1,11 @@
 #include <launchdarkly/server_side/config/config_builder.hpp>
 
+#include <algorithm>
+
 namespace launchdarkly::server_side {
 
 ConfigBuilder::ConfigBuilder(std::string sdk_key)
-    : sdk_key_(std::move(sdk_key)), offline_(false) {}
+    : sdk_key_(std::move(sdk_key)), offline_(false), io_threads_(1) {}
 
 config::builders::EndpointsBuilder& ConfigBuilder::ServiceEndpoints() {
     return service_endpoints_builder_;
@@ -40,6 +42,11 @@ ConfigBuilder& ConfigBuilder::Offline(bool const offline) {
     return *this;
 }
 
+ConfigBuilder& ConfigBuilder::IoThreads(std::size_t const threads) {
+    io_threads_ = std::max<std::size_t>(threads, 1);
+    return *this;
+}
+
 ConfigBuilder& ConfigBuilder::Hooks(std::shared_ptr<hooks::Hook> hook) {
     if (hook) {
         hooks_.push_back(std::move(hook));
@@ -100,7 +107,8 @@ tl::expected<Config, Error> ConfigBuilder::Build() const {
             std::move(*data_system_config),
             std::move(big_segments_config),
             std::move(http_properties),
-            hooks_};
+            hooks_,
+            io_threads_};
 }
 
 }  // namespace launchdarkly::server_side
@@ -5,7 +5,11 @@
 #include <launchdarkly/encoding/sha_256.hpp>
 #include <launchdarkly/signals/boost_signal_connection.hpp>
 
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <variant>
@@ -13,6 +17,9 @@
 namespace launchdarkly::server_side::data_components {
 
 namespace {
+char const* const kCacheHitsMetric = "big_segments.cache_hits";
+char const* const kCacheMissesMetric = "big_segments.cache_misses";
+
 // The store is keyed by base64(sha256(contextKey)), matching what the Relay
 // Proxy writes; raw context keys are never sent to the store.
 std::string HashContextKey(std::string const& context_key) {
@@ -25,13 +32,17 @@ std::string HashContextKey(std::string const& context_key) {
 BigSegmentStoreWrapper::BigSegmentStoreWrapper(
     config::built::BigSegmentsConfig const& config,
     boost::asio::any_io_executor executor,
-    Logger const& logger)
+    Logger const& logger,
+    metrics::Registry* metrics)
     : store_(config.store),
       stale_after_(config.stale_after),
       poll_interval_(config.status_poll_interval),
       logger_(logger),
       executor_(std::move(executor)),
-      cache_(config.context_cache_size, config.context_cache_time) {}
+      cache_(config.context_cache_size, config.context_cache_time),
+      cache_hits_(metrics ? &metrics->GetCounter(kCacheHitsMetric) : nullptr),
+      cache_misses_(metrics ? &metrics->GetCounter(kCacheMissesMetric)
+                            : nullptr) {}
 
 BigSegmentStoreWrapper::~BigSegmentStoreWrapper() {
     poll_cancel_.Cancel();
@@ -43,87 +54,204 @@ void BigSegmentStoreWrapper::Start() {
 
 BigSegmentStoreWrapper::GetMembershipResult
 BigSegmentStoreWrapper::GetMembership(std::string const& context_key) {
+    auto result = GetMemberships({context_key});
+    if (result.status == BigSegmentsStatus::kStoreError) {
+        return {std::make_shared<CompactMembership const>(), result.status};
+    }
+    return {std::move(result.memberships.at(context_key)), result.status};
+}
+
+std::optional<BigSegmentStoreWrapper::GetMembershipResult>
+BigSegmentStoreWrapper::GetCachedMembership(std::string const& context_key) {
     auto membership = cache_.Get(context_key);
-    if (!membership.has_value()) {
-        auto const result = LoadMembership(context_key);
-        if (!result.has_value()) {
+    if (!membership) {
+        return std::nullopt;
+    }
+    if (cache_hits_) {
+        cache_hits_->Add(1);
+    }
+    return GetMembershipResult{std::move(membership), LookupStatus()};
+}
+
+bool BigSegmentStoreWrapper::BatchesMemberships() const {
+    return store_->BatchesMemberships();
+}
+
+BigSegmentStoreWrapper::GetMembershipsResult
+BigSegmentStoreWrapper::GetMemberships(
+    std::vector<std::string> const& context_keys) {
+    std::unordered_map<std::string, MembershipPtr> memberships;
+    std::vector<std::string> misses;
+    for (auto const& context_key : context_keys) {
+        if (memberships.count(context_key) != 0 ||
+            std::find(misses.begin(), misses.end(), context_key) !=
+                misses.end()) {
+            continue;
+        }
+        if (auto membership = cache_.Get(context_key)) {
+            memberships.emplace(context_key, std::move(membership));
+        } else {
+            misses.push_back(context_key);
+        }
+    }
+
+    if (cache_hits_) {
+        cache_hits_->Add(memberships.size());
+        cache_misses_->Add(misses.size());
+    }
+
+    if (!misses.empty()) {
+        auto loaded = LoadMemberships(misses);
+        if (!loaded.has_value()) {
             LD_LOG(logger_, LogLevel::kError)
-                << "Big Segment store returned error: " << result.error();
+                << "Big Segment store returned error: " << loaded.error();
             MarkStoreUnavailable();
-            return {integrations::Membership::FromSegmentRefs({}, {}),
-                    BigSegmentsStatus::kStoreError};
+            return {{}, BigSegmentsStatus::kStoreError};
         }
-        membership = *result;
+        memberships.merge(*loaded);
     }
 
-    auto const status = GetStatus().stale ? BigSegmentsStatus::kStale
-                                          : BigSegmentsStatus::kHealthy;
-    return {std::move(*membership), status};
+    return {std::move(memberships), LookupStatus()};
+}
+
+async::Future<BigSegmentsStatus> BigSegmentStoreWrapper::Prefetch(
+    std::vector<std::string> context_keys,
+    boost::asio::any_io_executor const& executor) {
+    async::Promise<BigSegmentsStatus> promise;
+    auto future = promise.GetFuture();
+    boost::asio::post(
+        executor, [weak_self = weak_from_this(),
+                   context_keys = std::move(context_keys),
+                   promise = std::move(promise)]() mutable {
+            if (auto self = weak_self.lock()) {
+                promise.Resolve(self->GetMemberships(context_keys).status);
+            } else {
+                promise.Resolve(BigSegmentsStatus::kStoreError);
+            }
+        });
+    return future;
+}
+
+std::optional<SegmentRefId> BigSegmentStoreWrapper::FindSegmentRef(
+    std::string const& segment_key,
+    std::uint64_t const generation) const {
+    return segment_refs_.Find(segment_key, generation);
 }
 
-BigSegmentStoreWrapper::StoreMembership BigSegmentStoreWrapper::LoadMembership(
-    std::string const& context_key) {
-    std::shared_ptr<InFlightQuery> query;
-    bool is_leader = false;
+BigSegmentStoreWrapper::LoadResults BigSegmentStoreWrapper::LoadMemberships(
+    std::vector<std::string> const& context_keys) {
+    // Keys this caller queries the store for, and keys some other caller is
+    // already querying for, each with the query its result is published to.
+    std::vector<std::string> leading_keys;
+    std::vector<std::shared_ptr<InFlightQuery>> leading_queries;
+    std::vector<std::pair<std::string, std::shared_ptr<InFlightQuery>>>
+        awaited;
     {
         std::lock_guard lock(load_mutex_);
-        auto const it = in_flight_.find(context_key);
-        if (it != in_flight_.end()) {
-            query = it->second;
-        } else {
-            query = std::make_shared<InFlightQuery>();
-            in_flight_.emplace(context_key, query);
-            is_leader = true;
+        for (auto const& context_key : context_keys) {
+            auto const it = in_flight_.find(context_key);
+            if (it != in_flight_.end()) {
+                awaited.emplace_back(context_key, it->second);
+            } else {
+                auto query = std::make_shared<InFlightQuery>();
+                in_flight_.emplace(context_key, query);
+                leading_keys.push_back(context_key);
+                leading_queries.push_back(std::move(query));
+            }
         }
     }
 
-    if (!is_leader) {
-        std::unique_lock lock(query->mutex);
-        query->cv.wait(lock, [&query] { return query->result.has_value(); });
-        return *query->result;
-    }
-
-    // Ensures the in-flight entry is removed and waiters are notified on every
-    // leader exit, including throws. If the leader exits without completing,
-    // waiters receive a sentinel error rather than blocking forever.
-    struct QueryCleanup {
-        std::mutex& load_mutex;
-        std::unordered_map<std::string, std::shared_ptr<InFlightQuery>>&
-            in_flight;
-        std::string const& key;
-        std::shared_ptr<InFlightQuery> query;
-        bool completed = false;
-
-        ~QueryCleanup() {
-            {
-                std::lock_guard lock(load_mutex);
-                in_flight.erase(key);
+    std::unordered_map<std::string, MembershipPtr> memberships;
+    std::optional<std::string> error;
+    auto const collect = [&](std::string const& context_key,
+                             LoadResult const& result) {
+        if (result.has_value()) {
+            memberships.emplace(context_key, *result);
+        } else if (!error) {
+            error = result.error();
+        }
+    };
+
+    if (!leading_keys.empty()) {
+        // Ensures the in-flight entries are removed and waiters are notified
+        // on every exit, including throws. If the leader exits without
+        // completing a query, its waiters receive a sentinel error rather than
+        // blocking forever.
+        struct QueryCleanup {
+            std::mutex& load_mutex;
+            std::unordered_map<std::string, std::shared_ptr<InFlightQuery>>&
+                in_flight;
+            std::vector<std::string> const& keys;
+            std::vector<std::shared_ptr<InFlightQuery>> const& queries;
+
+            ~QueryCleanup() {
+                {
+                    std::lock_guard lock(load_mutex);
+                    for (auto const& key : keys) {
+                        in_flight.erase(key);
+                    }
+                }
+                for (auto const& query : queries) {
+                    {
+                        std::lock_guard lock(query->mutex);
+                        if (!query->result.has_value()) {
+                            query->result = tl::make_unexpected(std::string(
+                                "Big Segment lookup leader exited without "
+                                "setting a result"));
+                        }
+                    }
+                    query->cv.notify_all();
+                }
             }
-            if (!completed) {
-                std::lock_guard lock(query->mutex);
-                if (!query->result.has_value()) {
-                    query->result = tl::make_unexpected(std::string(
-                        "Big Segment lookup leader exited without setting a "
-                        "result"));
+        };
+        QueryCleanup cleanup{load_mutex_, in_flight_, leading_keys,
+                             leading_queries};
+
+        std::vector<std::string> hashes;
+        hashes.reserve(leading_keys.size());
+        for (auto const& context_key : leading_keys) {
+            hashes.push_back(HashContextKey(context_key));
+        }
+
+        // Query the store outside any lock, then publish each result. The
+        // cleanup drops the in-flight entries on return (or throw).
+        auto const results = store_->GetMemberships(hashes);
+        for (std::size_t i = 0; i < leading_keys.size(); i++) {
+            LoadResult result = tl::make_unexpected(
+                results.has_value()
+                    ? std::string("Big Segment store returned no membership "
+                                  "for a requested context")
+                    : results.error());
+            if (results.has_value()) {
+                if (auto const it = results->find(hashes[i]);
+                    it != results->end()) {
+                    result = std::make_shared<CompactMembership const>(
+                        segment_refs_.Compact(it->second));
+                    cache_.Set(leading_keys[i], *result);
                 }
             }
-            query->cv.notify_all();
+            collect(leading_keys[i], result);
+            std::lock_guard lock(leading_queries[i]->mutex);
+            leading_queries[i]->result = std::move(result);
         }
-    };
-    QueryCleanup cleanup{load_mutex_, in_flight_, context_key, query};
+    }
 
-    // Query the store outside any lock, then publish the result. The cleanup
-    // drops the in-flight entry on return (or throw).
-    auto result = store_->GetMembership(HashContextKey(context_key));
-    if (result.has_value()) {
-        cache_.Set(context_key, *result);
+    for (auto const& entry : awaited) {
+        auto const& query = entry.second;
+        std::unique_lock lock(query->mutex);
+        query->cv.wait(lock, [&query] { return query->result.has_value(); });
+        collect(entry.first, *query->result);
     }
-    {
-        std::lock_guard lock(query->mutex);
-        query->result = result;
-        cleanup.completed = true;
+
+    if (error) {
+        return tl::make_unexpected(std::move(*error));
     }
-    return result;
+    return memberships;
+}
+
+BigSegmentsStatus BigSegmentStoreWrapper::LookupStatus() {
+    return GetStatus().stale ? BigSegmentsStatus::kStale
+                             : BigSegmentsStatus::kHealthy;
 }
 
 void BigSegmentStoreWrapper::MarkStoreUnavailable() {
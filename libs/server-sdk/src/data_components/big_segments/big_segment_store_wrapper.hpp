@@ -1,26 +1,32 @@
 #pragma once
 
 #include "big_segments_status.hpp"
+#include "compact_membership.hpp"
 #include "membership_cache.hpp"
+#include "segment_ref_interner.hpp"
 
 #include <launchdarkly/server_side/config/built/big_segments_config.hpp>
 #include <launchdarkly/server_side/integrations/big_segments/ibig_segment_store.hpp>
 
 #include <launchdarkly/async/cancellation.hpp>
+#include <launchdarkly/async/promise.hpp>
 #include <launchdarkly/connection.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
 #include <boost/signals2/signal.hpp>
 
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace launchdarkly::server_side::data_components {
 
@@ -28,17 +34,18 @@ namespace launchdarkly::server_side::data_components {
  * @brief Internal layer between the evaluator and a customer-provided
  * @ref integrations::IBigSegmentStore.
  *
- * Adds context-key hashing, an LRU membership cache, a background task that
+ * Adds context-key hashing, a sharded membership cache, a background task that
  * polls the store's metadata to track availability and staleness, and a
  * status-change broadcaster.
  *
  * Construct with @ref std::make_shared and call @ref Start once to begin
  * background polling; polling stops when the wrapper is destroyed.
  *
- * Thread-safe: @ref GetMembership, @ref GetStatus, and @ref OnStatusChange may
- * be called concurrently from any number of evaluation threads, including while
- * the background poll runs on the executor. The store is only ever queried with
- * the relevant lock released, so a slow store never blocks unrelated callers.
+ * Thread-safe: @ref GetMembership, @ref Prefetch, @ref GetStatus, and
+ * @ref OnStatusChange may be called concurrently from any number of evaluation
+ * threads, including while the background poll runs on the executor. The store
+ * is only ever queried with the relevant lock released, so a slow store never
+ * blocks unrelated callers.
  */
 class BigSegmentStoreWrapper
     : public std::enable_shared_from_this<BigSegmentStoreWrapper> {
@@ -48,10 +55,13 @@ class BigSegmentStoreWrapper
      * @param executor Executor the background poll runs on.
      * @param logger Used for store-error and debug logging. Must outlive the
      * wrapper.
+     * @param metrics If present, the membership cache's hits and misses are
+     * counted in it. Must outlive the wrapper.
      */
     BigSegmentStoreWrapper(config::built::BigSegmentsConfig const& config,
                            boost::asio::any_io_executor executor,
-                           Logger const& logger);
+                           Logger const& logger,
+                           metrics::Registry* metrics = nullptr);
 
     ~BigSegmentStoreWrapper();
 
@@ -66,8 +76,11 @@ class BigSegmentStoreWrapper
      */
     void Start();
 
+    using MembershipPtr = std::shared_ptr<CompactMembership const>;
+
     struct GetMembershipResult {
-        integrations::Membership membership;
+        // Never null.
+        MembershipPtr membership;
         BigSegmentsStatus status;
     };
 
@@ -84,6 +97,70 @@ class BigSegmentStoreWrapper
     [[nodiscard]] GetMembershipResult GetMembership(
         std::string const& context_key);
 
+    /**
+     * @brief Returns a context's Big Segments membership if it is cached,
+     * without querying the store.
+     *
+     * @param context_key The unhashed context key.
+     * @return The membership and its status, or nullopt on a cache miss.
+     */
+    [[nodiscard]] std::optional<GetMembershipResult> GetCachedMembership(
+        std::string const& context_key);
+
+    /**
+     * @brief Whether the store fetches several memberships for about the
+     * cost of one; see @ref integrations::IBigSegmentStore::BatchesMemberships.
+     */
+    [[nodiscard]] bool BatchesMemberships() const;
+
+    struct GetMembershipsResult {
+        std::unordered_map<std::string, MembershipPtr> memberships;
+        BigSegmentsStatus status;
+    };
+
+    /**
+     * @brief Returns the Big Segments memberships of several contexts, querying
+     * the store once for all of the keys which aren't cached.
+     *
+     * If the status is @ref BigSegmentsStatus::kStoreError the lookup failed
+     * and the returned map is empty; otherwise it holds an entry for every
+     * requested key.
+     *
+     * @param context_keys The unhashed context keys.
+     */
+    [[nodiscard]] GetMembershipsResult GetMemberships(
+        std::vector<std::string> const& context_keys);
+
+    /**
+     * @brief Loads the memberships of several contexts into the cache on the
+     * given executor, without blocking the caller.
+     *
+     * The keys are looked up exactly as by @ref GetMemberships, so keys already
+     * cached aren't queried and the rest are queried together. An evaluation
+     * which needs one of the keys while the query is running waits for it
+     * rather than querying again.
+     *
+     * @param context_keys The unhashed context keys.
+     * @param executor Executor the lookup runs on. The store query blocks
+     * it, so it shouldn't be one that also runs network I/O.
+     * @return A future resolving to the status of the lookup once every key is
+     * cached, or to @ref BigSegmentsStatus::kStoreError if it failed.
+     */
+    [[nodiscard]] async::Future<BigSegmentsStatus> Prefetch(
+        std::vector<std::string> context_keys,
+        boost::asio::any_io_executor const& executor);
+
+    /**
+     * @brief Returns the ID of a Big Segment's ref, for use with
+     * @ref CompactMembership::CheckMembership. Never allocates.
+     *
+     * @return The ID, or nullopt if no membership returned by this wrapper
+     * has an entry for the ref.
+     */
+    [[nodiscard]] std::optional<SegmentRefId> FindSegmentRef(
+        std::string const& segment_key,
+        std::uint64_t generation) const;
+
     /**
      * @brief Returns the current store health. If no metadata poll has
      * completed yet, performs one synchronously on the calling thread first, so
@@ -100,20 +177,27 @@ class BigSegmentStoreWrapper
         std::function<void(BigSegmentStoreStatus)> handler);
 
    private:
-    using StoreMembership = integrations::IBigSegmentStore::GetMembershipResult;
+    using LoadResult = tl::expected<MembershipPtr, std::string>;
+    using LoadResults =
+        tl::expected<std::unordered_map<std::string, MembershipPtr>,
+                     std::string>;
 
     // A store query shared by all callers that miss the same key concurrently:
     // the leader fills result and notifies; waiters block on cv until then.
     struct InFlightQuery {
         std::mutex mutex;
         std::condition_variable cv;
-        std::optional<StoreMembership> result;
+        std::optional<LoadResult> result;
     };
 
-    // Returns the membership for a key, querying the store on a cache miss and
-    // coalescing concurrent misses of the same key into one query.
-    [[nodiscard]] StoreMembership LoadMembership(
-        std::string const& context_key);
+    // Returns the memberships for keys which missed the cache, querying the
+    // store once for all of them. A key which another caller is already
+    // loading is not queried again; its result is awaited instead.
+    [[nodiscard]] LoadResults LoadMemberships(
+        std::vector<std::string> const& context_keys);
+
+    // The status of a successful lookup: stale or healthy.
+    [[nodiscard]] BigSegmentsStatus LookupStatus();
 
     // Marks the store unavailable after an evaluation-time error, preserving
     // the last-known staleness, and broadcasts if the status changed.
@@ -142,6 +226,14 @@ class BigSegmentStoreWrapper
     // Internally thread-safe.
     MembershipCache cache_;
 
+    // Null unless the wrapper was given a metrics registry.
+    metrics::Counter* const cache_hits_;
+    metrics::Counter* const cache_misses_;
+
+    // Interns the segment refs of every membership loaded from the store.
+    // Internally thread-safe.
+    SegmentRefInterner segment_refs_;
+
     // Broadcasts status changes to listeners registered via OnStatusChange.
     boost::signals2::signal<void(BigSegmentStoreStatus)> status_signal_;
 
@@ -0,0 +1,42 @@
+#include "compact_membership.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace launchdarkly::server_side::data_components {
+
+CompactMembership::CompactMembership(
+    std::vector<std::pair<SegmentRefId, bool>> const& entries) {
+    entries_.reserve(entries.size());
+    for (auto const& [id, included] : entries) {
+        entries_.push_back(id << 1 | (included ? 1 : 0));
+    }
+    // Within an ID the included entry sorts last, so keeping the last of each
+    // run of equal IDs makes inclusion win.
+    std::sort(entries_.begin(), entries_.end());
+    auto out = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        auto const next = std::next(it);
+        if (next == entries_.end() || (*next >> 1) != (*it >> 1)) {
+            *out++ = *it;
+        }
+    }
+    entries_.erase(out, entries_.end());
+    entries_.shrink_to_fit();
+}
+
+std::optional<bool> CompactMembership::CheckMembership(
+    SegmentRefId const id) const {
+    auto const it =
+        std::lower_bound(entries_.begin(), entries_.end(), id << 1);
+    if (it == entries_.end() || (*it >> 1) != id) {
+        return std::nullopt;
+    }
+    return (*it & 1) != 0;
+}
+
+std::size_t CompactMembership::Size() const {
+    return entries_.size();
+}
+
+}  // namespace launchdarkly::server_side::data_components
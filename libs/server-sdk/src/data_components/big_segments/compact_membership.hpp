@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace launchdarkly::server_side::data_components {
+
+/**
+ * @brief Identifier of a Big Segment ref (`<segmentKey>.g<generation>`),
+ * assigned by @ref SegmentRefInterner.
+ */
+using SegmentRefId = std::uint32_t;
+
+/**
+ * @brief The SDK's internal form of a context's Big Segments membership.
+ *
+ * Where @ref integrations::Membership maps segment-ref strings to their state,
+ * this holds a sorted array of interned segment-ref IDs with the membership
+ * state packed into the low bit, so that a cached membership takes a few bytes
+ * per segment and @ref CheckMembership is an allocation-free binary search.
+ *
+ * Immutable once constructed.
+ */
+class CompactMembership {
+   public:
+    /**
+     * @brief Constructs an empty membership.
+     */
+    CompactMembership() = default;
+
+    /**
+     * @param entries Pairs of segment-ref ID and whether the context is
+     * included in that segment (true) or excluded from it (false), in any
+     * order. If an ID appears more than once, inclusion wins.
+     */
+    explicit CompactMembership(
+        std::vector<std::pair<SegmentRefId, bool>> const& entries);
+
+    /**
+     * @return `true` if the context is included, `false` if excluded, and
+     * `std::nullopt` if the segment ref has no entry in this membership.
+     */
+    [[nodiscard]] std::optional<bool> CheckMembership(SegmentRefId id) const;
+
+    /**
+     * @return The number of segment refs with an entry.
+     */
+    [[nodiscard]] std::size_t Size() const;
+
+   private:
+    // (id << 1) | included, sorted and unique by id. IDs therefore fit in
+    // 31 bits, which SegmentRefInterner guarantees.
+    std::vector<std::uint32_t> entries_;
+};
+
+}  // namespace launchdarkly::server_side::data_components
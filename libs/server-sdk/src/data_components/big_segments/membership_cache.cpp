@@ -1,70 +1,154 @@
 #include "membership_cache.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <utility>
 
 namespace launchdarkly::server_side::data_components {
 
+// Shards are only added while each can hold at least kMinShardCapacity
+// entries, so that eviction within a shard stays a good approximation of
+// eviction across the whole cache.
+static constexpr std::size_t kMaxShards = 16;
+static constexpr std::size_t kMinShardCapacity = 64;
+
+MembershipCache::Shard::Shard(std::size_t const capacity)
+    : slots(std::make_unique<Slot[]>(capacity)), capacity(capacity) {
+    free.reserve(capacity);
+    // Fill from the front of the ring, so the hand first sweeps the oldest
+    // entries.
+    for (std::size_t i = capacity; i > 0; i--) {
+        free.push_back(i - 1);
+    }
+    index.reserve(capacity);
+}
+
 MembershipCache::MembershipCache(
     std::size_t capacity,
     std::chrono::milliseconds ttl,
     std::function<std::chrono::steady_clock::time_point()> clock)
-    : capacity_(capacity), ttl_(ttl), clock_(std::move(clock)) {}
+    : ttl_(ttl), clock_(std::move(clock)) {
+    std::size_t const shard_count = std::clamp<std::size_t>(
+        capacity / kMinShardCapacity, 1, kMaxShards);
+    shards_.reserve(shard_count);
+    for (std::size_t i = 0; i < shard_count; i++) {
+        // Spread the remainder so the shards' capacities sum to capacity.
+        shards_.push_back(std::make_unique<Shard>(
+            capacity / shard_count + (i < capacity % shard_count ? 1 : 0)));
+    }
+}
 
-std::optional<integrations::Membership> MembershipCache::Get(
+std::shared_ptr<CompactMembership const> MembershipCache::Get(
     std::string const& key) {
-    std::lock_guard lock(mutex_);
+    auto& shard = ShardFor(key);
+    auto const now = clock_();
 
-    auto const it = entries_.find(key);
-    if (it == entries_.end()) {
-        return std::nullopt;
-    }
+    {
+        std::shared_lock lock(shard.mutex);
 
-    if (clock_() >= it->second.expires_at) {
-        recency_.erase(it->second.recency_position);
-        entries_.erase(it);
-        return std::nullopt;
+        auto const it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return nullptr;
+        }
+
+        auto& slot = shard.slots[it->second];
+        if (now < slot.expires_at) {
+            // Avoid dirtying the cache line when the bit is already set.
+            if (!slot.referenced.load(std::memory_order_relaxed)) {
+                slot.referenced.store(true, std::memory_order_relaxed);
+            }
+            return slot.membership;
+        }
     }
 
-    // Move to front as most-recently-used.
-    recency_.splice(recency_.begin(), recency_, it->second.recency_position);
-    return it->second.membership;
+    // The entry has expired. Another thread may have replaced it since the
+    // shared lock was released, so check again before removing it.
+    std::unique_lock lock(shard.mutex);
+    auto const it = shard.index.find(key);
+    if (it != shard.index.end() &&
+        now >= shard.slots[it->second].expires_at) {
+        Erase(shard, it->second);
+    }
+    return nullptr;
 }
 
 void MembershipCache::Set(std::string const& key,
-                          integrations::Membership membership) {
-    std::lock_guard lock(mutex_);
-
-    auto const expires_at = clock_() + ttl_;
-
-    auto const it = entries_.find(key);
-    if (it != entries_.end()) {
-        recency_.splice(recency_.begin(), recency_,
-                        it->second.recency_position);
-        it->second.membership = std::move(membership);
-        it->second.expires_at = expires_at;
+                          std::shared_ptr<CompactMembership const> membership) {
+    auto& shard = ShardFor(key);
+    if (shard.capacity == 0) {
         return;
     }
 
-    recency_.push_front(key);
-    entries_.emplace(
-        key, Entry{recency_.begin(), std::move(membership), expires_at});
+    auto const expires_at = clock_() + ttl_;
 
-    if (entries_.size() > capacity_) {
-        auto const& lru_key = recency_.back();
-        entries_.erase(lru_key);
-        recency_.pop_back();
+    std::unique_lock lock(shard.mutex);
+
+    std::size_t position;
+    if (auto const it = shard.index.find(key); it != shard.index.end()) {
+        position = it->second;
+    } else {
+        if (shard.free.empty()) {
+            Erase(shard, Evict(shard));
+        }
+        position = shard.free.back();
+        shard.free.pop_back();
+        shard.index.emplace(key, position);
+        shard.slots[position].key = key;
     }
+
+    auto& slot = shard.slots[position];
+    slot.membership = std::move(membership);
+    slot.expires_at = expires_at;
+    slot.referenced.store(false, std::memory_order_relaxed);
 }
 
 void MembershipCache::Clear() {
-    std::lock_guard lock(mutex_);
-    entries_.clear();
-    recency_.clear();
+    for (auto& shard : shards_) {
+        std::unique_lock lock(shard->mutex);
+        while (!shard->index.empty()) {
+            Erase(*shard, shard->index.begin()->second);
+        }
+    }
 }
 
 std::size_t MembershipCache::Size() const {
-    std::lock_guard lock(mutex_);
-    return entries_.size();
+    std::size_t size = 0;
+    for (auto const& shard : shards_) {
+        std::shared_lock lock(shard->mutex);
+        size += shard->index.size();
+    }
+    return size;
+}
+
+MembershipCache::Shard& MembershipCache::ShardFor(
+    std::string const& key) const {
+    if (shards_.size() == 1) {
+        return *shards_.front();
+    }
+    // Use the high bits, since each shard's index consumes the low ones.
+    auto const hash = std::hash<std::string>{}(key);
+    return *shards_[(hash >> (sizeof(hash) * 4)) % shards_.size()];
+}
+
+std::size_t MembershipCache::Evict(Shard& shard) {
+    while (true) {
+        auto const position = shard.hand;
+        shard.hand = (shard.hand + 1) % shard.capacity;
+        auto& slot = shard.slots[position];
+        if (!slot.referenced.load(std::memory_order_relaxed)) {
+            return position;
+        }
+        slot.referenced.store(false, std::memory_order_relaxed);
+    }
+}
+
+void MembershipCache::Erase(Shard& shard, std::size_t const slot) {
+    auto& entry = shard.slots[slot];
+    shard.index.erase(entry.key);
+    entry.key.clear();
+    entry.membership.reset();
+    entry.referenced.store(false, std::memory_order_relaxed);
+    shard.free.push_back(slot);
 }
 
 }  // namespace launchdarkly::server_side::data_components
@@ -1,15 +1,16 @@
 #pragma once
 
-#include <launchdarkly/server_side/integrations/big_segments/big_segment_store_types.hpp>
+#include "compact_membership.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <functional>
-#include <list>
-#include <mutex>
-#include <optional>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace launchdarkly::server_side::data_components {
 
@@ -18,23 +19,29 @@ namespace launchdarkly::server_side::data_components {
  * by the unhashed context key.
  *
  * The cache holds at most a fixed number of entries; inserting beyond that
- * evicts the least-recently-used entry. Each entry also has a time-to-live.
+ * evicts an entry which has not been read recently, chosen by the CLOCK
+ * approximation of LRU. Each entry also has a time-to-live.
+ *
+ * Entries are spread across independent shards by key hash, each with its own
+ * lock, so that evaluations on many threads don't contend on a single mutex.
+ * A read hit takes its shard's lock in shared mode and only sets the entry's
+ * atomic reference bit, so concurrent hits never block one another. Small
+ * caches use a single shard, where eviction order is exactly CLOCK.
  *
  * Expiration is lazy — there is no background reaper. An expired entry is
  * detected and dropped only when @ref Get is next called for its key (reported
  * as a miss). Until then it keeps occupying a slot, counts toward @ref Size,
- * and is eligible for normal LRU eviction like any live entry. The cache never
+ * and is eligible for normal eviction like any live entry. The cache never
  * exceeds its capacity regardless, because @ref Set evicts on insert.
  *
- * Thread-safe: every method is guarded by an internal mutex and may be called
- * concurrently. Concurrent-load deduplication (querying the store once when
- * several callers miss the same key at once) is not handled here; that is the
- * caller's responsibility.
+ * Thread-safe: every method may be called concurrently. Concurrent-load
+ * deduplication (querying the store once when several callers miss the same
+ * key at once) is not handled here; that is the caller's responsibility.
  */
 class MembershipCache {
    public:
     /**
-     * @param capacity Maximum number of entries retained before LRU eviction.
+     * @param capacity Maximum number of entries retained before eviction.
      * @param ttl How long an entry remains valid after insertion.
      * @param clock Source of the current time, injectable for testing.
      * Defaults to the steady clock.
@@ -47,19 +54,21 @@ class MembershipCache {
         });
 
     /**
-     * @brief Returns the cached membership for a context key, or nullopt if the
-     * key is absent or its entry has expired. A hit refreshes the entry's LRU
-     * recency but not its expiration; an expired entry is removed.
+     * @brief Returns the cached membership for a context key, or nullptr if
+     * the key is absent or its entry has expired. A hit marks the entry as
+     * recently used but does not refresh its expiration; an expired entry is
+     * removed.
      */
-    [[nodiscard]] std::optional<integrations::Membership> Get(
+    [[nodiscard]] std::shared_ptr<CompactMembership const> Get(
         std::string const& key);
 
     /**
      * @brief Inserts or replaces the membership for a context key, marking it
-     * most-recently-used and resetting its expiration. Evicts the least-
-     * recently-used entry if this pushes the cache over capacity.
+     * recently used and resetting its expiration. Evicts an entry if this
+     * pushes the key's shard over capacity.
      */
-    void Set(std::string const& key, integrations::Membership membership);
+    void Set(std::string const& key,
+             std::shared_ptr<CompactMembership const> membership);
 
     /**
      * @brief Removes all entries.
@@ -73,21 +82,44 @@ class MembershipCache {
     [[nodiscard]] std::size_t Size() const;
 
    private:
-    struct Entry {
-        // Position of this key in recency_, for O(1) LRU updates.
-        std::list<std::string>::iterator recency_position;
-        integrations::Membership membership;
+    struct Slot {
+        std::string key;
+        // nullptr while the slot is free.
+        std::shared_ptr<CompactMembership const> membership;
         std::chrono::steady_clock::time_point expires_at;
+        // Set by reads, cleared by the CLOCK hand as it passes.
+        std::atomic<bool> referenced{false};
+    };
+
+    struct Shard {
+        explicit Shard(std::size_t capacity);
+
+        // Readers of index and slot contents hold this shared; anything which
+        // changes them holds it exclusively. Reference bits are atomic, so
+        // readers may set them under the shared lock.
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::size_t> index;
+        // Fixed-size ring of slots swept by the CLOCK hand.
+        std::unique_ptr<Slot[]> slots;
+        std::size_t const capacity;
+        // Indices of unoccupied slots.
+        std::vector<std::size_t> free;
+        std::size_t hand = 0;
     };
 
-    std::size_t const capacity_;
+    Shard& ShardFor(std::string const& key) const;
+
+    // Frees a slot by advancing the CLOCK hand past referenced entries until it
+    // reaches one which hasn't been read since the hand last passed it.
+    // Requires the shard's exclusive lock.
+    static std::size_t Evict(Shard& shard);
+
+    static void Erase(Shard& shard, std::size_t slot);
+
     std::chrono::milliseconds const ttl_;
     std::function<std::chrono::steady_clock::time_point()> const clock_;
 
-    mutable std::mutex mutex_;
-    // Most-recently-used at the front, least at the back. Protected by mutex_.
-    std::list<std::string> recency_;
-    std::unordered_map<std::string, Entry> entries_;
+    std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 }  // namespace launchdarkly::server_side::data_components
@@ -0,0 +1,109 @@
+#include "segment_ref_interner.hpp"
+
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace launchdarkly::server_side::data_components {
+
+// CompactMembership packs an ID and a flag into 32 bits.
+static constexpr std::size_t kMaxIds = std::size_t{1} << 31;
+
+// Longer generations could overflow; the SDK never forms such a ref.
+static constexpr std::size_t kMaxGenerationDigits = 19;
+
+std::optional<SegmentRefId> SegmentRefInterner::Find(
+    std::string const& segment_key,
+    std::uint64_t const generation) const {
+    std::shared_lock lock(mutex_);
+    auto const it = ids_.find(Ref{segment_key, generation});
+    if (it == ids_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+CompactMembership SegmentRefInterner::Compact(
+    integrations::Membership const& membership) {
+    std::vector<std::pair<Ref, bool>> refs;
+    membership.ForEachSegmentRef(
+        [&refs](std::string const& segment_ref, bool const included) {
+            if (auto ref = Parse(segment_ref)) {
+                refs.emplace_back(*ref, included);
+            }
+        });
+
+    std::vector<std::pair<SegmentRefId, bool>> entries;
+    entries.reserve(refs.size());
+    bool all_known = true;
+    {
+        std::shared_lock lock(mutex_);
+        for (auto const& [ref, included] : refs) {
+            auto const it = ids_.find(ref);
+            if (it == ids_.end()) {
+                all_known = false;
+                break;
+            }
+            entries.emplace_back(it->second, included);
+        }
+    }
+
+    // Almost always every ref is known already; only take the exclusive lock
+    // when there is something to intern.
+    if (!all_known) {
+        entries.clear();
+        std::unique_lock lock(mutex_);
+        for (auto const& [ref, included] : refs) {
+            if (ids_.size() >= kMaxIds && ids_.find(ref) == ids_.end()) {
+                continue;
+            }
+            entries.emplace_back(InternLocked(ref), included);
+        }
+    }
+
+    return CompactMembership(entries);
+}
+
+std::size_t SegmentRefInterner::Size() const {
+    std::shared_lock lock(mutex_);
+    return ids_.size();
+}
+
+std::size_t SegmentRefInterner::RefHash::operator()(Ref const& ref) const {
+    return std::hash<std::string_view>{}(ref.segment_key) ^
+           (std::hash<std::uint64_t>{}(ref.generation) * 0x9E3779B97F4A7C15ULL);
+}
+
+std::optional<SegmentRefInterner::Ref> SegmentRefInterner::Parse(
+    std::string const& segment_ref) {
+    auto const separator = segment_ref.rfind(".g");
+    if (separator == std::string::npos ||
+        separator + 2 == segment_ref.size() ||
+        segment_ref.size() - separator - 2 > kMaxGenerationDigits) {
+        return std::nullopt;
+    }
+
+    std::uint64_t generation = 0;
+    for (auto i = separator + 2; i < segment_ref.size(); i++) {
+        char const c = segment_ref[i];
+        if (c < '0' || c > '9') {
+            return std::nullopt;
+        }
+        generation = generation * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+
+    return Ref{std::string_view(segment_ref).substr(0, separator), generation};
+}
+
+SegmentRefId SegmentRefInterner::InternLocked(Ref const& ref) {
+    if (auto const it = ids_.find(ref); it != ids_.end()) {
+        return it->second;
+    }
+    auto const& owned_key = segment_keys_.emplace_back(ref.segment_key);
+    auto const id = static_cast<SegmentRefId>(ids_.size());
+    ids_.emplace(Ref{owned_key, ref.generation}, id);
+    return id;
+}
+
+}  // namespace launchdarkly::server_side::data_components
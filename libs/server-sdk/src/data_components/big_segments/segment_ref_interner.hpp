@@ -0,0 +1,87 @@
+#pragma once
+
+#include "compact_membership.hpp"
+
+#include <launchdarkly/server_side/integrations/big_segments/big_segment_store_types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace launchdarkly::server_side::data_components {
+
+/**
+ * @brief Assigns each Big Segment ref (`<segmentKey>.g<generation>`) a small
+ * integer ID, so that memberships can be stored and checked without strings.
+ *
+ * Refs are interned as memberships arrive from the store (see @ref Compact).
+ * The evaluator then looks up a segment's ID by key and generation with
+ * @ref Find, which never allocates. A ref which has never been interned cannot
+ * appear in any compacted membership, so a failed lookup means "no entry".
+ *
+ * IDs are never reclaimed. The number of distinct refs is bounded by the
+ * number of Big Segment generations the store has reported, which is small.
+ *
+ * Thread-safe: @ref Find takes a shared lock and may run concurrently with
+ * other lookups.
+ */
+class SegmentRefInterner {
+   public:
+    /**
+     * @return The ID of the ref for the given segment key and generation, or
+     * nullopt if no membership has mentioned it.
+     */
+    [[nodiscard]] std::optional<SegmentRefId> Find(
+        std::string const& segment_key,
+        std::uint64_t generation) const;
+
+    /**
+     * @brief Converts a membership reported by the store into its compact
+     * form, interning any refs not seen before. Refs which aren't of the form
+     * `<segmentKey>.g<generation>` can never be checked by the evaluator and
+     * are dropped.
+     */
+    [[nodiscard]] CompactMembership Compact(
+        integrations::Membership const& membership);
+
+    /**
+     * @return The number of distinct refs interned.
+     */
+    [[nodiscard]] std::size_t Size() const;
+
+   private:
+    struct Ref {
+        // Views a string owned by segment_keys_.
+        std::string_view segment_key;
+        std::uint64_t generation;
+
+        bool operator==(Ref const& other) const {
+            return generation == other.generation &&
+                   segment_key == other.segment_key;
+        }
+    };
+
+    struct RefHash {
+        std::size_t operator()(Ref const& ref) const;
+    };
+
+    // Splits "<segmentKey>.g<generation>", or returns nullopt if malformed.
+    // The returned view points into segment_ref.
+    [[nodiscard]] static std::optional<Ref> Parse(
+        std::string const& segment_ref);
+
+    // Requires the exclusive lock.
+    SegmentRefId InternLocked(Ref const& ref);
+
+    mutable std::shared_mutex mutex_;
+    // Owns the keys viewed by ids_; a deque never moves its elements.
+    std::deque<std::string> segment_keys_;
+    std::unordered_map<Ref, SegmentRefId, RefHash> ids_;
+};
+
+}  // namespace launchdarkly::server_side::data_components
@@ -0,0 +1,315 @@
+#include "bounded_cache_policy.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace launchdarkly::server_side::data_components {
+
+// Share of the bounds given to the admission window. The remainder forms the
+// main area, of which kProtectedPercent is reserved for the protected segment.
+static constexpr std::size_t kWindowPercent = 1;
+static constexpr std::size_t kProtectedPercent = 80;
+
+static constexpr std::size_t kSketchRows = 4;
+static constexpr std::uint8_t kSketchMaxCount = 15;
+static constexpr std::size_t kSketchMinWidth = 64;
+static constexpr std::size_t kSketchMaxWidth = std::size_t{1} << 22;
+// When only a byte bound is given, the sketch is sized assuming items of
+// roughly this size.
+static constexpr std::size_t kSketchAssumedItemBytes = 512;
+
+static constexpr std::size_t kUnbounded = std::numeric_limits<std::size_t>::max();
+
+static std::size_t Percent(std::size_t const bound, std::size_t const percent) {
+    if (bound == kUnbounded) {
+        return kUnbounded;
+    }
+    return bound / 100 * percent + bound % 100 * percent / 100;
+}
+
+static std::size_t OrUnbounded(std::size_t const bound) {
+    return bound == 0 ? kUnbounded : bound;
+}
+
+static std::size_t Subtract(std::size_t const bound, std::size_t const amount) {
+    return bound == kUnbounded ? kUnbounded : bound - amount;
+}
+
+BoundedCachePolicy::BoundedCachePolicy(std::size_t const max_items,
+                                       std::size_t const max_bytes)
+    : total_budget_{OrUnbounded(max_items), OrUnbounded(max_bytes)},
+      window_budget_{std::max<std::size_t>(
+                         1, Percent(OrUnbounded(max_items), kWindowPercent)),
+                     std::max<std::size_t>(
+                         1, Percent(OrUnbounded(max_bytes), kWindowPercent))},
+      main_budget_{
+          Subtract(OrUnbounded(max_items),
+                   std::min(window_budget_.items, OrUnbounded(max_items))),
+          Subtract(OrUnbounded(max_bytes),
+                   std::min(window_budget_.bytes, OrUnbounded(max_bytes)))},
+      protected_budget_{Percent(main_budget_.items, kProtectedPercent),
+                        Percent(main_budget_.bytes, kProtectedPercent)},
+      sketch_(max_items != 0 ? max_items
+                             : max_bytes / kSketchAssumedItemBytes),
+      evictions_(0) {}
+
+void BoundedCachePolicy::Access(DataKind const kind, std::string const& key) {
+    std::lock_guard lock(mutex_);
+
+    Key const lookup{kind, key};
+    auto const it = entries_.find(lookup);
+    if (it == entries_.end()) {
+        return;
+    }
+    sketch_.Increment(KeyHash{}(lookup));
+
+    auto& entry = it->second;
+    switch (entry.segment) {
+        case Segment::kWindow:
+        case Segment::kProtected:
+            MoveTo(entry, entry.segment);
+            break;
+        case Segment::kProbation:
+            // A second access proves the item is part of the working set.
+            MoveTo(entry, Segment::kProtected);
+            DemoteFromProtected();
+            break;
+    }
+}
+
+std::vector<BoundedCachePolicy::Key> BoundedCachePolicy::Insert(
+    DataKind const kind,
+    std::string const& key,
+    std::size_t const bytes) {
+    std::lock_guard lock(mutex_);
+
+    std::vector<Key> evicted;
+
+    Key new_key{kind, key};
+    sketch_.Increment(KeyHash{}(new_key));
+
+    if (auto const it = entries_.find(new_key); it != entries_.end()) {
+        // The item was refreshed; account for its new size. If it grew enough
+        // to exceed its segment's bounds it will be dealt with by the normal
+        // flow of evictions from the window and main area below.
+        auto& entry = it->second;
+        auto& usage = UsageOf(entry.segment);
+        usage.bytes = usage.bytes - entry.bytes + bytes;
+        entry.bytes = bytes;
+        MoveTo(entry, entry.segment);
+    } else {
+        window_.push_front(new_key);
+        entries_.emplace(std::move(new_key),
+                         Entry{bytes, Segment::kWindow, window_.begin()});
+        window_usage_.items++;
+        window_usage_.bytes += bytes;
+    }
+
+    EvictFromWindow(evicted);
+    DemoteFromProtected();
+
+    // The window may exceed its share of the bounds to hold the newest item,
+    // so the main area gives up the difference.
+    Usage usage{
+        window_usage_.items + probation_usage_.items + protected_usage_.items,
+        window_usage_.bytes + probation_usage_.bytes + protected_usage_.bytes};
+    while (Exceeds(usage, total_budget_)) {
+        auto& victims = !probation_.empty() ? probation_ : protected_;
+        if (victims.empty() || victims.back() == Key{kind, key}) {
+            break;
+        }
+        auto const victim = entries_.find(victims.back());
+        usage.items--;
+        usage.bytes -= victim->second.bytes;
+        evicted.push_back(victim->first);
+        Erase(victim);
+        evictions_++;
+    }
+
+    return evicted;
+}
+
+void BoundedCachePolicy::Remove(DataKind const kind, std::string const& key) {
+    std::lock_guard lock(mutex_);
+    if (auto const it = entries_.find(Key{kind, key}); it != entries_.end()) {
+        Erase(it);
+    }
+}
+
+BoundedCachePolicy::Stats BoundedCachePolicy::GetStats() const {
+    std::lock_guard lock(mutex_);
+    return Stats{
+        window_usage_.items + probation_usage_.items + protected_usage_.items,
+        window_usage_.bytes + probation_usage_.bytes + protected_usage_.bytes,
+        evictions_};
+}
+
+void BoundedCachePolicy::EvictFromWindow(std::vector<Key>& evicted) {
+    // The most recently inserted item is never moved out of the window, so
+    // that it remains resident for the caller which inserted it.
+    while (Exceeds(window_usage_, window_budget_) && window_.size() > 1) {
+        auto const candidate = entries_.find(window_.back());
+        auto const candidate_frequency =
+            sketch_.Estimate(KeyHash{}(candidate->first));
+
+        bool admit = true;
+        while (!Fits(Usage{probation_usage_.items + protected_usage_.items,
+                           probation_usage_.bytes + protected_usage_.bytes},
+                     candidate->second.bytes, main_budget_)) {
+            auto& victims = !probation_.empty() ? probation_ : protected_;
+            if (victims.empty()) {
+                // The candidate is larger than the whole main area.
+                admit = false;
+                break;
+            }
+            auto const victim = entries_.find(victims.back());
+            if (candidate_frequency <=
+                sketch_.Estimate(KeyHash{}(victim->first))) {
+                admit = false;
+                break;
+            }
+            evicted.push_back(victim->first);
+            Erase(victim);
+            evictions_++;
+        }
+
+        if (admit) {
+            MoveTo(candidate->second, Segment::kProbation);
+        } else {
+            evicted.push_back(candidate->first);
+            Erase(candidate);
+            evictions_++;
+        }
+    }
+}
+
+void BoundedCachePolicy::DemoteFromProtected() {
+    while (Exceeds(protected_usage_, protected_budget_) &&
+           protected_.size() > 1) {
+        MoveTo(entries_.find(protected_.back())->second, Segment::kProbation);
+    }
+}
+
+void BoundedCachePolicy::MoveTo(Entry& entry, Segment const segment) {
+    auto& from = List(entry.segment);
+    auto& to = List(segment);
+    to.splice(to.begin(), from, entry.position);
+    if (segment != entry.segment) {
+        auto& from_usage = UsageOf(entry.segment);
+        auto& to_usage = UsageOf(segment);
+        from_usage.items--;
+        from_usage.bytes -= entry.bytes;
+        to_usage.items++;
+        to_usage.bytes += entry.bytes;
+        entry.segment = segment;
+    }
+}
+
+void BoundedCachePolicy::Erase(
+    std::unordered_map<Key, Entry, KeyHash>::iterator const it) {
+    auto& usage = UsageOf(it->second.segment);
+    usage.items--;
+    usage.bytes -= it->second.bytes;
+    List(it->second.segment).erase(it->second.position);
+    entries_.erase(it);
+}
+
+std::list<BoundedCachePolicy::Key>& BoundedCachePolicy::List(
+    Segment const segment) {
+    switch (segment) {
+        case Segment::kWindow:
+            return window_;
+        case Segment::kProbation:
+            return probation_;
+        case Segment::kProtected:
+            return protected_;
+    }
+    return window_;
+}
+
+BoundedCachePolicy::Usage& BoundedCachePolicy::UsageOf(Segment const segment) {
+    switch (segment) {
+        case Segment::kWindow:
+            return window_usage_;
+        case Segment::kProbation:
+            return probation_usage_;
+        case Segment::kProtected:
+            return protected_usage_;
+    }
+    return window_usage_;
+}
+
+bool BoundedCachePolicy::Exceeds(Usage const& usage, Budget const& budget) {
+    return usage.items > budget.items || usage.bytes > budget.bytes;
+}
+
+bool BoundedCachePolicy::Fits(Usage const& usage,
+                              std::size_t const bytes,
+                              Budget const& budget) {
+    return usage.items < budget.items && bytes <= budget.bytes &&
+           usage.bytes <= budget.bytes - bytes;
+}
+
+std::size_t BoundedCachePolicy::KeyHash::operator()(Key const& key) const {
+    auto const kind =
+        static_cast<std::underlying_type_t<DataKind>>(key.first);
+    return std::hash<std::string>{}(key.second) ^
+           (static_cast<std::size_t>(kind) * 0x9E3779B97F4A7C15ULL);
+}
+
+BoundedCachePolicy::FrequencySketch::FrequencySketch(
+    std::size_t const expected_items)
+    : additions_(0) {
+    std::size_t width = kSketchMinWidth;
+    while (width < expected_items && width < kSketchMaxWidth) {
+        width <<= 1;
+    }
+    counters_.assign(width * kSketchRows, 0);
+    mask_ = width - 1;
+    sample_size_ = width * 10;
+}
+
+void BoundedCachePolicy::FrequencySketch::Increment(std::size_t const hash) {
+    bool incremented = false;
+    for (std::size_t row = 0; row < kSketchRows; row++) {
+        auto& counter = counters_[Index(hash, row)];
+        if (counter < kSketchMaxCount) {
+            counter++;
+            incremented = true;
+        }
+    }
+    if (incremented && ++additions_ >= sample_size_) {
+        Reset();
+    }
+}
+
+std::uint8_t BoundedCachePolicy::FrequencySketch::Estimate(
+    std::size_t const hash) const {
+    std::uint8_t estimate = kSketchMaxCount;
+    for (std::size_t row = 0; row < kSketchRows; row++) {
+        estimate = std::min(estimate, counters_[Index(hash, row)]);
+    }
+    return estimate;
+}
+
+std::size_t BoundedCachePolicy::FrequencySketch::Index(
+    std::size_t const hash,
+    std::size_t const row) const {
+    static constexpr std::uint64_t kSeeds[kSketchRows] = {
+        0xC3A5C85C97CB3127ULL, 0xB492B66FBE98F273ULL, 0x9AE16A3B2F90404FULL,
+        0xCBF29CE484222325ULL};
+    auto mixed = (static_cast<std::uint64_t>(hash) + kSeeds[row]) * kSeeds[row];
+    mixed ^= mixed >> 32;
+    return row * (mask_ + 1) + (static_cast<std::size_t>(mixed) & mask_);
+}
+
+void BoundedCachePolicy::FrequencySketch::Reset() {
+    for (auto& counter : counters_) {
+        counter >>= 1;
+    }
+    additions_ /= 2;
+}
+
+}  // namespace launchdarkly::server_side::data_components
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "../dependency_tracker/data_kind.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace launchdarkly::server_side::data_components {
+
+/**
+ * @brief Decides which items a size-bounded cache retains, using the
+ * W-TinyLFU policy.
+ *
+ * The policy tracks keys and their approximate sizes only; the items
+ * themselves live elsewhere (for example in a MemoryStore), and the caller
+ * removes the keys reported as evicted.
+ *
+ * New items always enter a small LRU "window", so an item is resident
+ * immediately after it is inserted. When the window overflows, its least
+ * recently used item becomes a candidate for the main area, which is a
+ * segmented LRU (probation and protected segments). The candidate is admitted
+ * only if it has been accessed more often than the main area's victim, as
+ * estimated by a decaying count-min sketch; otherwise the candidate is
+ * evicted. This keeps one-off scans (such as loading every flag in a sparse
+ * environment) from flushing the working set.
+ *
+ * The cache may be bounded by item count, by approximate bytes, or both; a
+ * bound of zero means unbounded in that dimension.
+ *
+ * Thread-safe: every method is guarded by an internal mutex.
+ */
+class BoundedCachePolicy {
+   public:
+    using Key = std::pair<DataKind, std::string>;
+
+    struct Stats {
+        std::size_t items;
+        std::size_t bytes;
+        // Items removed to make room, including candidates that were not
+        // admitted to the main area.
+        std::uint64_t evictions;
+    };
+
+    /**
+     * @param max_items Maximum number of items, or 0 for no limit.
+     * @param max_bytes Maximum approximate size of all items, or 0 for no
+     * limit.
+     */
+    BoundedCachePolicy(std::size_t max_items, std::size_t max_bytes);
+
+    /**
+     * @brief Records an access to a resident key, updating its frequency and
+     * recency. Does nothing if the key isn't resident.
+     */
+    void Access(DataKind kind, std::string const& key);
+
+    /**
+     * @brief Inserts a key, or updates the size of a resident key.
+     * @return Keys which must be evicted to respect the bounds. Never contains
+     * the inserted key, so an item larger than the byte bound is resident
+     * until the next insertion.
+     */
+    [[nodiscard]] std::vector<Key> Insert(DataKind kind,
+                                          std::string const& key,
+                                          std::size_t bytes);
+
+    /**
+     * @brief Stops tracking a key.
+     */
+    void Remove(DataKind kind, std::string const& key);
+
+    [[nodiscard]] Stats GetStats() const;
+
+   private:
+    enum class Segment { kWindow, kProbation, kProtected };
+
+    struct Budget {
+        std::size_t items;
+        std::size_t bytes;
+    };
+
+    struct Usage {
+        std::size_t items = 0;
+        std::size_t bytes = 0;
+    };
+
+    struct Entry {
+        std::size_t bytes;
+        Segment segment;
+        // Position of this key in its segment's list, for O(1) LRU updates.
+        std::list<Key>::iterator position;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    // Count-min sketch of access frequencies, with 4-bit saturating counters
+    // which are halved periodically so that old popularity decays.
+    class FrequencySketch {
+       public:
+        explicit FrequencySketch(std::size_t expected_items);
+        void Increment(std::size_t hash);
+        [[nodiscard]] std::uint8_t Estimate(std::size_t hash) const;
+
+       private:
+        [[nodiscard]] std::size_t Index(std::size_t hash, std::size_t row) const;
+        void Reset();
+
+        std::vector<std::uint8_t> counters_;
+        std::size_t mask_;
+        std::size_t additions_;
+        std::size_t sample_size_;
+    };
+
+    [[nodiscard]] static bool Exceeds(Usage const& usage, Budget const& budget);
+    [[nodiscard]] static bool Fits(Usage const& usage,
+                                   std::size_t bytes,
+                                   Budget const& budget);
+
+    std::list<Key>& List(Segment segment);
+    Usage& UsageOf(Segment segment);
+    Budget const& BudgetOf(Segment segment) const;
+
+    void MoveTo(Entry& entry, Segment segment);
+    void Erase(std::unordered_map<Key, Entry, KeyHash>::iterator it);
+    void EvictFromWindow(std::vector<Key>& evicted);
+    void DemoteFromProtected();
+
+    Budget const total_budget_;
+    Budget const window_budget_;
+    Budget const main_budget_;
+    Budget const protected_budget_;
+
+    mutable std::mutex mutex_;
+    // Most-recently-used at the front of each list. Protected by mutex_.
+    std::list<Key> window_;
+    std::list<Key> probation_;
+    std::list<Key> protected_;
+    Usage window_usage_;
+    Usage probation_usage_;
+    Usage protected_usage_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    FrequencySketch sketch_;
+    std::uint64_t evictions_;
+};
+
+}  // namespace launchdarkly::server_side::data_components
@@ -0,0 +1,82 @@
+#include "item_size.hpp"
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace launchdarkly::server_side::data_components {
+
+static std::size_t SizeOf(std::string const& value) {
+    return sizeof(std::string) + value.size();
+}
+
+static std::size_t SizeOf(Value const& value) {
+    // Nested arrays and objects are counted only by their top level; flag
+    // variations are occasionally large JSON documents, and the string form
+    // dominates in practice.
+    return sizeof(Value) + (value.IsString() ? value.AsString().size() : 0);
+}
+
+static std::size_t SizeOf(std::vector<std::string> const& values) {
+    std::size_t size = sizeof(values);
+    for (auto const& value : values) {
+        size += SizeOf(value);
+    }
+    return size;
+}
+
+static std::size_t SizeOf(std::vector<data_model::Clause> const& clauses) {
+    std::size_t size = sizeof(clauses);
+    for (auto const& clause : clauses) {
+        size += sizeof(clause);
+        for (auto const& value : clause.values) {
+            size += SizeOf(value);
+        }
+    }
+    return size;
+}
+
+std::size_t ApproximateSize(data_model::FlagDescriptor const& flag) {
+    std::size_t size = sizeof(flag);
+    if (!flag.item) {
+        return size;
+    }
+    auto const& item = *flag.item;
+    size += sizeof(item) + item.key.size();
+    for (auto const& variation : item.variations) {
+        size += SizeOf(variation);
+    }
+    for (auto const& prerequisite : item.prerequisites) {
+        size += sizeof(prerequisite) + prerequisite.key.size();
+    }
+    for (auto const* targets : {&item.targets, &item.contextTargets}) {
+        for (auto const& target : *targets) {
+            size += sizeof(target) + SizeOf(target.values);
+        }
+    }
+    for (auto const& rule : item.rules) {
+        size += sizeof(rule) + SizeOf(rule.clauses);
+    }
+    return size;
+}
+
+std::size_t ApproximateSize(data_model::SegmentDescriptor const& segment) {
+    std::size_t size = sizeof(segment);
+    if (!segment.item) {
+        return size;
+    }
+    auto const& item = *segment.item;
+    size += sizeof(item) + item.key.size() + SizeOf(item.included) +
+            SizeOf(item.excluded);
+    for (auto const* targets : {&item.includedContexts, &item.excludedContexts}) {
+        for (auto const& target : *targets) {
+            size += sizeof(target) + SizeOf(target.values);
+        }
+    }
+    for (auto const& rule : item.rules) {
+        size += sizeof(rule) + SizeOf(rule.clauses);
+    }
+    return size;
+}
+
+}  // namespace launchdarkly::server_side::data_components
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <launchdarkly/data_model/descriptors.hpp>
+
+#include <cstddef>
+
+namespace launchdarkly::server_side::data_components {
+
+/**
+ * @brief Estimates the memory held by a flag, for enforcing byte bounds on
+ * caches. The estimate accounts for the flag's structure and the variable-
+ * length data it contains (keys, variations, targets, clause values), but not
+ * allocator overhead; it is intended to be proportionate rather than exact.
+ */
+[[nodiscard]] std::size_t ApproximateSize(
+    data_model::FlagDescriptor const& flag);
+
+/**
+ * @brief Estimates the memory held by a segment. See the flag overload.
+ */
+[[nodiscard]] std::size_t ApproximateSize(
+    data_model::SegmentDescriptor const& segment);
+
+}  // namespace launchdarkly::server_side::data_components
@@ -98,6 +98,17 @@ DependencyMap::end() const {
 
 void DependencyTracker::UpdateDependencies(
     std::string const& key,
+    data_model::FlagDescriptor const& flag) {
+    UpdateDependencies(DataKind::kFlag, key, Dependencies(flag));
+}
+
+void DependencyTracker::UpdateDependencies(
+    std::string const& key,
+    data_model::SegmentDescriptor const& segment) {
+    UpdateDependencies(DataKind::kSegment, key, Dependencies(segment));
+}
+
+DependencySet DependencyTracker::Dependencies(
     data_model::FlagDescriptor const& flag) {
     DependencySet dependencies;
     if (flag.item) {
@@ -109,11 +120,10 @@ void DependencyTracker::UpdateDependencies(
             CalculateClauseDeps(dependencies, rule.clauses);
         }
     }
-    UpdateDependencies(DataKind::kFlag, key, dependencies);
+    return dependencies;
 }
 
-void DependencyTracker::UpdateDependencies(
-    std::string const& key,
+DependencySet DependencyTracker::Dependencies(
     data_model::SegmentDescriptor const& segment) {
     DependencySet dependencies;
     if (segment.item) {
@@ -121,7 +131,7 @@ void DependencyTracker::UpdateDependencies(
             CalculateClauseDeps(dependencies, rule.clauses);
         }
     }
-    UpdateDependencies(DataKind::kSegment, key, dependencies);
+    return dependencies;
 }
 
 // Function intentionally uses recursion.
@@ -129,6 +129,25 @@ class DependencyTracker {
      */
     void Clear();
 
+    /**
+     * Determine the direct dependencies of a flag: its prerequisites, and the
+     * segments referenced by its rules.
+     *
+     * @param flag A descriptor for the flag.
+     * @return The flag's dependencies; empty if the flag is deleted.
+     */
+    static DependencySet Dependencies(data_model::FlagDescriptor const& flag);
+
+    /**
+     * Determine the direct dependencies of a segment: the segments referenced
+     * by its rules.
+     *
+     * @param segment A descriptor for the segment.
+     * @return The segment's dependencies; empty if the segment is deleted.
+     */
+    static DependencySet Dependencies(
+        data_model::SegmentDescriptor const& segment);
+
    private:
     /**
      * Common logic for dependency updates used for both flags and segments.
@@ -26,7 +26,15 @@ ExpirationTracker::TrackState ExpirationTracker::State(
 void ExpirationTracker::Add(DataKind kind,
                             std::string const& key,
                             TimePoint expiration) {
-    scoped_.Set(kind, key, expiration);
+    scoped_.Set(kind, key, ScopedTtl{expiration, 0});
+}
+
+void ExpirationTracker::AddExpiring(DataKind kind,
+                                    std::string const& key,
+                                    TimePoint expiration) {
+    auto const generation = ++last_generation_;
+    scoped_.Set(kind, key, ScopedTtl{expiration, generation});
+    expiring_.push(Expiring{expiration, kind, key, generation});
 }
 
 void ExpirationTracker::Remove(DataKind kind, std::string const& key) {
@@ -44,10 +52,16 @@ ExpirationTracker::TrackState ExpirationTracker::State(
     return TrackState::kNotTracked;
 }
 
+void ExpirationTracker::ExpireAll(DataKind kind, TimePoint expiration) {
+    scoped_.ExpireAll(kind, expiration);
+}
+
 void ExpirationTracker::Clear() {
     scoped_.Clear();
     unscoped_.clear();
+    expiring_ = {};
 }
+
 std::vector<std::pair<std::optional<DataKind>, std::string>>
 ExpirationTracker::Prune(TimePoint current_time) {
     std::vector<std::pair<std::optional<DataKind>, std::string>> pruned;
@@ -60,7 +74,8 @@ ExpirationTracker::Prune(TimePoint current_time) {
     }
     for (auto const& scope : scoped_) {
         for (auto const& item : scope.Data()) {
-            if (State(item.second, current_time) == TrackState::kStale) {
+            if (State(item.second.expiration, current_time) ==
+                TrackState::kStale) {
                 pruned.emplace_back(scope.Kind(), item.first);
             }
         }
@@ -76,6 +91,21 @@ ExpirationTracker::Prune(TimePoint current_time) {
     }
     return pruned;
 }
+
+std::size_t ExpirationTracker::PruneExpired(TimePoint current_time) {
+    std::size_t pruned = 0;
+    while (!expiring_.empty() &&
+           State(expiring_.top().expiration, current_time) ==
+               TrackState::kStale) {
+        auto const& top = expiring_.top();
+        if (scoped_.Remove(top.kind, top.key, top.generation)) {
+            pruned++;
+        }
+        expiring_.pop();
+    }
+    return pruned;
+}
+
 ExpirationTracker::TrackState ExpirationTracker::State(TimePoint expiration,
                                                        TimePoint current_time) {
     if (expiration > current_time) {
@@ -86,10 +116,10 @@ ExpirationTracker::TrackState ExpirationTracker::State(TimePoint expiration,
 
 void ExpirationTracker::ScopedTtls::Set(DataKind kind,
                                         std::string const& key,
-                                        TimePoint expiration) {
+                                        ScopedTtl ttl) {
     data_[static_cast<std::underlying_type_t<DataKind>>(kind)]
         .Data()
-        .insert_or_assign(key, expiration);
+        .insert_or_assign(key, ttl);
 }
 
 void ExpirationTracker::ScopedTtls::Remove(DataKind kind,
@@ -98,6 +128,29 @@ void ExpirationTracker::ScopedTtls::Remove(DataKind kind,
         key);
 }
 
+bool ExpirationTracker::ScopedTtls::Remove(DataKind kind,
+                                           std::string const& key,
+                                           std::uint64_t generation) {
+    auto& ttls =
+        data_[static_cast<std::underlying_type_t<DataKind>>(kind)].Data();
+    auto const found = ttls.find(key);
+    if (found == ttls.end() || found->second.generation != generation) {
+        return false;
+    }
+    ttls.erase(found);
+    return true;
+}
+
+void ExpirationTracker::ScopedTtls::ExpireAll(DataKind kind,
+                                              TimePoint expiration) {
+    for (auto& [key, current] :
+         data_[static_cast<std::underlying_type_t<DataKind>>(kind)].Data()) {
+        if (current.expiration > expiration) {
+            current.expiration = expiration;
+        }
+    }
+}
+
 void ExpirationTracker::ScopedTtls::Clear() {
     for (auto& scope : data_) {
         scope.Data().clear();
@@ -111,22 +164,22 @@ std::optional<ExpirationTracker::TimePoint> ExpirationTracker::ScopedTtls::Get(
         data_[static_cast<std::underlying_type_t<DataKind>>(kind)];
     auto found = scope.Data().find(key);
     if (found != scope.Data().end()) {
-        return found->second;
+        return found->second.expiration;
     }
     return std::nullopt;
 }
 ExpirationTracker::ScopedTtls::ScopedTtls()
     : data_{
-          TaggedData<TtlMap>(DataKind::kFlag),
-          TaggedData<TtlMap>(DataKind::kSegment),
+          TaggedData<ScopedTtlMap>(DataKind::kFlag),
+          TaggedData<ScopedTtlMap>(DataKind::kSegment),
       } {}
 
-std::array<TaggedData<ExpirationTracker::TtlMap>, 2>::iterator
+std::array<TaggedData<ExpirationTracker::ScopedTtlMap>, 2>::iterator
 ExpirationTracker::ScopedTtls::begin() {
     return data_.begin();
 }
 
-std::array<TaggedData<ExpirationTracker::TtlMap>, 2>::iterator
+std::array<TaggedData<ExpirationTracker::ScopedTtlMap>, 2>::iterator
 ExpirationTracker::ScopedTtls::end() {
     return data_.end();
 }
@@ -5,8 +5,11 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <ostream>
+#include <queue>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -88,6 +91,15 @@ class ExpirationTracker {
                      std::string const& key,
                      TimePoint current_time) const;
 
+    /**
+     * Bring forward the expiration of every tracked key of a kind, so that
+     * none expires later than the given time.
+     *
+     * @param kind The scope (kind) of the keys.
+     * @param expiration The latest time that the keys expire.
+     */
+    void ExpireAll(DataKind kind, TimePoint expiration);
+
     /**
      * Stop tracking all keys.
      */
@@ -102,9 +114,58 @@ class ExpirationTracker {
     std::vector<std::pair<std::optional<DataKind>, std::string>> Prune(
         TimePoint current_time);
 
+    /**
+     * Add a scoped key which is forgotten once it expires, the next time
+     * @ref PruneExpired is called. Adding or removing the key again by any
+     * other means cancels that.
+     *
+     * If @ref ExpireAll brings the key's expiration forward, it is still
+     * pruned only once its original expiration has passed.
+     *
+     * @param kind The scope (kind) of the key.
+     * @param key The key to track.
+     * @param expiration The time that the key expires.
+     */
+    void AddExpiring(DataKind kind,
+                     std::string const& key,
+                     TimePoint expiration);
+
+    /**
+     * Stop tracking keys added with @ref AddExpiring whose expiration has
+     * passed. The cost is proportional to the number of such keys, rather
+     * than to the number of tracked keys.
+     *
+     * @param current_time The current time.
+     * @return The number of keys pruned.
+     */
+    std::size_t PruneExpired(TimePoint current_time);
+
    private:
     using TtlMap = std::unordered_map<std::string, TimePoint>;
 
+    struct ScopedTtl {
+        TimePoint expiration;
+        // Nonzero if the key was added by AddExpiring; matches the key's
+        // entry in expiring_.
+        std::uint64_t generation;
+    };
+    using ScopedTtlMap = std::unordered_map<std::string, ScopedTtl>;
+
+    // A key added by AddExpiring. Entries are not removed when the key is
+    // added again or removed; they are skipped by PruneExpired if their
+    // generation no longer matches.
+    struct Expiring {
+        TimePoint expiration;
+        DataKind kind;
+        std::string key;
+        std::uint64_t generation;
+    };
+    struct ExpiresLater {
+        bool operator()(Expiring const& a, Expiring const& b) const {
+            return a.expiration > b.expiration;
+        }
+    };
+
     TtlMap unscoped_;
 
     static TrackState State(TimePoint expiration, TimePoint current_time);
@@ -114,11 +175,16 @@ class ExpirationTracker {
         ScopedTtls();
 
         using DataType =
-            std::array<TaggedData<TtlMap>,
+            std::array<TaggedData<ScopedTtlMap>,
                        static_cast<std::underlying_type_t<DataKind>>(
                            DataKind::kKindCount)>;
-        void Set(DataKind kind, std::string const& key, TimePoint expiration);
+        void Set(DataKind kind, std::string const& key, ScopedTtl ttl);
         void Remove(DataKind kind, std::string const& key);
+        // Removes the key only if it has the given generation.
+        bool Remove(DataKind kind,
+                    std::string const& key,
+                    std::uint64_t generation);
+        void ExpireAll(DataKind kind, TimePoint expiration);
         std::optional<TimePoint> Get(DataKind kind,
                                      std::string const& key) const;
         void Clear();
@@ -132,6 +198,11 @@ class ExpirationTracker {
     };
 
     ScopedTtls scoped_;
+
+    // Min-heap of keys added by AddExpiring, by expiration.
+    std::priority_queue<Expiring, std::vector<Expiring>, ExpiresLater>
+        expiring_;
+    std::uint64_t last_generation_ = 0;
 };
 
 std::ostream& operator<<(std::ostream& out,
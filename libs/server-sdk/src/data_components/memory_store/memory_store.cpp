@@ -2,11 +2,34 @@
 
 #include <launchdarkly/detail/unreachable.hpp>
 
+#include <chrono>
+
 namespace launchdarkly::server_side::data_components {
 
+static char const* const kLockWaitMetric = "store.lock_wait_ns";
+
+MemoryStore::MemoryStore(metrics::Registry* metrics)
+    : lock_wait_(metrics ? &metrics->GetHistogram(kLockWaitMetric) : nullptr) {
+}
+
+std::unique_lock<std::mutex> MemoryStore::Lock() const {
+    if (!lock_wait_) {
+        return std::unique_lock{data_mutex_};
+    }
+    // Only a contended acquisition is timed, so that the uncontended case
+    // doesn't pay for reading the clock.
+    std::unique_lock lock{data_mutex_, std::try_to_lock};
+    if (!lock.owns_lock()) {
+        auto const start = std::chrono::steady_clock::now();
+        lock.lock();
+        lock_wait_->Record(std::chrono::steady_clock::now() - start);
+    }
+    return lock;
+}
+
 std::shared_ptr<data_model::FlagDescriptor> MemoryStore::GetFlag(
     std::string const& key) const {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     auto found = flags_.find(key);
     if (found != flags_.end()) {
         return found->second;
@@ -16,7 +39,7 @@ std::shared_ptr<data_model::FlagDescriptor> MemoryStore::GetFlag(
 
 std::shared_ptr<data_model::SegmentDescriptor> MemoryStore::GetSegment(
     std::string const& key) const {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     auto found = segments_.find(key);
     if (found != segments_.end()) {
         return found->second;
@@ -26,18 +49,18 @@ std::shared_ptr<data_model::SegmentDescriptor> MemoryStore::GetSegment(
 
 std::unordered_map<std::string, std::shared_ptr<data_model::FlagDescriptor>>
 MemoryStore::AllFlags() const {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     return {flags_};
 }
 
 std::unordered_map<std::string, std::shared_ptr<data_model::SegmentDescriptor>>
 MemoryStore::AllSegments() const {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     return {segments_};
 }
 
 bool MemoryStore::Initialized() const {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     return initialized_;
 }
 
@@ -46,7 +69,7 @@ std::string const& MemoryStore::Identity() const {
 }
 
 void MemoryStore::Init(data_model::SDKDataSet dataSet) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     initialized_ = true;
     flags_.clear();
     segments_.clear();
@@ -63,30 +86,43 @@ void MemoryStore::Init(data_model::SDKDataSet dataSet) {
 
 void MemoryStore::Upsert(std::string const& key,
                          data_model::FlagDescriptor flag) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     flags_[key] = std::make_shared<data_model::FlagDescriptor>(std::move(flag));
 }
 
 void MemoryStore::Upsert(std::string const& key,
                          data_model::SegmentDescriptor segment) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     segments_[key] =
         std::make_shared<data_model::SegmentDescriptor>(std::move(segment));
 }
 
+void MemoryStore::Upsert(std::string const& key,
+                         std::shared_ptr<data_model::FlagDescriptor> flag) {
+    auto lock = Lock();
+    flags_[key] = std::move(flag);
+}
+
+void MemoryStore::Upsert(
+    std::string const& key,
+    std::shared_ptr<data_model::SegmentDescriptor> segment) {
+    auto lock = Lock();
+    segments_[key] = std::move(segment);
+}
+
 bool MemoryStore::RemoveFlag(std::string const& key) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     return flags_.erase(key) == 1;
 }
 
 bool MemoryStore::RemoveSegment(std::string const& key) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
     return segments_.erase(key) == 1;
 }
 
 void MemoryStore::Apply(
     data_model::ChangeSet<data_interfaces::ChangeSetData> changeSet) {
-    std::lock_guard lock{data_mutex_};
+    auto lock = Lock();
 
     switch (changeSet.type) {
         case data_model::ChangeSetType::kNone:
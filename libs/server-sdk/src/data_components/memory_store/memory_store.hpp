@@ -5,6 +5,7 @@
 #include "../../data_interfaces/store/istore.hpp"
 
 #include <launchdarkly/data_model/change_set.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 
 #include <memory>
 #include <mutex>
@@ -43,6 +44,16 @@ class MemoryStore final : public data_interfaces::IStore,
     void Upsert(std::string const& key,
                 data_model::SegmentDescriptor segment) override;
 
+    /**
+     * Stores an item the caller has already allocated, so that the caller
+     * can keep using it without reading it back.
+     */
+    void Upsert(std::string const& key,
+                std::shared_ptr<data_model::FlagDescriptor> flag);
+
+    void Upsert(std::string const& key,
+                std::shared_ptr<data_model::SegmentDescriptor> segment);
+
     bool RemoveFlag(std::string const& key);
 
     bool RemoveSegment(std::string const& key);
@@ -51,6 +62,13 @@ class MemoryStore final : public data_interfaces::IStore,
         override;
 
     MemoryStore() = default;
+
+    /**
+     * @param metrics If present, the store records how long callers wait for
+     * its lock when another caller holds it. Must outlive the store.
+     */
+    explicit MemoryStore(metrics::Registry* metrics);
+
     ~MemoryStore() override = default;
 
     MemoryStore(MemoryStore const& item) = delete;
@@ -59,6 +77,8 @@ class MemoryStore final : public data_interfaces::IStore,
     MemoryStore& operator=(MemoryStore&&) = delete;
 
    private:
+    std::unique_lock<std::mutex> Lock() const;
+
     static inline std::string const description_ = "memory";
     std::unordered_map<std::string, std::shared_ptr<data_model::FlagDescriptor>>
         flags_;
@@ -67,6 +87,7 @@ class MemoryStore final : public data_interfaces::IStore,
         segments_;
     bool initialized_ = false;
     mutable std::mutex data_mutex_;
+    metrics::Histogram* lock_wait_ = nullptr;
 };
 
 }  // namespace launchdarkly::server_side::data_components
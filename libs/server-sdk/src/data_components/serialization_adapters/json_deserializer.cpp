@@ -53,6 +53,16 @@ JsonDeserializer::GetSegment(std::string const& key) const {
     return DeserializeSingle<data_model::Segment>(segment_kind_, key);
 }
 
+data_interfaces::IDataReader::CollectionResult<data_model::Flag>
+JsonDeserializer::GetFlags(std::vector<std::string> const& keys) const {
+    return DeserializeMany<data_model::Flag>(flag_kind_, keys);
+}
+
+data_interfaces::IDataReader::CollectionResult<data_model::Segment>
+JsonDeserializer::GetSegments(std::vector<std::string> const& keys) const {
+    return DeserializeMany<data_model::Segment>(segment_kind_, keys);
+}
+
 data_interfaces::IDataReader::CollectionResult<data_model::Flag>
 JsonDeserializer::AllFlags() const {
     return DeserializeCollection<data_model::Flag>(flag_kind_);
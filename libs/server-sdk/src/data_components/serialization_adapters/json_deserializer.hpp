@@ -31,6 +31,12 @@ class JsonDeserializer final : public data_interfaces::IDataReader {
     [[nodiscard]] SingleResult<data_model::Segment> GetSegment(
         std::string const& key) const override;
 
+    [[nodiscard]] CollectionResult<data_model::Flag> GetFlags(
+        std::vector<std::string> const& keys) const override;
+
+    [[nodiscard]] CollectionResult<data_model::Segment> GetSegments(
+        std::vector<std::string> const& keys) const override;
+
     [[nodiscard]] CollectionResult<data_model::Flag> AllFlags() const override;
 
     [[nodiscard]] CollectionResult<data_model::Segment> AllSegments()
@@ -104,14 +110,37 @@ class JsonDeserializer final : public data_interfaces::IDataReader {
             return tl::make_unexpected(result.error().message);
         }
 
+        return DeserializeItems<DataModel>(kind, *result);
+    }
+
+    template <typename DataModel, typename DataKind>
+    CollectionResult<DataModel> DeserializeMany(
+        DataKind const& kind,
+        std::vector<std::string> const& keys) const {
+        auto result = source_->GetMany(kind, keys);
+
+        if (!result) {
+            /* error in fetching the items */
+            return tl::make_unexpected(result.error().message);
+        }
+
+        return DeserializeItems<DataModel>(kind, *result);
+    }
+
+    template <typename DataModel, typename DataKind>
+    Collection<DataModel> DeserializeItems(
+        DataKind const& kind,
+        std::unordered_map<std::string,
+                           integrations::SerializedItemDescriptor> const&
+            serialized_items) const {
         Collection<DataModel> items;
 
-        for (auto const& [key, descriptor] : *result) {
+        for (auto const& [key, descriptor] : serialized_items) {
             auto item = DeserializeJsonDescriptor<DataModel>(descriptor);
 
             if (!item) {
                 LD_LOG(logger_, LogLevel::kError)
-                    << "failed to deserialize " << key << " while fetching all "
+                    << "failed to deserialize " << key << " while fetching "
                     << kind.Namespace() << ": " << item.error();
                 continue;
             }
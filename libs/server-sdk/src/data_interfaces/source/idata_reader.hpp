@@ -7,6 +7,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace launchdarkly::server_side::data_interfaces {
 
@@ -53,6 +54,24 @@ class IDataReader {
     [[nodiscard]] virtual SingleResult<data_model::Segment> GetSegment(
         std::string const& key) const = 0;
 
+    /**
+     * @brief Attempts to get several flags in one operation.
+     * @param keys Keys of the flags.
+     * @return On success, a collection of the FlagDescriptors that exist.
+     * On failure, an error string.
+     */
+    [[nodiscard]] virtual CollectionResult<data_model::Flag> GetFlags(
+        std::vector<std::string> const& keys) const = 0;
+
+    /**
+     * @brief Attempts to get several segments in one operation.
+     * @param keys Keys of the segments.
+     * @return On success, a collection of the SegmentDescriptors that exist.
+     * On failure, an error string.
+     */
+    [[nodiscard]] virtual CollectionResult<data_model::Segment> GetSegments(
+        std::vector<std::string> const& keys) const = 0;
+
     /**
      * @brief Attempts to get a collection of all flags.
      * @return On success, a collection of FlagDescriptors. On failure, an error
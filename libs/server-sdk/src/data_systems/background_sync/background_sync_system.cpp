@@ -11,8 +11,9 @@ BackgroundSync::BackgroundSync(
     config::built::HttpProperties http_properties,
     boost::asio::any_io_executor ioc,
     data_components::DataSourceStatusManager& status_manager,
-    Logger const& logger)
-    : store_(), change_notifier_(store_, store_), synchronizer_() {
+    Logger const& logger,
+    metrics::Registry* metrics)
+    : store_(metrics), change_notifier_(store_, store_), synchronizer_() {
     std::visit(
         [&](auto&& method_config) {
             using T = std::decay_t<decltype(method_config)>;
@@ -21,7 +22,7 @@ BackgroundSync::BackgroundSync(
                                              StreamingConfig>) {
                 synchronizer_ = std::make_shared<StreamingDataSource>(
                     ioc, logger, status_manager, endpoints, method_config,
-                    http_properties);
+                    http_properties, metrics);
             } else if constexpr (std::is_same_v<
                                      T, config::built::BackgroundSyncConfig::
                                             PollingConfig>) {
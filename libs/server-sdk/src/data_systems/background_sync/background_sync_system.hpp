@@ -8,6 +8,7 @@
 
 #include <launchdarkly/data_model/descriptors.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/server_side/config/built/all_built.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
@@ -32,7 +33,8 @@ class BackgroundSync final : public data_interfaces::IDataSystem {
         config::built::HttpProperties http_properties,
         boost::asio::any_io_executor ioc,
         data_components::DataSourceStatusManager& status_manager,
-        Logger const& logger);
+        Logger const& logger,
+        metrics::Registry* metrics = nullptr);
 
     BackgroundSync(BackgroundSync const& item) = delete;
     BackgroundSync(BackgroundSync&& item) = delete;
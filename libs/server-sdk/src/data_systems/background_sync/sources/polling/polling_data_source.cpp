@@ -1,6 +1,7 @@
 #include "polling_data_source.hpp"
 
 #include <launchdarkly/encoding/base_64.hpp>
+#include <launchdarkly/network/gzip.hpp>
 #include <launchdarkly/network/http_error_messages.hpp>
 
 #include <launchdarkly/serialization/json_flag.hpp>
@@ -51,7 +52,10 @@ static network::HttpRequest MakeRequest(
     network::HttpRequest::BodyType body;
     network::HttpMethod method = network::HttpMethod::kGet;
 
-    config::builders::HttpPropertiesBuilder const builder(http_properties);
+    config::builders::HttpPropertiesBuilder builder(http_properties);
+    // Full payloads compress well, and the requester transparently
+    // decompresses the response.
+    builder.Header("Accept-Encoding", network::kAcceptEncodingGzip);
 
     // If no URL is set, then we will fail the request.
     return {url.value_or(""), method, builder.Build(), body};
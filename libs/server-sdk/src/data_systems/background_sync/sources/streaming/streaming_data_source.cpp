@@ -17,6 +17,8 @@ namespace launchdarkly::server_side::data_systems {
 static char const* const kCouldNotParseEndpoint =
     "Could not parse streaming endpoint URL";
 
+static char const* const kReconnectsMetric = "data_source.stream_reconnects";
+
 static char const* const kInvalidFilterKey =
     "Invalid payload filter configured on polling data source, full "
     "environment "
@@ -34,13 +36,16 @@ StreamingDataSource::StreamingDataSource(
     data_components::DataSourceStatusManager& status_manager,
     config::built::ServiceEndpoints const& endpoints,
     config::built::BackgroundSyncConfig::StreamingConfig const& streaming,
-    config::built::HttpProperties const& http_properties)
+    config::built::HttpProperties const& http_properties,
+    metrics::Registry* metrics)
     : io_(std::move(io)),
       logger_(logger),
       status_manager_(status_manager),
       http_config_(http_properties),
       streaming_endpoint_(endpoints.StreamingBaseUrl()),
-      streaming_config_(streaming) {}
+      streaming_config_(streaming),
+      reconnects_(metrics ? &metrics->GetCounter(kReconnectsMetric)
+                          : nullptr) {}
 
 void StreamingDataSource::StartAsync(
     data_interfaces::IDestination* dest,
@@ -104,6 +109,8 @@ void StreamingDataSource::StartAsync(
 
     client_builder.initial_reconnect_delay(
         streaming_config_.initial_reconnect_delay);
+    // Spread out reconnections when many SDKs lose their streams at once.
+    client_builder.decorrelated_jitter(true);
 
     for (auto const& [key, value] : http_config_.BaseHeaders()) {
         client_builder.header(key, value);
@@ -137,6 +144,9 @@ void StreamingDataSource::StartAsync(
                     << "Received invalid data from stream, restarting connection";
                 if (self->client_) {
                     self->client_->async_restart("invalid data in stream");
+                    if (self->reconnects_) {
+                        self->reconnects_->Add();
+                    }
                 }
             }
         }
@@ -153,6 +163,10 @@ void StreamingDataSource::StartAsync(
             std::string error_string = sse::ErrorToString(error);
             LD_LOG(self->logger_, sse::IsRecoverable(error) ? LogLevel::kDebug
                                                             : LogLevel::kError);
+            // The client reconnects after every recoverable error.
+            if (self->reconnects_ && sse::IsRecoverable(error)) {
+                self->reconnects_->Add();
+            }
             self->HandleErrorStateChange(std::move(error),
                                          std::move(error_string));
         }
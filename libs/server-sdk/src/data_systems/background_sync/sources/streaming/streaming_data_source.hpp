@@ -7,6 +7,7 @@
 #include "../../../../data_interfaces/source/idata_synchronizer.hpp"
 
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/server_side/config/built/all_built.hpp>
 #include <launchdarkly/sse/client.hpp>
 
@@ -24,7 +25,8 @@ class StreamingDataSource final
         data_components::DataSourceStatusManager& status_manager,
         config::built::ServiceEndpoints const& endpoints,
         config::built::BackgroundSyncConfig::StreamingConfig const& streaming,
-        config::built::HttpProperties const& http_properties);
+        config::built::HttpProperties const& http_properties,
+        metrics::Registry* metrics = nullptr);
 
     void StartAsync(data_interfaces::IDestination* dest,
                     data_model::SDKDataSet const* bootstrap_data) override;
@@ -47,5 +49,8 @@ class StreamingDataSource final
     config::built::BackgroundSyncConfig::StreamingConfig streaming_config_;
 
     std::shared_ptr<sse::Client> client_;
+
+    // Null unless the source was given a metrics registry.
+    metrics::Counter* reconnects_;
 };
 }  // namespace launchdarkly::server_side::data_systems
@@ -1,4 +1,5 @@
 #include "fdv2_data_system.hpp"
+#include "snapshot_file.hpp"
 
 #include <launchdarkly/async/promise.hpp>
 #include <launchdarkly/async/timer.hpp>
@@ -34,14 +35,17 @@ FDv2DataSystem::FDv2DataSystem(
         recovery_condition_factory,
     boost::asio::any_io_executor ioc,
     data_components::DataSourceStatusManager* status_manager,
-    Logger const& logger)
+    Logger const& logger,
+    std::unique_ptr<FDv2SnapshotWriter> snapshot_writer,
+    metrics::Registry* metrics)
     : logger_(logger),
       ioc_(std::move(ioc)),
       initializer_factories_(std::move(initializer_factories)),
       fallback_condition_factory_(std::move(fallback_condition_factory)),
       recovery_condition_factory_(std::move(recovery_condition_factory)),
       status_manager_(status_manager),
-      store_(),
+      snapshot_writer_(std::move(snapshot_writer)),
+      store_(metrics),
       change_notifier_(store_, store_),
       initialize_called_(false),
       last_logged_synchronizer_interrupted_(false),
@@ -61,6 +65,9 @@ void FDv2DataSystem::Close() {
     std::lock_guard<std::mutex> lock(mutex_);
     closed_ = true;
     fdv1_fallback_retry_cancel_.Cancel();
+    if (snapshot_writer_) {
+        snapshot_writer_->Close();
+    }
     if (active_initializer_) {
         active_initializer_->Close();
     }
@@ -108,6 +115,19 @@ void FDv2DataSystem::Initialize() {
         status_manager_->SetState(DataSourceStatus::DataSourceState::kValid);
         return;
     }
+    if (snapshot_writer_) {
+        // Runs on ioc_, as does ApplyChangeSet, so the selector and the
+        // store contents are always consistent with each other.
+        snapshot_writer_->Start([this]() {
+            data_model::Selector selector;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                selector = selector_;
+            }
+            return EncodeSnapshot(selector, store_.AllFlags(),
+                                  store_.AllSegments());
+        });
+    }
     boost::asio::post(ioc_, [this]() { RunNextInitializer(); });
 }
 
@@ -480,6 +500,9 @@ void FDv2DataSystem::ApplyChangeSet(
         selector_ = change_set.selector;
     }
     change_notifier_.Apply(std::move(change_set));
+    if (snapshot_writer_) {
+        snapshot_writer_->MarkDirty();
+    }
     status_manager_->SetState(DataSourceStatus::DataSourceState::kValid);
 }
 
@@ -8,11 +8,13 @@
 #include "../../data_interfaces/source/ifdv2_synchronizer_factory.hpp"
 #include "../../data_interfaces/system/idata_system.hpp"
 #include "conditions.hpp"
+#include "snapshot_writer.hpp"
 #include "source_manager.hpp"
 
 #include <launchdarkly/async/cancellation.hpp>
 #include <launchdarkly/data_model/selector.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
 
@@ -157,6 +159,11 @@ class FDv2DataSystem final : public data_interfaces::IDataSystem {
      *     status transitions.
      * @param logger Used for diagnostic logging. Held by value (Logger is
      *     internally thread-safe and cheap to copy).
+     * @param snapshot_writer May be null. If present, the store's contents
+     *     and selector are persisted through it after each change, for a
+     *     snapshot initializer to load on the next start.
+     * @param metrics May be null. If present, the store records its lock
+     *     contention in it. Must outlive this object.
      */
     FDv2DataSystem(
         std::vector<std::unique_ptr<data_interfaces::IFDv2InitializerFactory>>
@@ -169,7 +176,9 @@ class FDv2DataSystem final : public data_interfaces::IDataSystem {
             recovery_condition_factory,
         boost::asio::any_io_executor ioc,
         data_components::DataSourceStatusManager* status_manager,
-        Logger const& logger);
+        Logger const& logger,
+        std::unique_ptr<FDv2SnapshotWriter> snapshot_writer = nullptr,
+        metrics::Registry* metrics = nullptr);
 
     ~FDv2DataSystem() override;
 
@@ -279,6 +288,8 @@ class FDv2DataSystem final : public data_interfaces::IDataSystem {
         recovery_condition_factory_;
     // Non-owning. Lifetime guaranteed by the caller (see constructor doc).
     data_components::DataSourceStatusManager* const status_manager_;
+    // May be null. Internally synchronized.
+    std::unique_ptr<FDv2SnapshotWriter> const snapshot_writer_;
 
     // Internally synchronized.
     data_components::MemoryStore store_;
@@ -2,6 +2,7 @@
 #include "../background_sync/detail/payload_filter_validation/payload_filter_validation.hpp"
 #include "fdv2_changeset_translation.hpp"
 
+#include <launchdarkly/network/gzip.hpp>
 #include <launchdarkly/network/http_error_messages.hpp>
 #include <launchdarkly/server_side/config/builders/all_builders.hpp>
 
@@ -59,7 +60,10 @@ network::HttpRequest MakeFDv2PollRequest(
     data_model::Selector const& selector,
     std::optional<std::string> const& filter_key,
     Logger const& logger) {
-    config::builders::HttpPropertiesBuilder const builder(http_properties);
+    config::builders::HttpPropertiesBuilder builder(http_properties);
+    // Full payloads compress well, and the requester transparently
+    // decompresses the response.
+    builder.Header("Accept-Encoding", network::kAcceptEncodingGzip);
 
     auto parsed = boost::urls::parse_uri(polling_base_url);
     if (!parsed) {
@@ -1,6 +1,7 @@
 #include "initializer_factories.hpp"
 
 #include "polling_initializer.hpp"
+#include "snapshot_initializer.hpp"
 
 #include <launchdarkly/data_model/selector.hpp>
 
@@ -28,4 +29,14 @@ FDv2PollingInitializerFactory::Build() {
         data_model::Selector{}, std::nullopt);
 }
 
+FDv2SnapshotInitializerFactory::FDv2SnapshotInitializerFactory(
+    Logger logger,
+    config::built::FDv2Config::SnapshotConfig snapshot)
+    : logger_(std::move(logger)), snapshot_(std::move(snapshot)) {}
+
+std::unique_ptr<data_interfaces::IFDv2Initializer>
+FDv2SnapshotInitializerFactory::Build() {
+    return std::make_unique<FDv2SnapshotInitializer>(logger_, snapshot_.path);
+}
+
 }  // namespace launchdarkly::server_side::data_systems
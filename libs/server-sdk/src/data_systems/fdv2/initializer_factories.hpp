@@ -33,4 +33,21 @@ class FDv2PollingInitializerFactory final
     config::built::FDv2Config::PollingConfig const polling_;
 };
 
+/**
+ * Builds fresh FDv2SnapshotInitializer instances on demand.
+ */
+class FDv2SnapshotInitializerFactory final
+    : public data_interfaces::IFDv2InitializerFactory {
+   public:
+    FDv2SnapshotInitializerFactory(
+        Logger logger,
+        config::built::FDv2Config::SnapshotConfig snapshot);
+
+    std::unique_ptr<data_interfaces::IFDv2Initializer> Build() override;
+
+   private:
+    Logger const logger_;
+    config::built::FDv2Config::SnapshotConfig const snapshot_;
+};
+
 }  // namespace launchdarkly::server_side::data_systems
@@ -4,6 +4,7 @@
 #include <launchdarkly/async/timer.hpp>
 #include <launchdarkly/fdv2_protocol_handler.hpp>
 #include <launchdarkly/network/http_requester.hpp>
+#include <launchdarkly/server_side/config/builders/all_builders.hpp>
 
 #include <algorithm>
 
@@ -11,20 +12,18 @@ namespace launchdarkly::server_side::data_systems {
 
 static char const* const kIdentity = "FDv2 polling synchronizer";
 
-// Minimum polling interval to prevent accidentally hammering the service.
-static constexpr std::chrono::seconds kMinPollInterval{30};
-
 using data_interfaces::FDv2SourceResult;
 
 FDv2PollingSynchronizer::State::State(
     Logger logger,
     boost::asio::any_io_executor const& executor,
     std::chrono::seconds poll_interval,
+    std::chrono::seconds min_poll_interval,
     std::string polling_base_url,
     config::built::HttpProperties const& http_properties,
     std::optional<std::string> filter_key)
     : logger_(std::move(logger)),
-      poll_interval_(std::max(poll_interval, kMinPollInterval)),
+      poll_interval_(std::max(poll_interval, min_poll_interval)),
       polling_base_url_(std::move(polling_base_url)),
       http_properties_(http_properties),
       filter_key_(std::move(filter_key)),
@@ -32,9 +31,19 @@ FDv2PollingSynchronizer::State::State(
       executor_(executor) {}
 
 async::Future<network::HttpResult> FDv2PollingSynchronizer::State::Request(
-    data_model::Selector const& selector) const {
+    data_model::Selector const& selector) {
     auto request = MakeFDv2PollRequest(polling_base_url_, http_properties_,
                                        selector, filter_key_, logger_);
+    {
+        std::lock_guard lock(mutex_);
+        last_request_url_ = request.Url();
+        if (etag_ && etag_->first == last_request_url_) {
+            config::builders::HttpPropertiesBuilder builder(
+                request.Properties());
+            builder.Header("If-None-Match", etag_->second);
+            request = network::HttpRequest(request, builder.Build());
+        }
+    }
 
     // Promise must be in a shared_ptr because Requester requires callbacks
     // to be copy-constructible (stored in std::function).
@@ -49,6 +58,15 @@ async::Future<network::HttpResult> FDv2PollingSynchronizer::State::Request(
 
 FDv2SourceResult FDv2PollingSynchronizer::State::HandlePollResult(
     network::HttpResult const& res) {
+    if (!res.IsError() && res.Status() == 200) {
+        auto const etag = res.Headers().find("etag");
+        std::lock_guard lock(mutex_);
+        if (etag != res.Headers().end()) {
+            etag_.emplace(last_request_url_, etag->second);
+        } else {
+            etag_.reset();
+        }
+    }
     FDv2ProtocolHandler protocol_handler;
     return HandleFDv2PollResponse(res, &protocol_handler, logger_, kIdentity);
 }
@@ -84,17 +102,19 @@ FDv2PollingSynchronizer::FDv2PollingSynchronizer(
     std::string polling_base_url,
     config::built::HttpProperties const& http_properties,
     std::optional<std::string> filter_key,
-    std::chrono::seconds poll_interval)
+    std::chrono::seconds poll_interval,
+    std::chrono::seconds min_poll_interval)
     : state_(std::make_shared<State>(logger,
                                      executor,
                                      poll_interval,
+                                     min_poll_interval,
                                      std::move(polling_base_url),
                                      http_properties,
                                      std::move(filter_key))) {
-    if (poll_interval < kMinPollInterval) {
+    if (poll_interval < min_poll_interval) {
         LD_LOG(logger, LogLevel::kWarn)
             << kIdentity << ": polling interval too frequent, defaulting to "
-            << kMinPollInterval.count() << " seconds";
+            << min_poll_interval.count() << " seconds";
     }
 }
 
@@ -13,6 +13,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 
 namespace launchdarkly::server_side::data_systems {
 
@@ -32,9 +33,13 @@ namespace launchdarkly::server_side::data_systems {
 class FDv2PollingSynchronizer final
     : public data_interfaces::IFDv2Synchronizer {
    public:
+    // Minimum polling interval to prevent accidentally hammering the service.
+    static constexpr std::chrono::seconds kDefaultMinPollInterval{30};
+
     /**
      * Constructs a synchronizer that polls at the given interval.
      * If filter_key is present, only the specified payload filter is requested.
+     * Intervals shorter than min_poll_interval are raised to it.
      */
     FDv2PollingSynchronizer(
         boost::asio::any_io_executor const& executor,
@@ -42,7 +47,8 @@ class FDv2PollingSynchronizer final
         std::string polling_base_url,
         config::built::HttpProperties const& http_properties,
         std::optional<std::string> filter_key,
-        std::chrono::seconds poll_interval);
+        std::chrono::seconds poll_interval,
+        std::chrono::seconds min_poll_interval = kDefaultMinPollInterval);
 
     ~FDv2PollingSynchronizer() override;
 
@@ -62,16 +68,19 @@ class FDv2PollingSynchronizer final
         State(Logger logger,
               boost::asio::any_io_executor const& executor,
               std::chrono::seconds poll_interval,
+              std::chrono::seconds min_poll_interval,
               std::string polling_base_url,
               config::built::HttpProperties const& http_properties,
               std::optional<std::string> filter_key);
 
         /** Issues an async HTTP poll request and returns a Future resolving
-         * with the result. */
+         * with the result. If the previous response for the same URL had an
+         * ETag, the request is made conditional on it. */
         async::Future<network::HttpResult> Request(
-            data_model::Selector const& selector) const;
+            data_model::Selector const& selector);
 
-        /** Interprets an HTTP response as a source result. */
+        /** Interprets an HTTP response as a source result. A 304 response is
+         * interpreted without parsing a payload. */
         data_interfaces::FDv2SourceResult HandlePollResult(
             network::HttpResult const& res);
 
@@ -106,6 +115,11 @@ class FDv2PollingSynchronizer final
         std::mutex mutex_;
         std::optional<std::chrono::time_point<std::chrono::steady_clock>>
             last_poll_start_;
+        // URL of the most recent request. An ETag is only valid for the
+        // URL it was received for, and the URL changes with the selector.
+        std::string last_request_url_;
+        // URL and ETag of the last successful response.
+        std::optional<std::pair<std::string, std::string>> etag_;
     };
 
     /**
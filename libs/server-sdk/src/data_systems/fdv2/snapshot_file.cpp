@@ -0,0 +1,302 @@
+#include "snapshot_file.hpp"
+
+#include <launchdarkly/serialization/json_flag.hpp>
+#include <launchdarkly/serialization/json_segment.hpp>
+
+#include <boost/crc.hpp>
+#include <boost/json.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+
+namespace launchdarkly::server_side::data_systems {
+
+static char const kMagic[] = "LDSNAPv1";
+static constexpr std::size_t kMagicSize = sizeof(kMagic) - 1;
+static constexpr std::size_t kHeaderSize = kMagicSize + 8 + 4 + 4;
+
+static constexpr std::uint8_t kKindFlag = 0;
+static constexpr std::uint8_t kKindSegment = 1;
+
+namespace {
+
+class Writer {
+   public:
+    void U8(std::uint8_t value) { out_.push_back(static_cast<char>(value)); }
+
+    void U32(std::uint32_t value) { Fixed(value, 4); }
+
+    void U64(std::uint64_t value) { Fixed(value, 8); }
+
+    void Bytes(std::string_view value) {
+        U32(static_cast<std::uint32_t>(value.size()));
+        out_.append(value.data(), value.size());
+    }
+
+    std::string& Out() { return out_; }
+
+   private:
+    void Fixed(std::uint64_t value, std::size_t width) {
+        for (std::size_t i = 0; i < width; i++) {
+            out_.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::string out_;
+};
+
+class Reader {
+   public:
+    explicit Reader(std::string_view data) : data_(data), pos_(0) {}
+
+    std::optional<std::uint8_t> U8() {
+        auto value = Fixed(1);
+        if (!value) {
+            return std::nullopt;
+        }
+        return static_cast<std::uint8_t>(*value);
+    }
+
+    std::optional<std::uint32_t> U32() {
+        auto value = Fixed(4);
+        if (!value) {
+            return std::nullopt;
+        }
+        return static_cast<std::uint32_t>(*value);
+    }
+
+    std::optional<std::uint64_t> U64() { return Fixed(8); }
+
+    std::optional<std::string_view> Bytes() {
+        auto const size = U32();
+        if (!size || data_.size() - pos_ < *size) {
+            return std::nullopt;
+        }
+        auto value = data_.substr(pos_, *size);
+        pos_ += *size;
+        return value;
+    }
+
+    [[nodiscard]] bool Done() const { return pos_ == data_.size(); }
+
+   private:
+    std::optional<std::uint64_t> Fixed(std::size_t width) {
+        if (data_.size() - pos_ < width) {
+            return std::nullopt;
+        }
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < width; i++) {
+            value |= static_cast<std::uint64_t>(
+                         static_cast<unsigned char>(data_[pos_ + i]))
+                     << (8 * i);
+        }
+        pos_ += width;
+        return value;
+    }
+
+    std::string_view data_;
+    std::size_t pos_;
+};
+
+std::uint32_t Checksum(std::string_view data) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data.data(), data.size());
+    return crc.checksum();
+}
+
+template <typename T>
+void EncodeItem(Writer& writer,
+                std::uint8_t kind,
+                std::string const& key,
+                data_model::ItemDescriptor<T> const& descriptor) {
+    writer.U8(kind);
+    writer.U8(descriptor.item ? 0 : 1);
+    writer.U64(descriptor.version);
+    writer.Bytes(key);
+    writer.Bytes(descriptor.item ? boost::json::serialize(
+                                       boost::json::value_from(*descriptor.item))
+                                 : std::string());
+}
+
+template <typename T>
+tl::expected<data_model::ItemDescriptor<T>, std::string> DecodeItem(
+    bool deleted,
+    std::uint64_t version,
+    std::string_view key,
+    std::string_view json) {
+    if (deleted) {
+        return data_model::ItemDescriptor<T>{data_model::Tombstone{version}};
+    }
+    boost::system::error_code ec;
+    auto value = boost::json::parse(json, ec);
+    if (ec) {
+        return tl::make_unexpected("could not parse item '" +
+                                   std::string(key) + "'");
+    }
+    auto item =
+        boost::json::value_to<tl::expected<std::optional<T>, JsonError>>(
+            value);
+    if (!item || !item->has_value()) {
+        return tl::make_unexpected("could not deserialize item '" +
+                                   std::string(key) + "'");
+    }
+    return data_model::ItemDescriptor<T>{std::move(**item)};
+}
+
+}  // namespace
+
+std::string EncodeSnapshot(
+    data_model::Selector const& selector,
+    std::unordered_map<std::string,
+                       std::shared_ptr<data_model::FlagDescriptor>> const&
+        flags,
+    std::unordered_map<std::string,
+                       std::shared_ptr<data_model::SegmentDescriptor>> const&
+        segments) {
+    Writer body;
+    body.U8(selector.value ? 1 : 0);
+    body.U64(selector.value
+                 ? static_cast<std::uint64_t>(selector.value->version)
+                 : 0);
+    body.Bytes(selector.value ? selector.value->state : std::string());
+
+    std::size_t count = 0;
+    for (auto const& [key, descriptor] : flags) {
+        count += descriptor ? 1 : 0;
+    }
+    for (auto const& [key, descriptor] : segments) {
+        count += descriptor ? 1 : 0;
+    }
+    body.U32(static_cast<std::uint32_t>(count));
+
+    for (auto const& [key, descriptor] : flags) {
+        if (descriptor) {
+            EncodeItem(body, kKindFlag, key, *descriptor);
+        }
+    }
+    for (auto const& [key, descriptor] : segments) {
+        if (descriptor) {
+            EncodeItem(body, kKindSegment, key, *descriptor);
+        }
+    }
+
+    Writer header;
+    header.Out().append(kMagic, kMagicSize);
+    header.U64(body.Out().size());
+    header.U32(Checksum(body.Out()));
+    header.U32(0);
+
+    return std::move(header.Out()) + body.Out();
+}
+
+tl::expected<Snapshot, std::string> DecodeSnapshot(std::string_view data) {
+    if (data.size() < kHeaderSize ||
+        std::memcmp(data.data(), kMagic, kMagicSize) != 0) {
+        return tl::make_unexpected("not a snapshot file");
+    }
+
+    Reader header(data.substr(kMagicSize, kHeaderSize - kMagicSize));
+    auto const body_size = header.U64();
+    auto const checksum = header.U32();
+
+    auto const body = data.substr(kHeaderSize);
+    if (!body_size || body.size() != *body_size) {
+        return tl::make_unexpected("snapshot is truncated");
+    }
+    if (!checksum || Checksum(body) != *checksum) {
+        return tl::make_unexpected("snapshot checksum mismatch");
+    }
+
+    Reader reader(body);
+    Snapshot snapshot;
+
+    auto const has_selector = reader.U8();
+    auto const selector_version = reader.U64();
+    auto const selector_state = reader.Bytes();
+    auto const count = reader.U32();
+    if (!has_selector || !selector_version || !selector_state || !count) {
+        return tl::make_unexpected("snapshot header is malformed");
+    }
+    if (*has_selector) {
+        snapshot.selector.value = data_model::Selector::State{
+            static_cast<std::int64_t>(*selector_version),
+            std::string(*selector_state)};
+    }
+
+    snapshot.data.reserve(*count);
+    for (std::uint32_t i = 0; i < *count; i++) {
+        auto const kind = reader.U8();
+        auto const deleted = reader.U8();
+        auto const version = reader.U64();
+        auto const key = reader.Bytes();
+        auto const json = reader.Bytes();
+        if (!kind || !deleted || !version || !key || !json) {
+            return tl::make_unexpected("snapshot item is malformed");
+        }
+        if (*kind == kKindFlag) {
+            auto item = DecodeItem<data_model::Flag>(*deleted != 0, *version,
+                                                     *key, *json);
+            if (!item) {
+                return tl::make_unexpected(item.error());
+            }
+            snapshot.data.push_back(
+                data_interfaces::ItemChange{std::string(*key), *item});
+        } else if (*kind == kKindSegment) {
+            auto item = DecodeItem<data_model::Segment>(*deleted != 0,
+                                                        *version, *key, *json);
+            if (!item) {
+                return tl::make_unexpected(item.error());
+            }
+            snapshot.data.push_back(
+                data_interfaces::ItemChange{std::string(*key), *item});
+        } else {
+            return tl::make_unexpected("snapshot item has unknown kind");
+        }
+    }
+
+    if (!reader.Done()) {
+        return tl::make_unexpected("snapshot has trailing data");
+    }
+    return snapshot;
+}
+
+tl::expected<void, std::string> WriteSnapshotFile(std::string const& path,
+                                                  std::string const& encoded) {
+    std::string const temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return tl::make_unexpected("could not open " + temp_path);
+        }
+        out.write(encoded.data(),
+                  static_cast<std::streamsize>(encoded.size()));
+        out.flush();
+        if (!out) {
+            return tl::make_unexpected("could not write " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return tl::make_unexpected("could not replace " + path);
+    }
+    return {};
+}
+
+tl::expected<Snapshot, std::string> ReadSnapshotFile(std::string const& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return tl::make_unexpected("no snapshot at " + path);
+    }
+    std::string const data((std::istreambuf_iterator<char>(in)),
+                           std::istreambuf_iterator<char>());
+    if (in.bad()) {
+        return tl::make_unexpected("could not read " + path);
+    }
+    return DecodeSnapshot(data);
+}
+
+}  // namespace launchdarkly::server_side::data_systems
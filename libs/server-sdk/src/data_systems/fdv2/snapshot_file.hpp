@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../../data_interfaces/item_change.hpp"
+
+#include <launchdarkly/data_model/descriptors.hpp>
+#include <launchdarkly/data_model/flag.hpp>
+#include <launchdarkly/data_model/item_descriptor.hpp>
+#include <launchdarkly/data_model/segment.hpp>
+#include <launchdarkly/data_model/selector.hpp>
+
+#include <tl/expected.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace launchdarkly::server_side::data_systems {
+
+/**
+ * A snapshot of the FDv2 data system's store, together with the selector
+ * that identifies the version of the data it contains.
+ */
+struct Snapshot {
+    data_model::Selector selector;
+    data_interfaces::ChangeSetData data;
+};
+
+/**
+ * Encodes the given store contents into the snapshot file format.
+ *
+ * The format is a fixed-size little-endian header followed by a body:
+ *
+ *   header: magic "LDSNAPv1" (8 bytes), body length (u64), CRC-32 of the
+ *           body (u32), reserved (u32).
+ *   body:   selector present (u8), selector version (i64), selector state
+ *           (u32 length + bytes), item count (u32), then per item: kind
+ *           (u8, 0 = flag, 1 = segment), deleted (u8), version (u64), key
+ *           (u32 length + bytes), JSON representation (u32 length + bytes;
+ *           empty for deleted items).
+ *
+ * Every field has a fixed width or an explicit length, so the file can be
+ * decoded in place from a read-only mapping.
+ */
+std::string EncodeSnapshot(
+    data_model::Selector const& selector,
+    std::unordered_map<std::string,
+                       std::shared_ptr<data_model::FlagDescriptor>> const&
+        flags,
+    std::unordered_map<std::string,
+                       std::shared_ptr<data_model::SegmentDescriptor>> const&
+        segments);
+
+/**
+ * Decodes a snapshot previously produced by EncodeSnapshot. Fails if the
+ * data is truncated, has the wrong magic, fails the checksum, or contains
+ * items which cannot be deserialized.
+ */
+tl::expected<Snapshot, std::string> DecodeSnapshot(std::string_view data);
+
+/**
+ * Writes the encoded snapshot to path. The data is first written to a
+ * temporary file beside path, which is then renamed over it, so readers
+ * never observe a partially-written snapshot.
+ * @return An error message on failure.
+ */
+tl::expected<void, std::string> WriteSnapshotFile(std::string const& path,
+                                                  std::string const& encoded);
+
+/**
+ * Reads and decodes the snapshot at path.
+ */
+tl::expected<Snapshot, std::string> ReadSnapshotFile(std::string const& path);
+
+}  // namespace launchdarkly::server_side::data_systems
@@ -0,0 +1,46 @@
+#include "snapshot_initializer.hpp"
+#include "snapshot_file.hpp"
+
+#include <chrono>
+#include <utility>
+
+namespace launchdarkly::server_side::data_systems {
+
+static char const* const kIdentity = "FDv2 snapshot initializer";
+
+using data_interfaces::FDv2SourceResult;
+
+FDv2SnapshotInitializer::FDv2SnapshotInitializer(Logger const& logger,
+                                                 std::string path)
+    : logger_(logger), path_(std::move(path)) {}
+
+async::Future<FDv2SourceResult> FDv2SnapshotInitializer::Run() {
+    auto snapshot = ReadSnapshotFile(path_);
+    if (!snapshot) {
+        LD_LOG(logger_, LogLevel::kInfo)
+            << kIdentity << ": not using snapshot: " << snapshot.error();
+        using ErrorInfo = FDv2SourceResult::ErrorInfo;
+        return async::MakeFuture(FDv2SourceResult{
+            FDv2SourceResult::TerminalError{ErrorInfo{
+                ErrorInfo::ErrorKind::kInvalidData, 0, snapshot.error(),
+                std::chrono::system_clock::now()}}});
+    }
+
+    LD_LOG(logger_, LogLevel::kInfo)
+        << kIdentity << ": loaded " << snapshot->data.size()
+        << " items from " << path_;
+
+    return async::MakeFuture(FDv2SourceResult{FDv2SourceResult::ChangeSet{
+        data_model::ChangeSet<data_interfaces::ChangeSetData>{
+            data_model::ChangeSetType::kFull, std::move(snapshot->data),
+            std::move(snapshot->selector)}}});
+}
+
+void FDv2SnapshotInitializer::Close() {}
+
+std::string const& FDv2SnapshotInitializer::Identity() const {
+    static std::string const identity = kIdentity;
+    return identity;
+}
+
+}  // namespace launchdarkly::server_side::data_systems
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../../data_interfaces/source/ifdv2_initializer.hpp"
+
+#include <launchdarkly/async/promise.hpp>
+#include <launchdarkly/logging/logger.hpp>
+
+#include <string>
+
+namespace launchdarkly::server_side::data_systems {
+
+/**
+ * FDv2 initializer which loads the last snapshot written by an
+ * FDv2SnapshotWriter from local disk.
+ *
+ * If the snapshot carries a selector, the data system treats it as a basis
+ * and hands off to its synchronizers, which then request only the changes
+ * since that selector. A missing or corrupt snapshot is reported as a
+ * TerminalError so that the next initializer runs.
+ *
+ * Threading model:
+ *   Run() reads the file synchronously and returns a ready future.
+ *   Close() is a no-op; there is nothing to cancel.
+ */
+class FDv2SnapshotInitializer final
+    : public data_interfaces::IFDv2Initializer {
+   public:
+    FDv2SnapshotInitializer(Logger const& logger, std::string path);
+
+    async::Future<data_interfaces::FDv2SourceResult> Run() override;
+
+    void Close() override;
+
+    [[nodiscard]] std::string const& Identity() const override;
+
+   private:
+    Logger const logger_;
+    std::string const path_;
+};
+
+}  // namespace launchdarkly::server_side::data_systems
@@ -0,0 +1,97 @@
+#include "snapshot_writer.hpp"
+#include "snapshot_file.hpp"
+
+#include <launchdarkly/async/timer.hpp>
+
+#include <boost/asio/post.hpp>
+
+#include <utility>
+
+namespace launchdarkly::server_side::data_systems {
+
+static char const* const kIdentity = "FDv2 snapshot writer";
+
+FDv2SnapshotWriter::FDv2SnapshotWriter(boost::asio::any_io_executor executor,
+                                       Logger const& logger,
+                                       std::string path,
+                                       std::chrono::milliseconds interval)
+    : logger_(logger),
+      executor_(std::move(executor)),
+      path_(std::move(path)),
+      interval_(interval),
+      dirty_(false),
+      closed_(false) {}
+
+FDv2SnapshotWriter::~FDv2SnapshotWriter() {
+    Close();
+}
+
+void FDv2SnapshotWriter::Start(Encoder encoder) {
+    {
+        std::lock_guard lock(mutex_);
+        if (closed_) {
+            return;
+        }
+        encoder_ = std::move(encoder);
+    }
+    ScheduleWrite();
+}
+
+void FDv2SnapshotWriter::MarkDirty() {
+    dirty_.store(true);
+}
+
+bool FDv2SnapshotWriter::WriteIfDirty() {
+    Encoder encoder;
+    {
+        std::lock_guard lock(mutex_);
+        if (!encoder_) {
+            return false;
+        }
+        encoder = encoder_;
+    }
+    if (!dirty_.exchange(false)) {
+        return false;
+    }
+    if (auto result = WriteSnapshotFile(path_, encoder()); !result) {
+        // Try again on the next tick.
+        dirty_.store(true);
+        LD_LOG(logger_, LogLevel::kWarn)
+            << kIdentity << ": could not write snapshot: " << result.error();
+        return false;
+    }
+    LD_LOG(logger_, LogLevel::kDebug)
+        << kIdentity << ": wrote snapshot to " << path_;
+    return true;
+}
+
+void FDv2SnapshotWriter::Close() {
+    std::lock_guard lock(mutex_);
+    closed_ = true;
+    cancel_.Cancel();
+}
+
+void FDv2SnapshotWriter::ScheduleWrite() {
+    async::CancellationToken token;
+    {
+        std::lock_guard lock(mutex_);
+        if (closed_) {
+            return;
+        }
+        token = cancel_.GetToken();
+    }
+    async::Delay(executor_, interval_, std::move(token))
+        .Then(
+            [this](bool fired) -> std::monostate {
+                if (fired) {
+                    WriteIfDirty();
+                    ScheduleWrite();
+                }
+                return {};
+            },
+            [executor = executor_](async::Continuation<void()> work) {
+                boost::asio::post(executor, std::move(work));
+            });
+}
+
+}  // namespace launchdarkly::server_side::data_systems
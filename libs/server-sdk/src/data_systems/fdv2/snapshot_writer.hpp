@@ -0,0 +1,88 @@
+#pragma once
+
+#include <launchdarkly/async/cancellation.hpp>
+#include <launchdarkly/logging/logger.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace launchdarkly::server_side::data_systems {
+
+/**
+ * Periodically persists the FDv2 data system's store to a local snapshot
+ * file, which FDv2SnapshotInitializer loads on the next start.
+ *
+ * The owner calls MarkDirty() whenever the store changes. Every interval,
+ * if the store changed since the last write, the writer invokes the encoder
+ * passed to Start() on the executor and replaces the snapshot file.
+ *
+ * Threading model:
+ *   MarkDirty() may be called from any thread.
+ *   Start() and Close() are called by the owner; Close() is idempotent.
+ *   The same destruction protocol as FDv2DataSystem applies: the executor
+ *   must be stopped and joined before this object is destroyed.
+ */
+class FDv2SnapshotWriter {
+   public:
+    /**
+     * Produces the encoded snapshot of the current store contents.
+     */
+    using Encoder = std::function<std::string()>;
+
+    FDv2SnapshotWriter(boost::asio::any_io_executor executor,
+                       Logger const& logger,
+                       std::string path,
+                       std::chrono::milliseconds interval);
+
+    ~FDv2SnapshotWriter();
+
+    FDv2SnapshotWriter(FDv2SnapshotWriter const&) = delete;
+    FDv2SnapshotWriter(FDv2SnapshotWriter&&) = delete;
+    FDv2SnapshotWriter& operator=(FDv2SnapshotWriter const&) = delete;
+    FDv2SnapshotWriter& operator=(FDv2SnapshotWriter&&) = delete;
+
+    /**
+     * Starts the periodic writes. Must be called at most once.
+     */
+    void Start(Encoder encoder);
+
+    /**
+     * Records that the store has changed since the last write.
+     */
+    void MarkDirty();
+
+    /**
+     * Writes the snapshot now if the store has changed since the last write.
+     * Called by the periodic timer; exposed for the owner to flush on demand.
+     * @return True if a snapshot was written.
+     */
+    bool WriteIfDirty();
+
+    /**
+     * Stops the periodic writes.
+     */
+    void Close();
+
+   private:
+    void ScheduleWrite();
+
+    Logger const logger_;
+    boost::asio::any_io_executor const executor_;
+    std::string const path_;
+    std::chrono::milliseconds const interval_;
+
+    std::atomic_bool dirty_;
+
+    // Guarded by mutex_.
+    std::mutex mutex_;
+    bool closed_;
+    Encoder encoder_;
+    async::CancellationSource cancel_;
+};
+
+}  // namespace launchdarkly::server_side::data_systems
@@ -13,6 +13,8 @@ namespace launchdarkly::server_side::data_systems {
 
 static char const* const kIdentity = "FDv2 streaming synchronizer";
 
+static char const* const kReconnectsMetric = "data_source.stream_reconnects";
+
 // Maximum time between bytes read from the stream before the SSE client
 // declares the connection dead and reconnects. Must be greater than the
 // streaming service's heartbeat interval. Hardcoded rather than read from
@@ -40,20 +42,27 @@ FDv2StreamingSynchronizer::State::State(
     std::string streaming_base_url,
     config::built::HttpProperties const& http_properties,
     std::optional<std::string> filter_key,
-    std::chrono::milliseconds initial_reconnect_delay)
+    std::chrono::milliseconds initial_reconnect_delay,
+    metrics::Counter* reconnects)
     : logger_(std::move(logger)),
       streaming_base_url_(std::move(streaming_base_url)),
       http_properties_(http_properties),
       filter_key_(std::move(filter_key)),
       initial_reconnect_delay_(initial_reconnect_delay),
-      executor_(executor) {}
+      executor_(executor),
+      reconnects_(reconnects) {}
 
 void FDv2StreamingSynchronizer::State::EnsureStarted(
     data_model::Selector const& selector,
     std::shared_ptr<State> self) {
     {
         std::lock_guard lock(mutex_);
-        latest_selector_ = selector;
+        // Once the stream itself has delivered a selector it is at least as
+        // fresh as the caller's, so reconnects resume from it rather than
+        // from whatever was last applied to the store.
+        if (!received_selector_) {
+            latest_selector_ = selector;
+        }
         if (closed_ || started_) {
             return;
         }
@@ -99,6 +108,8 @@ void FDv2StreamingSynchronizer::State::EnsureStarted(
     client_builder.write_timeout(http_properties_.WriteTimeout());
     client_builder.connect_timeout(http_properties_.ConnectTimeout());
     client_builder.initial_reconnect_delay(initial_reconnect_delay_);
+    // Spread out reconnections when many SDKs lose their streams at once.
+    client_builder.decorrelated_jitter(true);
 
     for (auto const& [key, value] : http_properties_.BaseHeaders()) {
         client_builder.header(key, value);
@@ -220,9 +231,7 @@ void FDv2StreamingSynchronizer::State::OnEvent(sse::Event const& event) {
         Notify(FDv2SourceResult{FDv2SourceResult::Interrupted{
             MakeError(ErrorKind::kInvalidData, 0, std::move(msg))}});
         std::lock_guard lock(mutex_);
-        if (sse_client_) {
-            sse_client_->async_restart("FDv2 parse error");
-        }
+        RestartLocked("FDv2 parse error");
         return;
     }
 
@@ -245,6 +254,11 @@ void FDv2StreamingSynchronizer::State::OnEvent(sse::Event const& event) {
                             ErrorKind::kInvalidData, 0, std::move(msg))}});
                     return;
                 }
+                if (typed->selector.value) {
+                    std::lock_guard lock(mutex_);
+                    latest_selector_ = typed->selector;
+                    received_selector_ = true;
+                }
                 Notify(FDv2SourceResult{
                     FDv2SourceResult::ChangeSet{std::move(*typed)}});
             } else if constexpr (std::is_same_v<T, Goodbye>) {
@@ -266,9 +280,7 @@ void FDv2StreamingSynchronizer::State::OnEvent(sse::Event const& event) {
                 // state.
                 protocol_handler_.Reset();
                 std::lock_guard lock(mutex_);
-                if (sse_client_) {
-                    sse_client_->async_restart("FDv2 goodbye received");
-                }
+                RestartLocked("FDv2 goodbye received");
             } else if constexpr (std::is_same_v<T,
                                                 FDv2ProtocolHandler::Error>) {
                 if (r.kind == FDv2ProtocolHandler::Error::Kind::kServerError) {
@@ -290,9 +302,7 @@ void FDv2StreamingSynchronizer::State::OnEvent(sse::Event const& event) {
                 Notify(FDv2SourceResult{FDv2SourceResult::Interrupted{
                     MakeError(ErrorKind::kInvalidData, 0, r.message)}});
                 std::lock_guard lock(mutex_);
-                if (sse_client_) {
-                    sse_client_->async_restart("FDv2 protocol error");
-                }
+                RestartLocked("FDv2 protocol error");
             } else {
                 static_assert(always_false_v<T>, "non-exhaustive visitor");
             }
@@ -306,6 +316,10 @@ void FDv2StreamingSynchronizer::State::OnError(sse::Error const& error) {
     std::string msg = sse::ErrorToString(error);
 
     if (sse::IsRecoverable(error)) {
+        // The client reconnects after every recoverable error.
+        if (reconnects_) {
+            reconnects_->Add();
+        }
         LD_LOG(logger_, LogLevel::kWarn) << kIdentity << ": " << msg;
         Notify(FDv2SourceResult{FDv2SourceResult::Interrupted{
             MakeError(ErrorKind::kNetworkError, 0, std::move(msg))}});
@@ -327,6 +341,15 @@ void FDv2StreamingSynchronizer::State::OnError(sse::Error const& error) {
         MakeError(ErrorKind::kNetworkError, 0, std::move(msg))}});
 }
 
+void FDv2StreamingSynchronizer::State::RestartLocked(char const* reason) {
+    if (sse_client_) {
+        sse_client_->async_restart(reason);
+        if (reconnects_) {
+            reconnects_->Add();
+        }
+    }
+}
+
 void FDv2StreamingSynchronizer::State::Notify(FDv2SourceResult result) {
     std::optional<async::Promise<FDv2SourceResult>> promise;
     {
@@ -387,13 +410,16 @@ FDv2StreamingSynchronizer::FDv2StreamingSynchronizer(
     std::string streaming_base_url,
     config::built::HttpProperties const& http_properties,
     std::optional<std::string> filter_key,
-    std::chrono::milliseconds initial_reconnect_delay)
-    : state_(std::make_shared<State>(logger,
-                                     executor,
-                                     std::move(streaming_base_url),
-                                     http_properties,
-                                     std::move(filter_key),
-                                     initial_reconnect_delay)) {}
+    std::chrono::milliseconds initial_reconnect_delay,
+    metrics::Registry* metrics)
+    : state_(std::make_shared<State>(
+          logger,
+          executor,
+          std::move(streaming_base_url),
+          http_properties,
+          std::move(filter_key),
+          initial_reconnect_delay,
+          metrics ? &metrics->GetCounter(kReconnectsMetric) : nullptr)) {}
 
 FDv2StreamingSynchronizer::~FDv2StreamingSynchronizer() {
     Close();
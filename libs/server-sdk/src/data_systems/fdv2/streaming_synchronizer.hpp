@@ -6,6 +6,7 @@
 #include <launchdarkly/async/promise.hpp>
 #include <launchdarkly/fdv2_protocol_handler.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/server_side/config/built/all_built.hpp>
 #include <launchdarkly/sse/client.hpp>
 
@@ -49,7 +50,8 @@ class FDv2StreamingSynchronizer final
         std::string streaming_base_url,
         config::built::HttpProperties const& http_properties,
         std::optional<std::string> filter_key,
-        std::chrono::milliseconds initial_reconnect_delay);
+        std::chrono::milliseconds initial_reconnect_delay,
+        metrics::Registry* metrics = nullptr);
 
     ~FDv2StreamingSynchronizer() override;
 
@@ -73,7 +75,8 @@ class FDv2StreamingSynchronizer final
               std::string streaming_base_url,
               config::built::HttpProperties const& http_properties,
               std::optional<std::string> filter_key,
-              std::chrono::milliseconds initial_reconnect_delay);
+              std::chrono::milliseconds initial_reconnect_delay,
+              metrics::Counter* reconnects);
 
         /**
          * Updates the stored selector, starts the SSE client if not already
@@ -128,6 +131,9 @@ class FDv2StreamingSynchronizer final
         void OnEvent(sse::Event const& event);
         void OnError(sse::Error const& error);
 
+        // Restarts the SSE client, if built. Requires mutex_ to be held.
+        void RestartLocked(char const* reason);
+
         // Logger is itself thread-safe.
         Logger logger_;
 
@@ -137,6 +143,8 @@ class FDv2StreamingSynchronizer final
         std::optional<std::string> const filter_key_;
         std::chrono::milliseconds const initial_reconnect_delay_;
         boost::asio::any_io_executor const executor_;
+        // Null unless the synchronizer was given a metrics registry.
+        metrics::Counter* const reconnects_;
 
         // Touched only from SSE callbacks, which all run on the same strand.
         // No lock required.
@@ -150,6 +158,9 @@ class FDv2StreamingSynchronizer final
         std::optional<data_interfaces::FDv1FallbackDirective>
             latest_fdv1_fallback_;
         data_model::Selector latest_selector_;
+        // True once a changeset received on the stream carried a selector;
+        // from then on latest_selector_ tracks the stream rather than Next().
+        bool received_selector_ = false;
         std::optional<boost::urls::url> base_url_;
         std::shared_ptr<sse::Client> sse_client_;
         std::optional<async::Promise<data_interfaces::FDv2SourceResult>>
@@ -12,24 +12,39 @@
 
 namespace launchdarkly::server_side::data_systems {
 
+static char const* const kReconnectsMetric = "data_source.stream_reconnects";
+
+// A streaming synchronizer is only built once the data system starts, or
+// falls back to it. Its metrics are registered when its factory is created,
+// with the client, so that they are reported from the start.
+static void RegisterStreamingMetrics(metrics::Registry* metrics) {
+    if (metrics) {
+        metrics->GetCounter(kReconnectsMetric);
+    }
+}
+
 FDv2StreamingSynchronizerFactory::FDv2StreamingSynchronizerFactory(
     boost::asio::any_io_executor executor,
     Logger logger,
     config::built::ServiceEndpoints endpoints,
     config::built::HttpProperties http_properties,
-    config::built::FDv2Config::StreamingConfig streaming)
+    config::built::FDv2Config::StreamingConfig streaming,
+    metrics::Registry* metrics)
     : executor_(std::move(executor)),
       logger_(std::move(logger)),
       streaming_base_url_(
           streaming.base_url_override.value_or(endpoints.StreamingBaseUrl())),
       http_properties_(std::move(http_properties)),
-      streaming_(std::move(streaming)) {}
+      streaming_(std::move(streaming)),
+      metrics_(metrics) {
+    RegisterStreamingMetrics(metrics_);
+}
 
 std::unique_ptr<data_interfaces::IFDv2Synchronizer>
 FDv2StreamingSynchronizerFactory::Build() {
     return std::make_unique<FDv2StreamingSynchronizer>(
         executor_, logger_, streaming_base_url_, http_properties_, std::nullopt,
-        streaming_.initial_reconnect_delay);
+        streaming_.initial_reconnect_delay, metrics_);
 }
 
 FDv2PollingSynchronizerFactory::FDv2PollingSynchronizerFactory(
@@ -57,12 +72,16 @@ FDv1StreamingAdapterFactory::FDv1StreamingAdapterFactory(
     Logger logger,
     config::built::ServiceEndpoints endpoints,
     config::built::FDv2Config::FDv1StreamingConfig streaming,
-    config::built::HttpProperties http_properties)
+    config::built::HttpProperties http_properties,
+    metrics::Registry* metrics)
     : executor_(std::move(executor)),
       logger_(std::move(logger)),
       endpoints_(std::move(endpoints)),
       streaming_(std::move(streaming)),
-      http_properties_(std::move(http_properties)) {}
+      http_properties_(std::move(http_properties)),
+      metrics_(metrics) {
+    RegisterStreamingMetrics(metrics_);
+}
 
 std::unique_ptr<data_interfaces::IFDv2Synchronizer>
 FDv1StreamingAdapterFactory::Build() {
@@ -70,7 +89,7 @@ FDv1StreamingAdapterFactory::Build() {
         [this](data_components::DataSourceStatusManager& status_manager) {
             return std::make_shared<StreamingDataSource>(
                 executor_, logger_, status_manager, endpoints_, streaming_,
-                http_properties_);
+                http_properties_, metrics_);
         });
 }
 
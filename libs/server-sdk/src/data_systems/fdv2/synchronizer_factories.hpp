@@ -3,6 +3,7 @@
 #include "../../data_interfaces/source/ifdv2_synchronizer_factory.hpp"
 
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
 #include <launchdarkly/server_side/config/built/all_built.hpp>
 #include <launchdarkly/server_side/config/built/data_system/fdv2_config.hpp>
 
@@ -21,7 +22,8 @@ class FDv2StreamingSynchronizerFactory final
         Logger logger,
         config::built::ServiceEndpoints endpoints,
         config::built::HttpProperties http_properties,
-        config::built::FDv2Config::StreamingConfig streaming);
+        config::built::FDv2Config::StreamingConfig streaming,
+        metrics::Registry* metrics = nullptr);
 
     std::unique_ptr<data_interfaces::IFDv2Synchronizer> Build() override;
 
@@ -31,6 +33,7 @@ class FDv2StreamingSynchronizerFactory final
     std::string const streaming_base_url_;
     config::built::HttpProperties const http_properties_;
     config::built::FDv2Config::StreamingConfig const streaming_;
+    metrics::Registry* const metrics_;
 };
 
 /**
@@ -68,7 +71,8 @@ class FDv1StreamingAdapterFactory final
         Logger logger,
         config::built::ServiceEndpoints endpoints,
         config::built::FDv2Config::FDv1StreamingConfig streaming,
-        config::built::HttpProperties http_properties);
+        config::built::HttpProperties http_properties,
+        metrics::Registry* metrics = nullptr);
 
     std::unique_ptr<data_interfaces::IFDv2Synchronizer> Build() override;
 
@@ -80,6 +84,7 @@ class FDv1StreamingAdapterFactory final
     config::built::ServiceEndpoints const endpoints_;
     config::built::FDv2Config::FDv1StreamingConfig const streaming_;
     config::built::HttpProperties const http_properties_;
+    metrics::Registry* const metrics_;
 };
 
 /**
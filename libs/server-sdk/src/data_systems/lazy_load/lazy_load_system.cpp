@@ -28,26 +28,78 @@
 // TTL for this operation is identical to the indivudal-item TTL configurable by
 // the user.
 //
-// An implication of the current implementation is that if Lazy Load is being
-// used to handle a "sparse" environment - that is, the environment is too big
-// to load into memory, and so loading on demand is desirable - calling
-// "AllFlags" will destroy that property because items are not actively evicted
-// from the cache. On the other hand, that property could be used to prime the
-// SDK's memory cache, preventing the need to individually load flags or
-// segments.
+// By default the cache is unbounded. If Lazy Load is being used to handle a
+// "sparse" environment - that is, the environment is too big to load into
+// memory, and so loading on demand is desirable - calling "AllFlags" will
+// destroy that property because items are not actively evicted from the cache.
+// On the other hand, that property could be used to prime the SDK's memory
+// cache, preventing the need to individually load flags or segments.
 //
-// The current design does not perform active eviction when an item is stale
-// because it is generally better to serve stale data than none at all. If the
-// source is unavailable, the SDK will be able to indefinitely serve the last
-// known values. Active eviction can be added in the future as a configurable
-// option.
+// For sparse environments the cache can be bounded by item count and/or
+// approximate bytes. A W-TinyLFU policy then decides which items stay resident:
+// new items enter a small admission window, and only items accessed more often
+// than the main area's least valuable item are admitted to it, so that a scan
+// such as "AllFlags" doesn't flush the working set. An evicted item is removed
+// from the expiration tracker as well, so that its next lookup is a miss, and
+// the kind's 'all' key is forgotten because the cache no longer holds the full
+// set. "AllFlags" on a bounded cache therefore returns the items it fetched
+// rather than the cache's contents.
+//
+// Items are not evicted merely for being stale, because it is generally better
+// to serve stale data than none at all. If the source is unavailable, the SDK
+// will be able to indefinitely serve the last known values of resident items.
+//
+// By default a stale item is refreshed on the evaluating thread, so one request
+// per TTL window pays for a round trip to the source. With the
+// StaleWhileRevalidate refresh policy, the stale item is returned immediately
+// and the refresh is posted to a single background thread. At most one refresh
+// per item (or per 'all' key) is pending at a time, so concurrent requests for
+// the same stale item don't multiply the load on the source. Items which were
+// never cached are always fetched synchronously, as there is nothing to serve
+// in the meantime.
+//
+// Evaluating a flag usually requires its prerequisites and the segments its
+// rules reference. To avoid a sequential round trip for each of them on a cold
+// cache, loading a flag that wasn't cached also loads its untracked
+// dependencies, transitively, with one batched read per data kind for each
+// level of the dependency graph.
+//
+// If the source can notify the SDK of changes (for example, Redis updated by
+// the Relay Proxy), a changed item is marked stale immediately, as if its TTL
+// had elapsed. This allows a long TTL without serving stale data for long.
+// Notifications which don't identify the item mark every item of the kind
+// stale.
+//
+// Synchronous refreshes are coalesced as well: when several threads miss the
+// same item at once (typically during a cold start), one of them fetches and
+// deserializes it while the others wait, and then all of them share the
+// result.
+//
+// A notification can arrive while a refresh of the changed item is in
+// progress, in which case the refresh may have fetched the item before it
+// changed. Each refresh therefore counts the notifications which affect it,
+// and if there were any, caches what it fetched as already stale, so that the
+// next lookup refreshes it again.
+//
+// An item's tracker entry and its cache entry are changed together under one
+// lock, and lookups read both under that lock, so a lookup never finds an
+// item fresh after a bounded cache has evicted it. An item refreshed on the
+// calling thread is returned as fetched rather than read back from the cache,
+// since a bounded cache may evict it again at once.
 
 #include "lazy_load_system.hpp"
 
+#include "../../data_components/bounded_cache/item_size.hpp"
 #include "../../data_components/serialization_adapters/json_deserializer.hpp"
 
+#include <boost/asio/post.hpp>
+
 namespace launchdarkly::server_side::data_systems {
 
+static char const* const kCacheHitsMetric = "lazy_load.cache_hits";
+static char const* const kCacheMissesMetric = "lazy_load.cache_misses";
+static char const* const kRefreshesMetric = "lazy_load.refreshes";
+
 integrations::FlagKind const LazyLoad::Kinds::Flag = integrations::FlagKind();
 
 integrations::SegmentKind const LazyLoad::Kinds::Segment =
@@ -55,22 +107,64 @@ integrations::SegmentKind const LazyLoad::Kinds::Segment =
 
 LazyLoad::LazyLoad(Logger const& logger,
                    config::built::LazyLoadConfig cfg,
-                   data_components::DataSourceStatusManager& status_manager)
-    : LazyLoad(logger, std::move(cfg), status_manager, []() {
-          return std::chrono::steady_clock::now();
-      }) {}
+                   data_components::DataSourceStatusManager& status_manager,
+                   metrics::Registry* metrics)
+    : LazyLoad(
+          logger,
+          std::move(cfg),
+          status_manager,
+          []() { return std::chrono::steady_clock::now(); },
+          metrics) {}
 
 LazyLoad::LazyLoad(Logger const& logger,
                    config::built::LazyLoadConfig cfg,
                    data_components::DataSourceStatusManager& status_manager,
-                   TimeFn time)
+                   TimeFn time,
+                   metrics::Registry* metrics)
     : logger_(logger),
-      reader_(std::make_unique<data_components::JsonDeserializer>(
-          logger,
-          std::move(cfg.source))),
+      cache_(metrics),
+      reader_(std::make_unique<data_components::JsonDeserializer>(logger,
+                                                                   cfg.source)),
       status_manager_(status_manager),
       time_(std::move(time)),
-      fresh_duration_(cfg.refresh_ttl) {}
+      initialized_(false),
+      fresh_duration_(cfg.refresh_ttl),
+      cache_policy_(cfg.cache_max_items != 0 || cfg.cache_max_bytes != 0
+                        ? std::make_unique<data_components::BoundedCachePolicy>(
+                              cfg.cache_max_items,
+                              cfg.cache_max_bytes)
+                        : nullptr),
+      cache_hits_(0),
+      cache_misses_(0),
+      hits_metric_(metrics ? &metrics->GetCounter(kCacheHitsMetric) : nullptr),
+      misses_metric_(metrics ? &metrics->GetCounter(kCacheMissesMetric)
+                             : nullptr),
+      refreshes_metric_(metrics ? &metrics->GetCounter(kRefreshesMetric)
+                                : nullptr),
+      refresh_pool_(cfg.refresh_policy == config::built::LazyLoadConfig::
+                                              RefreshPolicy::StaleWhileRevalidate
+                        ? std::make_unique<boost::asio::thread_pool>(1)
+                        : nullptr) {
+    if (cfg.source) {
+        change_subscription_ = cfg.source->SubscribeToChanges(
+            [this](std::string const& kind_namespace,
+                   std::optional<std::string> const& item_key) {
+                OnChange(kind_namespace, item_key);
+            });
+    }
+}
+
+LazyLoad::~LazyLoad() {
+    if (change_subscription_) {
+        change_subscription_->Disconnect();
+    }
+    if (refresh_pool_) {
+        // Pending refreshes are abandoned; a refresh already in progress is
+        // allowed to finish since it references this object.
+        refresh_pool_->stop();
+        refresh_pool_->join();
+    }
+}
 
 std::string const& LazyLoad::Identity() const {
     static std::string id = "lazy load via " + reader_->Identity();
@@ -86,38 +180,80 @@ void LazyLoad::Initialize() {
 
 std::shared_ptr<data_model::FlagDescriptor> LazyLoad::GetFlag(
     std::string const& key) const {
-    auto const state =
-        tracker_.State(data_components::DataKind::kFlag, key, time_());
-    return Get<std::shared_ptr<data_model::FlagDescriptor>>(
-        key, state, [this, &key]() { RefreshFlag(key); },
-        [this, &key]() { return cache_.GetFlag(key); });
+    auto [state, cached] =
+        Lookup<data_model::Flag>(data_components::DataKind::kFlag, key);
+    RecordLookup(data_components::DataKind::kFlag, key, state);
+    auto flag = GetItem<data_model::Flag>(
+        data_components::DataKind::kFlag, key, state, std::move(cached),
+        [this](std::string const& item_key) { return RefreshFlag(item_key); });
+    if (flag &&
+        state == data_components::ExpirationTracker::TrackState::kNotTracked) {
+        PrefetchDependencies(*flag);
+    }
+    return flag;
 }
 
 std::shared_ptr<data_model::SegmentDescriptor> LazyLoad::GetSegment(
     std::string const& key) const {
-    auto const state =
-        tracker_.State(data_components::DataKind::kSegment, key, time_());
-    return Get<std::shared_ptr<data_model::SegmentDescriptor>>(
-        key, state, [this, &key]() { RefreshSegment(key); },
-        [this, &key]() { return cache_.GetSegment(key); });
+    auto [state, cached] =
+        Lookup<data_model::Segment>(data_components::DataKind::kSegment, key);
+    RecordLookup(data_components::DataKind::kSegment, key, state);
+    return GetItem<data_model::Segment>(
+        data_components::DataKind::kSegment, key, state, std::move(cached),
+        [this](std::string const& item_key) {
+            return RefreshSegment(item_key);
+        });
 }
 
 std::unordered_map<std::string, std::shared_ptr<data_model::FlagDescriptor>>
 LazyLoad::AllFlags() const {
-    auto const state = tracker_.State(Keys::kAllFlags, time_());
+    auto const state = [&]() {
+        std::lock_guard lock(tracker_mutex_);
+        return tracker_.State(Keys::kAllFlags, time_());
+    }();
+    // A bounded cache may hold only some of the flags, so those fetched by a
+    // synchronous refresh are returned directly. (A background refresh can't
+    // share them with this call.)
+    auto fetched = cache_policy_ && RefreshesSynchronously(state)
+                       ? std::make_shared<ItemMap<data_model::Flag>>()
+                       : nullptr;
     return Get<std::unordered_map<std::string,
                                   std::shared_ptr<data_model::FlagDescriptor>>>(
-        Keys::kAllFlags, state, [this]() { RefreshAllFlags(); },
-        [this]() { return cache_.AllFlags(); });
+        std::nullopt, Keys::kAllFlags, state,
+        [this, fetched](std::string const&) {
+            RefreshAllFlags(fetched.get());
+            return RefreshedItem{};
+        },
+        [this, &fetched]() {
+            if (fetched && !fetched->empty()) {
+                return std::move(*fetched);
+            }
+            return cache_.AllFlags();
+        });
 }
 
 std::unordered_map<std::string, std::shared_ptr<data_model::SegmentDescriptor>>
 LazyLoad::AllSegments() const {
-    auto const state = tracker_.State(Keys::kAllSegments, time_());
+    auto const state = [&]() {
+        std::lock_guard lock(tracker_mutex_);
+        return tracker_.State(Keys::kAllSegments, time_());
+    }();
+    auto fetched = cache_policy_ && RefreshesSynchronously(state)
+                       ? std::make_shared<ItemMap<data_model::Segment>>()
+                       : nullptr;
     return Get<std::unordered_map<
         std::string, std::shared_ptr<data_model::SegmentDescriptor>>>(
-        Keys::kAllSegments, state, [this]() { RefreshAllSegments(); },
-        [this]() { return cache_.AllSegments(); });
+        std::nullopt, Keys::kAllSegments, state,
+        [this, fetched](std::string const&) {
+            RefreshAllSegments(fetched.get());
+            return RefreshedItem{};
+        },
+        [this, &fetched]() {
+            if (fetched && !fetched->empty()) {
+                return std::move(*fetched);
+            }
+            return cache_.AllSegments();
+        });
 }
 
 bool LazyLoad::Initialized() const {
@@ -126,51 +262,424 @@ bool LazyLoad::Initialized() const {
      * MemoryStore::Initialized(). Instead, we need to check the state of the
      * underlying source. */
 
-    auto const state = tracker_.State(Keys::kInitialized, time_());
-    if (initialized_.has_value()) {
-        /* Once initialized, we can always return true. */
-        if (initialized_.value()) {
-            return true;
-        }
-        /* If not yet initialized, then we can return false only if the state is
-         * fresh - otherwise we should make an attempt to refresh. */
-        if (data_components::ExpirationTracker::TrackState::kFresh == state) {
-            return false;
-        }
+    /* Once initialized, we can always return true. */
+    if (initialized_) {
+        return true;
+    }
+    auto const state = [&]() {
+        std::lock_guard lock(tracker_mutex_);
+        return tracker_.State(Keys::kInitialized, time_());
+    }();
+    /* If not yet initialized, then we can return false only if the source was
+     * asked recently - otherwise we should make an attempt to refresh. */
+    if (data_components::ExpirationTracker::TrackState::kFresh == state) {
+        return false;
     }
     RefreshInitState();
-    return initialized_.value_or(false);
+    return initialized_;
 }
 
-void LazyLoad::RefreshAllFlags() const {
-    RefreshAll<data_model::Flag>(Keys::kAllFlags,
-                                 data_components::DataKind::kFlag,
-                                 [this]() { return reader_->AllFlags(); });
+LazyLoad::CacheStats LazyLoad::GetCacheStats() const {
+    CacheStats stats{cache_hits_.load(), cache_misses_.load(), 0, 0, 0};
+    if (cache_policy_) {
+        auto const policy_stats = cache_policy_->GetStats();
+        stats.evictions = policy_stats.evictions;
+        stats.items = policy_stats.items;
+        stats.bytes = policy_stats.bytes;
+    }
+    return stats;
 }
 
-void LazyLoad::RefreshAllSegments() const {
+void LazyLoad::RefreshAllFlags(ItemMap<data_model::Flag>* fetched) const {
+    RefreshAll<data_model::Flag>(
+        Keys::kAllFlags, data_components::DataKind::kFlag,
+        [this]() { return reader_->AllFlags(); }, fetched);
+}
+
+void LazyLoad::RefreshAllSegments(
+    ItemMap<data_model::Segment>* fetched) const {
     RefreshAll<data_model::Segment>(
         Keys::kAllSegments, data_components::DataKind::kSegment,
-        [this]() { return reader_->AllSegments(); });
+        [this]() { return reader_->AllSegments(); }, fetched);
 }
 
 void LazyLoad::RefreshInitState() const {
-    initialized_ = reader_->Initialized();
+    if (reader_->Initialized()) {
+        initialized_ = true;
+    }
+    std::lock_guard lock(tracker_mutex_);
     tracker_.Add(Keys::kInitialized, ExpiryTime());
 }
 
-void LazyLoad::RefreshSegment(std::string const& segment_key) const {
-    RefreshItem<data_model::Segment>(
+LazyLoad::RefreshedItem LazyLoad::RefreshCoalesced(
+    RefreshKey const& refresh_key,
+    RefreshFn const& refresh) const {
+    std::shared_ptr<InFlightRefresh> in_flight;
+    bool is_leader = false;
+    {
+        std::lock_guard lock(tracker_mutex_);
+        auto const it = in_flight_.find(refresh_key);
+        if (it != in_flight_.end()) {
+            in_flight = it->second;
+        } else {
+            in_flight = std::make_shared<InFlightRefresh>();
+            in_flight_.emplace(refresh_key, in_flight);
+            is_leader = true;
+        }
+    }
+
+    if (!is_leader) {
+        std::unique_lock lock(in_flight->mutex);
+        in_flight->cv.wait(lock, [&in_flight] { return in_flight->done; });
+        return in_flight->result;
+    }
+
+    // Ensures the in-flight entry is removed and waiters are released on every
+    // leader exit, including throws. Waiters are then left without a result,
+    // as they would be after a failed refresh.
+    struct RefreshCleanup {
+        std::mutex& mutex;
+        std::map<RefreshKey, std::shared_ptr<InFlightRefresh>>& in_flight_map;
+        RefreshKey const& key;
+        std::shared_ptr<InFlightRefresh> in_flight;
+
+        ~RefreshCleanup() {
+            {
+                std::lock_guard lock(mutex);
+                in_flight_map.erase(key);
+            }
+            {
+                std::lock_guard lock(in_flight->mutex);
+                in_flight->done = true;
+            }
+            in_flight->cv.notify_all();
+        }
+    };
+    RefreshCleanup cleanup{tracker_mutex_, in_flight_, refresh_key, in_flight};
+
+    if (refreshes_metric_) {
+        refreshes_metric_->Add();
+    }
+    auto result = refresh(refresh_key.second);
+    {
+        std::lock_guard lock(in_flight->mutex);
+        in_flight->result = result;
+    }
+    return result;
+}
+
+void LazyLoad::RefreshInBackground(RefreshKey refresh_key,
+                                   RefreshFn const& refresh) const {
+    {
+        std::lock_guard lock(tracker_mutex_);
+        if (!refreshing_.insert(refresh_key).second) {
+            return;
+        }
+    }
+    LD_LOG(logger_, LogLevel::kDebug)
+        << Identity() << ": refreshing " << refresh_key.second
+        << " in background";
+    boost::asio::post(*refresh_pool_, [this, refresh_key, refresh]() {
+        refresh(refresh_key.second);
+        std::lock_guard lock(tracker_mutex_);
+        refreshing_.erase(refresh_key);
+    });
+}
+
+LazyLoad::RefreshedItem LazyLoad::RefreshSegment(
+    std::string const& segment_key) const {
+    return RefreshItem<data_model::Segment>(
         data_components::DataKind::kSegment, segment_key,
         [this](std::string const& key) { return reader_->GetSegment(key); },
-        [this](std::string const& key) { return cache_.RemoveSegment(key); });
+        [this](std::string const& key) {
+            if (cache_policy_) {
+                cache_policy_->Remove(data_components::DataKind::kSegment, key);
+            }
+            return cache_.RemoveSegment(key);
+        });
 }
 
-void LazyLoad::RefreshFlag(std::string const& flag_key) const {
-    RefreshItem<data_model::Flag>(
+LazyLoad::RefreshedItem LazyLoad::RefreshFlag(
+    std::string const& flag_key) const {
+    return RefreshItem<data_model::Flag>(
         data_components::DataKind::kFlag, flag_key,
         [this](std::string const& key) { return reader_->GetFlag(key); },
-        [this](std::string const& key) { return cache_.RemoveFlag(key); });
+        [this](std::string const& key) {
+            if (cache_policy_) {
+                cache_policy_->Remove(data_components::DataKind::kFlag, key);
+            }
+            return cache_.RemoveFlag(key);
+        });
+}
+
+void LazyLoad::OnChange(std::string const& kind_namespace,
+                        std::optional<std::string> const& item_key) const {
+    data_components::DataKind kind;
+    if (kind_namespace == Kinds::Flag.Namespace()) {
+        kind = data_components::DataKind::kFlag;
+    } else if (kind_namespace == Kinds::Segment.Namespace()) {
+        kind = data_components::DataKind::kSegment;
+    } else {
+        return;
+    }
+
+    LD_LOG(logger_, LogLevel::kDebug)
+        << Identity() << ": " << kind << " "
+        << (item_key ? *item_key : std::string("(all)")) << " changed";
+
+    auto const now = time_();
+    auto const& all_key = kind == data_components::DataKind::kFlag
+                              ? Keys::kAllFlags
+                              : Keys::kAllSegments;
+    bool tracked = false;
+    {
+        std::lock_guard lock(tracker_mutex_);
+        ++changes_[static_cast<std::size_t>(kind)];
+        for (auto& [item, refreshes] : item_refreshes_) {
+            if (item.first == kind && (!item_key || item.second == *item_key)) {
+                ++refreshes.changes;
+            }
+        }
+        if (tracker_.State(all_key, now) !=
+            data_components::ExpirationTracker::TrackState::kNotTracked) {
+            tracker_.Add(all_key, now);
+        }
+        if (!item_key) {
+            tracker_.ExpireAll(kind, now);
+        } else if (tracker_.State(kind, *item_key, now) !=
+                   data_components::ExpirationTracker::TrackState::
+                       kNotTracked) {
+            tracker_.Add(kind, *item_key, now);
+            tracked = true;
+        }
+    }
+
+    // Items which aren't cached will be fetched when they are needed.
+    if (tracked && refresh_pool_) {
+        if (kind == data_components::DataKind::kFlag) {
+            RefreshInBackground(
+                RefreshKey{kind, *item_key},
+                [this](std::string const& key) { return RefreshFlag(key); });
+        } else {
+            RefreshInBackground(
+                RefreshKey{kind, *item_key},
+                [this](std::string const& key) {
+                    return RefreshSegment(key);
+                });
+        }
+    }
+}
+
+std::shared_ptr<data_model::FlagDescriptor> LazyLoad::Cache(
+    std::string const& key,
+    data_model::FlagDescriptor item,
+    ClockType::time_point const expiry,
+    ChangeWatch const& watch) const {
+    auto cached = std::make_shared<data_model::FlagDescriptor>(std::move(item));
+    auto const size =
+        cache_policy_ ? data_components::ApproximateSize(*cached) : 0;
+
+    std::lock_guard lock(tracker_mutex_);
+    tracker_.Add(data_components::DataKind::kFlag, key, watch.Expiry(expiry));
+    cache_.Upsert(key, cached);
+    if (cache_policy_) {
+        Evict(cache_policy_->Insert(data_components::DataKind::kFlag, key,
+                                    size));
+    }
+    return cached;
+}
+
+std::shared_ptr<data_model::SegmentDescriptor> LazyLoad::Cache(
+    std::string const& key,
+    data_model::SegmentDescriptor item,
+    ClockType::time_point const expiry,
+    ChangeWatch const& watch) const {
+    auto cached =
+        std::make_shared<data_model::SegmentDescriptor>(std::move(item));
+    auto const size =
+        cache_policy_ ? data_components::ApproximateSize(*cached) : 0;
+
+    std::lock_guard lock(tracker_mutex_);
+    tracker_.Add(data_components::DataKind::kSegment, key,
+                 watch.Expiry(expiry));
+    cache_.Upsert(key, cached);
+    if (cache_policy_) {
+        Evict(cache_policy_->Insert(data_components::DataKind::kSegment, key,
+                                    size));
+    }
+    return cached;
+}
+
+void LazyLoad::Evict(
+    std::vector<data_components::BoundedCachePolicy::Key> const& keys) const {
+    for (auto const& [kind, key] : keys) {
+        // The tracker entry goes first: an item is only ever fresh or stale
+        // while it is cached (or known to be missing from the source).
+        tracker_.Remove(kind, key);
+        tracker_.Remove(kind == data_components::DataKind::kFlag
+                            ? Keys::kAllFlags
+                            : Keys::kAllSegments);
+        ++evictions_[static_cast<std::size_t>(kind)];
+        if (kind == data_components::DataKind::kFlag) {
+            cache_.RemoveFlag(key);
+        } else {
+            cache_.RemoveSegment(key);
+        }
+        LD_LOG(logger_, LogLevel::kDebug)
+            << Identity() << ": evicted " << kind << " " << key;
+    }
+}
+
+void LazyLoad::TrackUncached(data_components::DataKind const kind,
+                             std::string const& key,
+                             ClockType::time_point const expiry) const {
+    // A failed refresh may leave a stale item cached; its entry is kept, so
+    // that it is served stale while refreshing rather than treated as a miss.
+    bool const cached = kind == data_components::DataKind::kFlag
+                            ? static_cast<bool>(cache_.GetFlag(key))
+                            : static_cast<bool>(cache_.GetSegment(key));
+    if (cached) {
+        tracker_.Add(kind, key, expiry);
+    } else {
+        tracker_.AddExpiring(kind, key, expiry);
+    }
+    tracker_.PruneExpired(time_());
+}
+
+LazyLoad::ChangeWatch::ChangeWatch(LazyLoad const& lazy_load,
+                                   data_components::DataKind const kind,
+                                   std::string key)
+    : lazy_load_(lazy_load), kind_(kind), key_(std::move(key)) {
+    std::lock_guard lock(lazy_load_.tracker_mutex_);
+    auto& refreshes = lazy_load_.item_refreshes_[{kind_, *key_}];
+    ++refreshes.in_progress;
+    changes_before_ = refreshes.changes;
+}
+
+LazyLoad::ChangeWatch::ChangeWatch(LazyLoad const& lazy_load,
+                                   data_components::DataKind const kind)
+    : lazy_load_(lazy_load), kind_(kind) {
+    std::lock_guard lock(lazy_load_.tracker_mutex_);
+    changes_before_ = Changes();
+}
+
+LazyLoad::ChangeWatch::~ChangeWatch() {
+    if (!key_) {
+        return;
+    }
+    std::lock_guard lock(lazy_load_.tracker_mutex_);
+    auto const it = lazy_load_.item_refreshes_.find({kind_, *key_});
+    if (--it->second.in_progress == 0) {
+        lazy_load_.item_refreshes_.erase(it);
+    }
+}
+
+bool LazyLoad::ChangeWatch::Changed() const {
+    return Changes() != changes_before_;
+}
+
+LazyLoad::ClockType::time_point LazyLoad::ChangeWatch::Expiry(
+    ClockType::time_point const expiry) const {
+    return Changed() ? lazy_load_.time_() : expiry;
+}
+
+std::uint64_t LazyLoad::ChangeWatch::Changes() const {
+    if (key_) {
+        return lazy_load_.item_refreshes_.at({kind_, *key_}).changes;
+    }
+    return lazy_load_.changes_[static_cast<std::size_t>(kind_)];
+}
+
+void LazyLoad::RecordLookup(
+    data_components::DataKind const kind,
+    std::string const& key,
+    data_components::ExpirationTracker::TrackState const state) const {
+    if (state == data_components::ExpirationTracker::TrackState::kNotTracked) {
+        ++cache_misses_;
+        if (misses_metric_) {
+            misses_metric_->Add();
+        }
+        return;
+    }
+    ++cache_hits_;
+    if (hits_metric_) {
+        hits_metric_->Add();
+    }
+    if (cache_policy_) {
+        cache_policy_->Access(kind, key);
+    }
+}
+
+bool LazyLoad::RefreshesSynchronously(
+    data_components::ExpirationTracker::TrackState const state) const {
+    switch (state) {
+        case data_components::ExpirationTracker::TrackState::kNotTracked:
+            return true;
+        case data_components::ExpirationTracker::TrackState::kStale:
+            return !refresh_pool_;
+        case data_components::ExpirationTracker::TrackState::kFresh:
+            return false;
+    }
+    detail::unreachable();
+}
+
+void LazyLoad::PrefetchDependencies(
+    data_model::FlagDescriptor const& flag) const {
+    using data_components::DataKind;
+    using data_components::DependencySet;
+    using data_components::DependencyTracker;
+
+    std::set<std::string> visited_flags;
+    std::set<std::string> visited_segments;
+    std::vector<DependencySet> pending{DependencyTracker::Dependencies(flag)};
+
+    while (!pending.empty()) {
+        std::vector<std::string> flag_keys;
+        std::vector<std::string> segment_keys;
+        {
+            std::lock_guard lock(tracker_mutex_);
+            auto const now = time_();
+            for (auto const& dependencies : pending) {
+                for (auto const& by_kind : dependencies) {
+                    auto const kind = by_kind.Kind();
+                    auto& visited = kind == DataKind::kFlag ? visited_flags
+                                                            : visited_segments;
+                    auto& keys =
+                        kind == DataKind::kFlag ? flag_keys : segment_keys;
+                    for (auto const& key : by_kind.Data()) {
+                        if (!visited.insert(key).second) {
+                            continue;
+                        }
+                        if (tracker_.State(kind, key, now) ==
+                            data_components::ExpirationTracker::TrackState::
+                                kNotTracked) {
+                            keys.push_back(key);
+                        }
+                    }
+                }
+            }
+        }
+        pending.clear();
+
+        if (!flag_keys.empty()) {
+            for (auto const& [key, item] : RefreshMany<data_model::Flag>(
+                     DataKind::kFlag, flag_keys,
+                     [this](std::vector<std::string> const& keys) {
+                         return reader_->GetFlags(keys);
+                     })) {
+                pending.push_back(DependencyTracker::Dependencies(item));
+            }
+        }
+        if (!segment_keys.empty()) {
+            for (auto const& [key, item] : RefreshMany<data_model::Segment>(
+                     DataKind::kSegment, segment_keys,
+                     [this](std::vector<std::string> const& keys) {
+                         return reader_->GetSegments(keys);
+                     })) {
+                pending.push_back(DependencyTracker::Dependencies(item));
+            }
+        }
+    }
 }
 
 std::chrono::time_point<std::chrono::steady_clock> LazyLoad::ExpiryTime()
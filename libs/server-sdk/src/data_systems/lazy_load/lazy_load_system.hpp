@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../../../include/launchdarkly/server_side/integrations/data_reader/kinds.hpp"
+#include "../../data_components/bounded_cache/bounded_cache_policy.hpp"
+#include "../../data_components/dependency_tracker/dependency_tracker.hpp"
 #include "../../data_components/expiration_tracker/expiration_tracker.hpp"
 #include "../../data_components/memory_store/memory_store.hpp"
 #include "../../data_components/status_notifications/data_source_status_manager.hpp"
@@ -10,9 +12,27 @@
 #include <launchdarkly/server_side/config/built/data_system/lazy_load_config.hpp>
 #include <launchdarkly/server_side/integrations/data_reader/iserialized_data_reader.hpp>
 
+#include <launchdarkly/connection.hpp>
 #include <launchdarkly/data_model/descriptors.hpp>
 #include <launchdarkly/detail/unreachable.hpp>
 #include <launchdarkly/logging/logger.hpp>
+#include <launchdarkly/metrics/registry.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace launchdarkly::server_side::data_systems {
 
@@ -24,20 +44,48 @@ namespace launchdarkly::server_side::data_systems {
  *
  * LazyLoad is able to remain efficient because it caches responses from the
  * store. Over time, data becomes stale causing the system to refresh data.
+ *
+ * When a flag is first loaded, its prerequisites and the segments its rules
+ * reference are loaded along with it, using batched reads, so that evaluating
+ * the flag doesn't require a separate round trip for each dependency.
+ *
+ * By default, stale data is refreshed on the thread which requested it. If
+ * configured with RefreshPolicy::StaleWhileRevalidate, stale data is returned
+ * immediately and refreshed on a background thread instead.
+ *
+ * The cache may be bounded by item count and/or approximate bytes, in which
+ * case a W-TinyLFU policy decides which items remain resident. An evicted item
+ * is forgotten entirely, including its TTL, and is loaded again on demand.
+ *
+ * If the source supports change notifications, items are marked stale as soon
+ * as they change in the source, rather than when their TTL elapses.
  */
 class LazyLoad final : public data_interfaces::IDataSystem {
    public:
     using ClockType = std::chrono::steady_clock;
     using TimeFn = std::function<std::chrono::time_point<ClockType>()>;
 
+    /**
+     * @param metrics If present, cache hits, misses and refreshes are counted
+     * in it, and the cache records its lock waits. Must outlive the system.
+     */
     explicit LazyLoad(Logger const& logger,
                       config::built::LazyLoadConfig cfg,
-                      data_components::DataSourceStatusManager& status_manager);
+                      data_components::DataSourceStatusManager& status_manager,
+                      metrics::Registry* metrics = nullptr);
 
     LazyLoad(Logger const& logger,
              config::built::LazyLoadConfig cfg,
              data_components::DataSourceStatusManager& status_manager,
-             TimeFn time);
+             TimeFn time,
+             metrics::Registry* metrics = nullptr);
+
+    ~LazyLoad() override;
+
+    LazyLoad(LazyLoad const&) = delete;
+    LazyLoad(LazyLoad&&) = delete;
+    LazyLoad& operator=(LazyLoad const&) = delete;
+    LazyLoad& operator=(LazyLoad&&) = delete;
 
     std::string const& Identity() const override;
 
@@ -58,6 +106,22 @@ class LazyLoad final : public data_interfaces::IDataSystem {
 
     bool Initialized() const override;
 
+    struct CacheStats {
+        // Lookups of individual flags or segments which found the item
+        // tracked (fresh or stale), or not.
+        std::uint64_t hits;
+        std::uint64_t misses;
+        // The following are only tracked when the cache is bounded.
+        std::uint64_t evictions;
+        std::size_t items;
+        std::size_t bytes;
+    };
+
+    /**
+     * @return Statistics about the in-memory cache.
+     */
+    [[nodiscard]] CacheStats GetCacheStats() const;
+
     // Public for usage in tests.
     struct Kinds {
         static integrations::FlagKind const Flag;
@@ -65,29 +129,236 @@ class LazyLoad final : public data_interfaces::IDataSystem {
     };
 
    private:
-    void RefreshAllFlags() const;
-    void RefreshAllSegments() const;
+    // Identifies an in-flight background refresh. Unscoped keys (such as
+    // 'allFlags') have std::nullopt as the kind.
+    using RefreshKey =
+        std::pair<std::optional<data_components::DataKind>, std::string>;
+
+    // The result of refreshing a single item: the item as fetched (null if
+    // the source doesn't have it), or std::monostate if the refresh failed or
+    // wasn't of a single item. A bounded cache may evict an item as soon as
+    // it is stored, so callers use this rather than reading it back.
+    using RefreshedItem =
+        std::variant<std::monostate,
+                     std::shared_ptr<data_model::FlagDescriptor>,
+                     std::shared_ptr<data_model::SegmentDescriptor>>;
+    using RefreshFn = std::function<RefreshedItem(std::string const&)>;
+
+    // A refresh shared by all callers that miss the same item concurrently:
+    // the leader performs it, stores its result, and notifies; waiters block
+    // on cv until then, and then take the result.
+    struct InFlightRefresh {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+        RefreshedItem result;
+    };
+
+    /**
+     * Counts the change notifications which affect a refresh while it is in
+     * progress, so that the refresh doesn't mark data fresh which may have
+     * changed after it was fetched. Created before fetching, and consulted
+     * under tracker_mutex_ when the results are tracked.
+     */
+    class ChangeWatch {
+       public:
+        // Watches a single item, which is affected by notifications for
+        // that item or for its whole kind.
+        ChangeWatch(LazyLoad const& lazy_load,
+                    data_components::DataKind kind,
+                    std::string key);
+        // Watches every item of a kind, which is affected by any
+        // notification for the kind.
+        ChangeWatch(LazyLoad const& lazy_load, data_components::DataKind kind);
+        ~ChangeWatch();
+
+        ChangeWatch(ChangeWatch const&) = delete;
+        ChangeWatch(ChangeWatch&&) = delete;
+        ChangeWatch& operator=(ChangeWatch const&) = delete;
+        ChangeWatch& operator=(ChangeWatch&&) = delete;
+
+        /**
+         * @return True if a notification arrived since the watch was
+         * created. tracker_mutex_ must be held.
+         */
+        [[nodiscard]] bool Changed() const;
+
+        /**
+         * @return The given expiry, or the current time if a notification
+         * arrived since the watch was created, so that the refreshed data is
+         * stale at once. tracker_mutex_ must be held.
+         */
+        [[nodiscard]] ClockType::time_point Expiry(
+            ClockType::time_point expiry) const;
+
+       private:
+        [[nodiscard]] std::uint64_t Changes() const;
+
+        LazyLoad const& lazy_load_;
+        data_components::DataKind const kind_;
+        std::optional<std::string> const key_;
+        std::uint64_t changes_before_;
+    };
+
+    // Single-item refreshes in progress, and the notifications for the item
+    // while any of them is. An entry is removed once they are all done.
+    struct ItemRefreshes {
+        std::size_t in_progress = 0;
+        std::uint64_t changes = 0;
+    };
+
+    template <typename Item>
+    using ItemMap = std::unordered_map<
+        std::string,
+        std::shared_ptr<data_model::ItemDescriptor<Item>>>;
+
+    // If fetched is non-null, the refreshed items are also stored in it.
+    void RefreshAllFlags(ItemMap<data_model::Flag>* fetched) const;
+    void RefreshAllSegments(ItemMap<data_model::Segment>* fetched) const;
     void RefreshInitState() const;
-    void RefreshFlag(std::string const& key) const;
-    void RefreshSegment(std::string const& key) const;
+    RefreshedItem RefreshFlag(std::string const& key) const;
+    RefreshedItem RefreshSegment(std::string const& key) const;
+
+    /**
+     * Handles a change notification from the source by marking the changed
+     * items (and the 'all' key for their kind) stale, and counting it
+     * against any refreshes of them in progress. Under the
+     * StaleWhileRevalidate policy, a changed item is also refreshed in the
+     * background immediately.
+     */
+    void OnChange(std::string const& kind_namespace,
+                  std::optional<std::string> const& item_key) const;
+
+    /**
+     * Loads the dependency closure of a flag (prerequisites, segments
+     * referenced by its rules, and so on transitively) that is not yet
+     * cached. Each level of the closure is loaded with one batched read per
+     * data kind.
+     */
+    void PrefetchDependencies(data_model::FlagDescriptor const& flag) const;
+
+    /**
+     * Stores an item in the cache and marks it fresh until the given time,
+     * unless the watch saw it change meanwhile, evicting others if the cache
+     * is bounded. Both happen under tracker_mutex_, so a lookup never finds
+     * the item fresh but not cached.
+     * @return The item. It may already have been evicted from the cache.
+     */
+    std::shared_ptr<data_model::FlagDescriptor> Cache(
+        std::string const& key,
+        data_model::FlagDescriptor item,
+        ClockType::time_point expiry,
+        ChangeWatch const& watch) const;
+    std::shared_ptr<data_model::SegmentDescriptor> Cache(
+        std::string const& key,
+        data_model::SegmentDescriptor item,
+        ClockType::time_point expiry,
+        ChangeWatch const& watch) const;
+
+    /**
+     * Removes items chosen by the cache policy from the expiration tracker
+     * and from the cache. Since the cache no longer holds every item of that
+     * kind, the kind's 'all' key is forgotten too. tracker_mutex_ must be
+     * held.
+     */
+    void Evict(std::vector<data_components::BoundedCachePolicy::Key> const&
+                   keys) const;
+
+    /**
+     * Marks an item fresh until the given time without caching it, as for an
+     * item missing from the source or one whose refresh failed. If the item
+     * isn't cached, its entry is pruned once it expires, so that lookups of
+     * many distinct missing keys don't grow the tracker without bound.
+     * tracker_mutex_ must be held.
+     */
+    void TrackUncached(data_components::DataKind kind,
+                       std::string const& key,
+                       ClockType::time_point expiry) const;
+
+    /**
+     * @return The number of items of a kind evicted so far. tracker_mutex_
+     * must be held.
+     */
+    [[nodiscard]] std::uint64_t Evictions(
+        data_components::DataKind const kind) const {
+        return evictions_[static_cast<std::size_t>(kind)];
+    }
+
+    /**
+     * @return The tracking state of an item and, unless it isn't tracked, its
+     * cached value, read together under tracker_mutex_.
+     */
+    template <typename Item>
+    std::pair<data_components::ExpirationTracker::TrackState,
+              std::shared_ptr<data_model::ItemDescriptor<Item>>>
+    Lookup(data_components::DataKind const kind, std::string const& key) const {
+        std::lock_guard lock(tracker_mutex_);
+        auto const state = tracker_.State(kind, key, time_());
+        if (state == data_components::ExpirationTracker::TrackState::
+                         kNotTracked) {
+            return {state, nullptr};
+        }
+        return {state, Cached<Item>(key)};
+    }
+
+    template <typename Item>
+    std::shared_ptr<data_model::ItemDescriptor<Item>> Cached(
+        std::string const& key) const {
+        if constexpr (std::is_same_v<Item, data_model::Flag>) {
+            return cache_.GetFlag(key);
+        } else {
+            return cache_.GetSegment(key);
+        }
+    }
+
+    void RecordLookup(
+        data_components::DataKind kind,
+        std::string const& key,
+        data_components::ExpirationTracker::TrackState state) const;
+
+    /**
+     * @return True if a lookup in the given state refreshes the item on the
+     * calling thread.
+     */
+    [[nodiscard]] bool RefreshesSynchronously(
+        data_components::ExpirationTracker::TrackState state) const;
+
+    /**
+     * Refreshes the item on the calling thread, coalescing concurrent
+     * refreshes of the same item into one fetch from the source.
+     * @return The result of the refresh, whichever caller performed it.
+     */
+    RefreshedItem RefreshCoalesced(RefreshKey const& refresh_key,
+                                   RefreshFn const& refresh) const;
+
+    /**
+     * Refreshes the item on the background pool, unless a refresh for the
+     * same item is already pending.
+     */
+    void RefreshInBackground(RefreshKey refresh_key,
+                             RefreshFn const& refresh) const;
 
     static std::string CacheTraceMsg(
         data_components::ExpirationTracker::TrackState state);
 
     template <typename TResult>
-    TResult Get(std::string const& key,
+    TResult Get(std::optional<data_components::DataKind> const kind,
+                std::string const& key,
                 data_components::ExpirationTracker::TrackState const state,
-
-                std::function<void(void)> const& refresh,
+                RefreshFn const& refresh,
                 std::function<TResult(void)> const& get) const {
         LD_LOG(logger_, LogLevel::kDebug)
             << Identity() << ": get " << key << " - " << CacheTraceMsg(state);
 
         switch (state) {
             case data_components::ExpirationTracker::TrackState::kStale:
+                if (refresh_pool_) {
+                    RefreshInBackground(RefreshKey{kind, key}, refresh);
+                    return get();
+                }
                 [[fallthrough]];
             case data_components::ExpirationTracker::TrackState::kNotTracked:
-                refresh();
+                RefreshCoalesced(RefreshKey{kind, key}, refresh);
                 [[fallthrough]];
             case data_components::ExpirationTracker::TrackState::kFresh:
                 return get();
@@ -95,36 +366,68 @@ class LazyLoad final : public data_interfaces::IDataSystem {
         detail::unreachable();
     }
 
+    /**
+     * Gets a single item. Items refreshed on the calling thread are returned
+     * as fetched; otherwise the cached value found by the lookup is returned.
+     */
+    template <typename Item>
+    std::shared_ptr<data_model::ItemDescriptor<Item>> GetItem(
+        data_components::DataKind const kind,
+        std::string const& key,
+        data_components::ExpirationTracker::TrackState const state,
+        std::shared_ptr<data_model::ItemDescriptor<Item>> cached,
+        RefreshFn const& refresh) const {
+        using ItemPtr = std::shared_ptr<data_model::ItemDescriptor<Item>>;
+
+        LD_LOG(logger_, LogLevel::kDebug)
+            << Identity() << ": get " << key << " - " << CacheTraceMsg(state);
+
+        switch (state) {
+            case data_components::ExpirationTracker::TrackState::kStale:
+                if (refresh_pool_) {
+                    RefreshInBackground(RefreshKey{kind, key}, refresh);
+                    return cached;
+                }
+                [[fallthrough]];
+            case data_components::ExpirationTracker::TrackState::kNotTracked: {
+                auto refreshed =
+                    RefreshCoalesced(RefreshKey{kind, key}, refresh);
+                if (auto* item = std::get_if<ItemPtr>(&refreshed)) {
+                    return std::move(*item);
+                }
+                // The refresh failed, so serve whatever is cached.
+                std::lock_guard lock(tracker_mutex_);
+                return Cached<Item>(key);
+            }
+            case data_components::ExpirationTracker::TrackState::kFresh:
+                return cached;
+        }
+        detail::unreachable();
+    }
+
     template <typename Item, typename Evictor>
-    void RefreshItem(
+    RefreshedItem RefreshItem(
         data_components::DataKind const kind,
         std::string const& key,
         std::function<data_interfaces::IDataReader::SingleResult<Item>(
             std::string const&)> const& getter,
         Evictor&& evictor) const {
-        // Refreshing this item is always rate limited, even
-        // if the refresh has an error.
-        tracker_.Add(kind, key, ExpiryTime());
-
-        if (auto expected_item = getter(key)) {
-            status_manager_.SetState(DataSourceState::kValid);
-
-            if (auto optional_item = *expected_item) {
-                cache_.Upsert(key, std::move(*optional_item));
-            } else {
-                // If the item is actually *missing* - not just a deleted
-                // tombstone representation - it implies that the source
-                // was re-initialized. In this case, the correct thing to do
-                // is evict it from the memory cache
-                LD_LOG(logger_, LogLevel::kDebug)
-                    << kind << key << " requested but not found via "
-                    << reader_->Identity();
-                if (evictor(key)) {
-                    LD_LOG(logger_, LogLevel::kDebug)
-                        << "removed " << kind << " " << key << " from cache";
-                }
+        using ItemPtr = std::shared_ptr<data_model::ItemDescriptor<Item>>;
+
+        // Refreshing this item is always rate limited, even if the refresh
+        // has an error. The item is marked fresh only once the fetch is done,
+        // together with the cache update, so that concurrent lookups meanwhile
+        // join this refresh (or serve the stale item) rather than find it
+        // fresh but not yet cached.
+        auto const expiry = ExpiryTime();
+        ChangeWatch const watch(*this, kind, key);
+
+        auto expected_item = getter(key);
+        if (!expected_item) {
+            {
+                std::lock_guard lock(tracker_mutex_);
+                TrackUncached(kind, key, watch.Expiry(expiry));
             }
-        } else {
             status_manager_.SetState(
                 DataSourceState::kInterrupted,
                 common::data_sources::DataSourceStatusErrorKind::kUnknown,
@@ -135,7 +438,33 @@ class LazyLoad final : public data_interfaces::IDataSystem {
             LD_LOG(logger_, LogLevel::kError)
                 << "failed to refresh " << kind << " " << key << " via "
                 << reader_->Identity() << ": " << expected_item.error();
+            return std::monostate{};
+        }
+
+        status_manager_.SetState(DataSourceState::kValid);
+
+        if (auto optional_item = *expected_item) {
+            return Cache(key, std::move(*optional_item), expiry, watch);
         }
+
+        // If the item is actually *missing* - not just a deleted tombstone
+        // representation - it implies that the source was re-initialized. In
+        // this case, the correct thing to do is evict it from the memory
+        // cache.
+        LD_LOG(logger_, LogLevel::kDebug) << kind << key
+                                          << " requested but not found via "
+                                          << reader_->Identity();
+        bool removed = false;
+        {
+            std::lock_guard lock(tracker_mutex_);
+            removed = evictor(key);
+            TrackUncached(kind, key, watch.Expiry(expiry));
+        }
+        if (removed) {
+            LD_LOG(logger_, LogLevel::kDebug)
+                << "removed " << kind << " " << key << " from cache";
+        }
+        return ItemPtr{};
     }
 
     template <typename Item>
@@ -144,24 +473,49 @@ class LazyLoad final : public data_interfaces::IDataSystem {
         data_components::DataKind const item_kind,
         std::function<
             data_interfaces::IDataReader::CollectionResult<Item>()> const&
-            getter) const {
+            getter,
+        ItemMap<Item>* fetched) const {
         // The 'all' key and the individual item keys should expire
         // at exactly the same time, because there is no separate data item
         // for 'all' - it exists only to rate limit the refresh of all items.
         auto const updated_expiry = ExpiryTime();
 
-        // Refreshing 'all' for this item is always rate limited, even if
-        // the refresh has an error.
-        tracker_.Add(all_item_key, updated_expiry);
+        auto const evictions_before = [&]() {
+            std::lock_guard lock(tracker_mutex_);
+            return Evictions(item_kind);
+        }();
+        ChangeWatch const watch(*this, item_kind);
 
-        if (auto all_items = getter()) {
+        // Refreshing 'all' for this item is always rate limited, even if
+        // the refresh has an error. As for single items, it is marked fresh
+        // only once the items are cached.
+        auto all_items = getter();
+        if (all_items) {
             status_manager_.SetState(DataSourceState::kValid);
 
             for (auto item : *all_items) {
-                cache_.Upsert(item.first, std::move(item.second));
-                tracker_.Add(item_kind, item.first, updated_expiry);
+                // A bounded cache may not be able to hold every item, so
+                // the caller may need them directly.
+                auto cached = Cache(item.first, std::move(item.second),
+                                    updated_expiry, watch);
+                if (fetched) {
+                    fetched->emplace(item.first, std::move(cached));
+                }
             }
-        } else {
+        }
+        {
+            std::lock_guard lock(tracker_mutex_);
+            // If a bounded cache evicted an item of this kind meanwhile, it
+            // doesn't hold every item, so 'all' is left untracked and the
+            // next request fetches them again. Likewise if an item of this
+            // kind changed meanwhile, since it may have been fetched before
+            // the change; the notification already marked 'all' stale.
+            if (!watch.Changed() &&
+                (!all_items || Evictions(item_kind) == evictions_before)) {
+                tracker_.Add(all_item_key, updated_expiry);
+            }
+        }
+        if (!all_items) {
             status_manager_.SetState(
                 DataSourceState::kInterrupted,
                 common::data_sources::DataSourceStatusErrorKind::kUnknown,
@@ -175,6 +529,42 @@ class LazyLoad final : public data_interfaces::IDataSystem {
         }
     }
 
+    template <typename Item>
+    data_interfaces::IDataReader::Collection<Item> RefreshMany(
+        data_components::DataKind const kind,
+        std::vector<std::string> const& keys,
+        std::function<data_interfaces::IDataReader::CollectionResult<Item>(
+            std::vector<std::string> const&)> const& getter) const {
+        ChangeWatch const watch(*this, kind);
+        auto items = getter(keys);
+        if (!items) {
+            // The keys are left untracked, so each will be fetched
+            // individually (and rate limited) if it is evaluated.
+            LD_LOG(logger_, LogLevel::kWarn)
+                << "failed to prefetch " << keys.size() << " " << kind
+                << "s via " << reader_->Identity() << ": " << items.error();
+            return {};
+        }
+
+        status_manager_.SetState(DataSourceState::kValid);
+
+        auto const updated_expiry = ExpiryTime();
+        for (auto const& [key, item] : *items) {
+            Cache(key, item, updated_expiry, watch);
+        }
+        // Keys which weren't returned don't exist in the source; like a
+        // missing item fetched individually, they are rate limited too.
+        {
+            std::lock_guard lock(tracker_mutex_);
+            for (auto const& key : keys) {
+                if (items->count(key) == 0) {
+                    TrackUncached(kind, key, watch.Expiry(updated_expiry));
+                }
+            }
+        }
+        return std::move(*items);
+    }
+
     ClockType::time_point ExpiryTime() const;
 
     Logger const& logger_;
@@ -184,12 +574,53 @@ class LazyLoad final : public data_interfaces::IDataSystem {
 
     data_components::DataSourceStatusManager& status_manager_;
 
+    // Guards tracker_, refreshing_, and in_flight_, which are accessed from
+    // evaluating threads and the background refresh pool.
+    mutable std::mutex tracker_mutex_;
     mutable data_components::ExpirationTracker tracker_;
+    mutable std::set<RefreshKey> refreshing_;
+    mutable std::map<RefreshKey, std::shared_ptr<InFlightRefresh>> in_flight_;
+    // Items evicted, by kind. Also guarded by tracker_mutex_.
+    mutable std::array<std::uint64_t,
+                       static_cast<std::size_t>(
+                           data_components::DataKind::kKindCount)>
+        evictions_{};
+    // Change notifications, by kind, and single-item refreshes in progress.
+    // Also guarded by tracker_mutex_.
+    mutable std::array<std::uint64_t,
+                       static_cast<std::size_t>(
+                           data_components::DataKind::kKindCount)>
+        changes_{};
+    mutable std::map<std::pair<data_components::DataKind, std::string>,
+                     ItemRefreshes>
+        item_refreshes_;
+
     TimeFn time_;
-    mutable std::optional<bool> initialized_;
+    // Once the source reports that it is initialized, it is never asked
+    // again. Until then, the 'initialized' tracker key rate limits asking.
+    mutable std::atomic<bool> initialized_;
 
     ClockType::duration fresh_duration_;
 
+    // Present only when the cache is bounded.
+    std::unique_ptr<data_components::BoundedCachePolicy> cache_policy_;
+    mutable std::atomic<std::uint64_t> cache_hits_;
+    mutable std::atomic<std::uint64_t> cache_misses_;
+
+    // Null unless the system was given a metrics registry.
+    metrics::Counter* const hits_metric_;
+    metrics::Counter* const misses_metric_;
+    metrics::Counter* const refreshes_metric_;
+
+    // Present only when the refresh policy is StaleWhileRevalidate. The
+    // destructor stops and joins it before any member used by refreshes is
+    // destroyed.
+    std::unique_ptr<boost::asio::thread_pool> refresh_pool_;
+
+    // Present only if the source supports change notifications. Disconnected
+    // first on destruction, since the handler references this object.
+    std::unique_ptr<IConnection> change_subscription_;
+
     struct Keys {
         static inline std::string const kAllFlags = "allFlags";
         static inline std::string const kAllSegments = "allSegments";
@@ -24,9 +24,36 @@ int Precedence(enum EvaluationReason::BigSegmentsStatus status) {
 }
 }  // namespace
 
+BigSegmentMemberships::Entry const* BigSegmentMemberships::Find(
+    std::string const& context_key) const {
+    auto const it = entries_.find(context_key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void BigSegmentMemberships::Store(
+    std::string context_key,
+    MembershipPtr membership,
+    enum EvaluationReason::BigSegmentsStatus status) {
+    entries_.emplace(std::move(context_key),
+                     Entry{std::move(membership), status});
+}
+
+void BigSegmentMemberships::RecordStoreError(std::string context_key) {
+    entries_.emplace(
+        std::move(context_key),
+        Entry{nullptr, EvaluationReason::BigSegmentsStatus::kStoreError});
+}
+
 EvaluationStack::EvaluationStack(
-    data_components::BigSegmentStoreWrapper* big_segment_store)
-    : big_segment_store_(big_segment_store) {}
+    data_components::BigSegmentStoreWrapper* big_segment_store,
+    data_model::Flag const* flag,
+    BigSegmentMemberships* memberships)
+    : big_segment_store_(big_segment_store),
+      flag_(flag),
+      memberships_(memberships ? memberships : &own_memberships_) {}
 
 Guard::Guard(std::unordered_set<std::string>& set, std::string key)
     : set_(set), key_(std::move(key)) {
@@ -65,31 +92,41 @@ void EvaluationStack::RecordBigSegmentsStatus(
     }
 }
 
+data_model::Flag const* EvaluationStack::TopLevelFlag() const {
+    return flag_;
+}
+
 enum EvaluationReason::BigSegmentsStatus
 EvaluationStack::BigSegmentsStatus() const {
     return big_segments_status_;
 }
 
-integrations::Membership const* EvaluationStack::FindMembership(
+bool EvaluationStack::LookedUpMembership(
     std::string const& context_key) const {
-    auto const it = memberships_.find(context_key);
-    if (it == memberships_.end()) {
+    return memberships_->Find(context_key) != nullptr;
+}
+
+data_components::CompactMembership const* EvaluationStack::UseMembership(
+    std::string const& context_key) {
+    auto const* entry = memberships_->Find(context_key);
+    if (!entry) {
         return nullptr;
     }
-    return &it->second;
+    // The lookup may have been made by an earlier evaluation sharing the
+    // memberships, so its status is recorded again for this one.
+    RecordBigSegmentsStatus(entry->status);
+    return entry->membership.get();
 }
 
-void EvaluationStack::StoreMembership(std::string context_key,
-                                      integrations::Membership membership) {
-    memberships_.emplace(std::move(context_key), std::move(membership));
+void EvaluationStack::StoreMembership(
+    std::string context_key,
+    std::shared_ptr<data_components::CompactMembership const> membership,
+    enum EvaluationReason::BigSegmentsStatus status) {
+    memberships_->Store(std::move(context_key), std::move(membership), status);
 }
 
 void EvaluationStack::RecordStoreError(std::string context_key) {
-    store_error_keys_.insert(std::move(context_key));
-}
-
-bool EvaluationStack::DidStoreError(std::string const& context_key) const {
-    return store_error_keys_.find(context_key) != store_error_keys_.end();
+    memberships_->RecordStoreError(std::move(context_key));
 }
 
 }  // namespace launchdarkly::server_side::evaluation
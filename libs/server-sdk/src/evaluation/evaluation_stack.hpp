@@ -1,13 +1,19 @@
 #pragma once
 
+#include "../data_components/big_segments/compact_membership.hpp"
+
 #include <launchdarkly/data/evaluation_reason.hpp>
-#include <launchdarkly/server_side/integrations/big_segments/big_segment_store_types.hpp>
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 
+namespace launchdarkly::data_model {
+struct Flag;
+}  // namespace launchdarkly::data_model
+
 namespace launchdarkly::server_side::data_components {
 class BigSegmentStoreWrapper;
 }  // namespace launchdarkly::server_side::data_components
@@ -33,10 +39,52 @@ struct Guard {
     std::string const key_;
 };
 
+/**
+ * BigSegmentMemberships holds the Big Segment memberships looked up for one
+ * context, and the status of each lookup. Evaluations of several flags for the
+ * same context may share an instance, so that each context key is looked up
+ * once for all of them.
+ *
+ * Not thread-safe.
+ */
+class BigSegmentMemberships {
+   public:
+    using MembershipPtr =
+        std::shared_ptr<data_components::CompactMembership const>;
+
+    struct Entry {
+        // Null if the store returned an error for the key.
+        MembershipPtr membership;
+        enum EvaluationReason::BigSegmentsStatus status;
+    };
+
+    /**
+     * @return The lookup of the given unhashed context key, or nullptr if it
+     * hasn't been looked up.
+     */
+    [[nodiscard]] Entry const* Find(std::string const& context_key) const;
+
+    /**
+     * Records a context key's membership and the status of its lookup.
+     */
+    void Store(std::string context_key,
+               MembershipPtr membership,
+               enum EvaluationReason::BigSegmentsStatus status);
+
+    /**
+     * Records that the store returned an error for a context key, so that
+     * later lookups treat it as a non-match without re-querying.
+     */
+    void RecordStoreError(std::string context_key);
+
+   private:
+    std::unordered_map<std::string, Entry> entries_;
+};
+
 /**
  * EvaluationStack holds the per-evaluation state for a single top-level flag
  * evaluation: the prerequisite/segment chains used for circular-reference
- * detection, plus the Big Segments status and membership cache that a Big
+ * detection, plus the Big Segments status and the memberships that a Big
  * Segment lookup populates.
  *
  * Not thread-safe: a fresh instance is created per top-level evaluation and is
@@ -47,9 +95,22 @@ class EvaluationStack {
     /**
      * @param big_segment_store Non-owning pointer to the Big Segment store
      * wrapper, or nullptr if no store is configured. Must outlive the stack.
+     * @param flag Non-owning pointer to the top-level flag being evaluated, or
+     * nullptr if unknown. Must outlive the stack.
+     * @param memberships Non-owning pointer to memberships already looked up
+     * for the context, which this evaluation reads and adds to, or nullptr to
+     * start with none. Must outlive the stack.
      */
     explicit EvaluationStack(
-        data_components::BigSegmentStoreWrapper* big_segment_store = nullptr);
+        data_components::BigSegmentStoreWrapper* big_segment_store = nullptr,
+        data_model::Flag const* flag = nullptr,
+        BigSegmentMemberships* memberships = nullptr);
+
+    EvaluationStack(EvaluationStack const&) = delete;
+    EvaluationStack& operator=(EvaluationStack const&) = delete;
+
+    EvaluationStack(EvaluationStack&&) = delete;
+    EvaluationStack& operator=(EvaluationStack&&) = delete;
 
     /**
      * If the given prerequisite key has not been seen, marks it as seen
@@ -76,6 +137,13 @@ class EvaluationStack {
     [[nodiscard]] data_components::BigSegmentStoreWrapper* BigSegmentStore()
         const;
 
+    /**
+     * @return The top-level flag being evaluated, or nullptr if unknown. Used
+     * to find every Big Segment the evaluation may consult, so that their
+     * memberships can be fetched from the store together.
+     */
+    [[nodiscard]] data_model::Flag const* TopLevelFlag() const;
+
     /**
      * Records the status of a Big Segment lookup. If multiple lookups occur in
      * one evaluation, the least-trustworthy status wins (NOT_CONFIGURED >
@@ -91,42 +159,47 @@ class EvaluationStack {
         const;
 
     /**
-     * Returns the cached membership for a context key looked up earlier in this
-     * evaluation, or nullptr if that key has not been queried yet.
+     * @return True if the membership of the given context key has been looked
+     * up, whether or not the lookup succeeded.
      */
-    [[nodiscard]] integrations::Membership const* FindMembership(
-        std::string const& context_key) const;
+    [[nodiscard]] bool LookedUpMembership(std::string const& context_key) const;
 
     /**
-     * Caches a context key's membership so later Big Segment lookups for the
-     * same key in this evaluation reuse it instead of re-querying the store.
+     * Returns the membership of a context key looked up earlier, and records
+     * the status of that lookup for this evaluation. Returns nullptr if the key
+     * hasn't been looked up or the store returned an error for it.
      */
-    void StoreMembership(std::string context_key,
-                         integrations::Membership membership);
+    [[nodiscard]] data_components::CompactMembership const* UseMembership(
+        std::string const& context_key);
 
     /**
-     * Records that the Big Segment store returned an error for the given
-     * context key during this evaluation. Subsequent Big Segment lookups for
-     * the same key must be treated as non-matches without re-querying.
+     * Records a context key's membership and the status of its lookup, so
+     * later Big Segment lookups for the same key reuse it instead of
+     * re-querying the store.
      */
-    void RecordStoreError(std::string context_key);
+    void StoreMembership(
+        std::string context_key,
+        std::shared_ptr<data_components::CompactMembership const> membership,
+        enum EvaluationReason::BigSegmentsStatus status);
 
     /**
-     * @return True if a Big Segment store lookup for the given context key has
-     * already errored during this evaluation.
+     * Records that the Big Segment store returned an error for the given
+     * context key. Subsequent Big Segment lookups for the same key must be
+     * treated as non-matches without re-querying.
      */
-    [[nodiscard]] bool DidStoreError(std::string const& context_key) const;
+    void RecordStoreError(std::string context_key);
 
    private:
     std::unordered_set<std::string> prerequisites_seen_;
     std::unordered_set<std::string> segments_seen_;
 
     data_components::BigSegmentStoreWrapper* big_segment_store_;
+    data_model::Flag const* flag_;
     enum EvaluationReason::BigSegmentsStatus big_segments_status_ =
         EvaluationReason::BigSegmentsStatus::kNone;
-    // Keyed by unhashed context key. Empty until the first Big Segment lookup.
-    std::unordered_map<std::string, integrations::Membership> memberships_;
-    std::unordered_set<std::string> store_error_keys_;
+    // Used when the caller doesn't share its memberships.
+    BigSegmentMemberships own_memberships_;
+    BigSegmentMemberships* memberships_;
 };
 
 }  // namespace launchdarkly::server_side::evaluation
@@ -50,8 +50,9 @@ EvaluationDetail<Value> Evaluator::Evaluate(
 EvaluationDetail<Value> Evaluator::Evaluate(
     Flag const& flag,
     launchdarkly::Context const& context,
-    EventScope const& event_scope) {
-    EvaluationStack stack{big_segment_store_};
+    EventScope const& event_scope,
+    BigSegmentMemberships* memberships) {
+    EvaluationStack stack{big_segment_store_, &flag, memberships};
     auto detail = Evaluate(std::nullopt, flag, context, stack, event_scope);
     auto status = stack.BigSegmentsStatus();
     if (status != EvaluationReason::BigSegmentsStatus::kNone) {
@@ -182,6 +183,8 @@ EvaluationDetail<Value> Evaluator::FlagVariation(
         return EvaluationReason::MalformedFlag();
     }
 
+    // Copying a Value shares the storage of large strings, arrays, and objects,
+    // so this doesn't copy the variation itself.
     return {flag.variations.at(variation_index), variation_index,
             std::move(reason)};
 }
@@ -243,7 +246,7 @@ std::optional<std::size_t> TargetMatchVariation(
 }
 
 void Evaluator::LogError(std::string const& key, Error const& error) const {
-    LD_LOG(logger_, LogLevel::kError)
+    LD_LOG_RATE_LIMITED(logger_, LogLevel::kError, error_log_limiter_)
         << "Invalid flag configuration detected in flag \"" << key
         << "\": " << error;
 }
@@ -38,11 +38,15 @@ class Evaluator {
      * @param stack The evaluation stack used for detecting circular references.
      * @param event_scope The event scope used for recording prerequisite
      * events.
+     * @param memberships Big Segment memberships already looked up for the
+     * context, which the evaluation reads and adds to, or nullptr. Lets
+     * evaluations of several flags for one context share their lookups.
      */
     [[nodiscard]] EvaluationDetail<Value> Evaluate(
         data_model::Flag const& flag,
         Context const& context,
-        EventScope const& event_scope);
+        EventScope const& event_scope,
+        BigSegmentMemberships* memberships = nullptr);
 
     /**
      * Evaluates a flag for a given context. Does not record prerequisite
@@ -76,5 +80,9 @@ class Evaluator {
     Logger& logger_;
     data_interfaces::IStore const& source_;
     data_components::BigSegmentStoreWrapper* big_segment_store_;
+
+    // A malformed flag is reported on every evaluation of it, so LogError is
+    // rate limited.
+    mutable LogRateLimiter error_log_limiter_;
 };
 }  // namespace launchdarkly::server_side::evaluation
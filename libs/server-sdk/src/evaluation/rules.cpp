@@ -4,9 +4,12 @@
 
 #include "../data_components/big_segments/big_segment_store_wrapper.hpp"
 
+#include <algorithm>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace launchdarkly::server_side::evaluation {
 
@@ -30,8 +33,126 @@ enum EvaluationReason::BigSegmentsStatus ToBigSegmentsStatus(
     return EvaluationReason::BigSegmentsStatus::kHealthy;
 }
 
-std::string MakeBigSegmentRef(Segment const& segment) {
-    return segment.key + ".g" + std::to_string(*segment.generation);
+// The context kind whose key is looked up in the store for a Big Segment. An
+// absent or empty unboundedContextKind defaults to "user".
+ContextKind BigSegmentContextKind(Segment const& segment) {
+    return (segment.unboundedContextKind &&
+            !segment.unboundedContextKind->t.empty())
+               ? *segment.unboundedContextKind
+               : ContextKind{"user"};
+}
+
+// Walks the flags and segments reachable from a flag, collecting the context
+// keys that its Big Segments may look up, so that all of their memberships can
+// be fetched from the store at once.
+class BigSegmentKeyCollector {
+   public:
+    BigSegmentKeyCollector(Context const& context,
+                           data_interfaces::IStore const& store)
+        : context_(context), store_(store) {}
+
+    void VisitFlag(Flag const& flag) {
+        if (!flags_seen_.insert(flag.key).second) {
+            return;
+        }
+        for (auto const& prerequisite : flag.prerequisites) {
+            auto const descriptor = store_.GetFlag(prerequisite.key);
+            if (descriptor && descriptor->item) {
+                VisitFlag(*descriptor->item);
+            }
+        }
+        for (auto const& rule : flag.rules) {
+            VisitClauses(rule.clauses);
+        }
+    }
+
+    [[nodiscard]] std::vector<std::string> const& Keys() const {
+        return keys_;
+    }
+
+   private:
+    void VisitClauses(std::vector<Clause> const& clauses) {
+        for (auto const& clause : clauses) {
+            if (clause.op != Clause::Op::kSegmentMatch) {
+                continue;
+            }
+            for (auto const& value : clause.values) {
+                if (value.IsString()) {
+                    VisitSegment(value.AsString());
+                }
+            }
+        }
+    }
+
+    void VisitSegment(std::string const& segment_key) {
+        if (!segments_seen_.insert(segment_key).second) {
+            return;
+        }
+        auto const descriptor = store_.GetSegment(segment_key);
+        if (!descriptor || !descriptor->item) {
+            return;
+        }
+        Segment const& segment = *descriptor->item;
+        if (segment.unbounded && segment.generation) {
+            Value const& key =
+                context_.Get(BigSegmentContextKind(segment), "key");
+            if (key.IsString() &&
+                std::find(keys_.begin(), keys_.end(), key.AsString()) ==
+                    keys_.end()) {
+                keys_.push_back(key.AsString());
+            }
+        }
+        for (auto const& rule : segment.rules) {
+            VisitClauses(rule.clauses);
+        }
+    }
+
+    Context const& context_;
+    data_interfaces::IStore const& store_;
+    std::unordered_set<std::string> flags_seen_;
+    std::unordered_set<std::string> segments_seen_;
+    std::vector<std::string> keys_;
+};
+
+// Looks up the membership of the given context key, from the wrapper's cache
+// if present, and records it (or the failure) on the stack. On a cache miss,
+// if the store batches lookups, the memberships of every other context key the
+// evaluation's Big Segments may look up are fetched in the same query; a store
+// which doesn't batch is asked only for the key needed now.
+void LoadBigSegmentMemberships(std::string const& context_key,
+                               Context const& context,
+                               data_interfaces::IStore const& store,
+                               EvaluationStack& stack) {
+    auto& wrapper = *stack.BigSegmentStore();
+    if (auto cached = wrapper.GetCachedMembership(context_key)) {
+        stack.StoreMembership(context_key, std::move(cached->membership),
+                              ToBigSegmentsStatus(cached->status));
+        return;
+    }
+
+    std::vector<std::string> keys{context_key};
+    auto const* flag = stack.TopLevelFlag();
+    if (flag && wrapper.BatchesMemberships()) {
+        BigSegmentKeyCollector collector(context, store);
+        collector.VisitFlag(*flag);
+        for (auto const& key : collector.Keys()) {
+            if (key != context_key && !stack.LookedUpMembership(key)) {
+                keys.push_back(key);
+            }
+        }
+    }
+
+    auto result = wrapper.GetMemberships(keys);
+    auto const status = ToBigSegmentsStatus(result.status);
+    if (status == EvaluationReason::BigSegmentsStatus::kStoreError) {
+        for (auto& key : keys) {
+            stack.RecordStoreError(std::move(key));
+        }
+        return;
+    }
+    for (auto& [key, membership] : result.memberships) {
+        stack.StoreMembership(key, std::move(membership), status);
+    }
 }
 
 // Evaluates membership in an unbounded (Big) segment. Returns true/false for a
@@ -39,6 +160,7 @@ std::string MakeBigSegmentRef(Segment const& segment) {
 // for this segment and evaluation should fall through to the segment's rules.
 std::optional<bool> MatchBigSegment(Segment const& segment,
                                     Context const& context,
+                                    data_interfaces::IStore const& store,
                                     EvaluationStack& stack) {
     if (!segment.generation) {
         // Without a generation the segment ref can't be formed.
@@ -47,41 +169,37 @@ std::optional<bool> MatchBigSegment(Segment const& segment,
         return false;
     }
 
-    // An absent or empty unboundedContextKind defaults to "user".
-    ContextKind const kind = (segment.unboundedContextKind &&
-                              !segment.unboundedContextKind->t.empty())
-                                 ? *segment.unboundedContextKind
-                                 : ContextKind{"user"};
-    Value const& context_key = context.Get(kind, "key");
+    Value const& context_key =
+        context.Get(BigSegmentContextKind(segment), "key");
     if (!context_key.IsString()) {
         return false;
     }
     std::string const& key = context_key.AsString();
 
-    if (stack.DidStoreError(key)) {
-        return false;
-    }
-
-    integrations::Membership const* membership = stack.FindMembership(key);
-    if (!membership) {
-        auto* store = stack.BigSegmentStore();
-        if (!store) {
+    if (!stack.LookedUpMembership(key)) {
+        if (!stack.BigSegmentStore()) {
             stack.RecordBigSegmentsStatus(
                 EvaluationReason::BigSegmentsStatus::kNotConfigured);
             return false;
         }
-        auto result = store->GetMembership(key);
-        auto const status = ToBigSegmentsStatus(result.status);
-        stack.RecordBigSegmentsStatus(status);
-        if (status == EvaluationReason::BigSegmentsStatus::kStoreError) {
-            stack.RecordStoreError(key);
-            return false;
-        }
-        stack.StoreMembership(key, std::move(result.membership));
-        membership = stack.FindMembership(key);
+        LoadBigSegmentMemberships(key, context, store, stack);
     }
 
-    return membership->CheckMembership(MakeBigSegmentRef(segment));
+    // Null if the store returned an error for the key.
+    data_components::CompactMembership const* membership =
+        stack.UseMembership(key);
+    if (!membership) {
+        return false;
+    }
+
+    // A ref which no membership has mentioned can't have an entry in this
+    // one.
+    auto const segment_ref = stack.BigSegmentStore()->FindSegmentRef(
+        segment.key, *segment.generation);
+    if (!segment_ref) {
+        return std::nullopt;
+    }
+    return membership->CheckMembership(*segment_ref);
 }
 
 }  // namespace
@@ -241,7 +359,7 @@ tl::expected<bool, Error> Contains(Segment const& segment,
     }
 
     if (segment.unbounded) {
-        if (auto match = MatchBigSegment(segment, context, stack)) {
+        if (auto match = MatchBigSegment(segment, context, store, stack)) {
             return *match;
         }
         // Big segments don't use the regular include/exclude target lists; a
@@ -1,27 +1,54 @@
 #include <launchdarkly/server_side/hooks/hook.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace launchdarkly::server_side::hooks {
 
+// Both HookContext and EvaluationSeriesData store their entries as a vector of
+// (key, value) pairs sorted by key.
+
+template <typename Entries>
+static auto LowerBound(Entries& entries, std::string const& key) {
+    return std::lower_bound(
+        entries.begin(), entries.end(), key,
+        [](auto const& entry, std::string const& k) { return entry.first < k; });
+}
+
+template <typename Entries>
+static auto Find(Entries const& entries, std::string const& key) {
+    auto const it = LowerBound(entries, key);
+    return it != entries.end() && it->first == key ? it : entries.end();
+}
+
+template <typename Entries, typename T>
+static void Insert(Entries& entries, std::string key, T value) {
+    if (auto const it = LowerBound(entries, key);
+        it != entries.end() && it->first == key) {
+        it->second = std::move(value);
+    } else {
+        entries.emplace(it, std::move(key), std::move(value));
+    }
+}
+
 // HookContext implementation
 
 HookContext& HookContext::Set(std::string key,
                                std::shared_ptr<std::any> value) {
-    data_[std::move(key)] = std::move(value);
+    Insert(data_, std::move(key), std::move(value));
     return *this;
 }
 
 std::optional<std::shared_ptr<std::any>> HookContext::Get(
     std::string const& key) const {
-    if (const auto it = data_.find(key); it != data_.end()) {
+    if (const auto it = Find(data_, key); it != data_.end()) {
         return it->second;
     }
     return std::nullopt;
 }
 
 bool HookContext::Has(std::string const& key) const {
-    return data_.find(key) != data_.end();
+    return Find(data_, key) != data_.end();
 }
 
 // HookMetadata implementation
@@ -36,27 +63,26 @@ std::string_view HookMetadata::Name() const {
 
 EvaluationSeriesData::EvaluationSeriesData() = default;
 
-EvaluationSeriesData::EvaluationSeriesData(
-    std::map<std::string, DataEntry> data)
+EvaluationSeriesData::EvaluationSeriesData(Entries data)
     : data_(std::move(data)) {}
 
 std::optional<std::reference_wrapper<Value const>> EvaluationSeriesData::Get(std::string const& key) const {
-    if (const auto it = data_.find(key); it != data_.end() && it->second.value) {
-        return it->second.value;
+    if (const auto it = Find(data_, key); it != data_.end() && it->second.value) {
+        return *it->second.value;
     }
     return std::nullopt;
 }
 
 std::optional<std::shared_ptr<std::any>> EvaluationSeriesData::GetShared(
     std::string const& key) const {
-    if (const auto it = data_.find(key); it != data_.end() && it->second.shared) {
+    if (const auto it = Find(data_, key); it != data_.end() && it->second.shared) {
         return it->second.shared;
     }
     return std::nullopt;
 }
 
 bool EvaluationSeriesData::Has(std::string const& key) const {
-    return data_.find(key) != data_.end();
+    return Find(data_, key) != data_.end();
 }
 
 std::vector<std::string> EvaluationSeriesData::Keys() const {
@@ -80,7 +106,7 @@ EvaluationSeriesDataBuilder& EvaluationSeriesDataBuilder::Set(std::string key,
                                                                Value value) {
     EvaluationSeriesData::DataEntry entry;
     entry.value = std::move(value);
-    data_[std::move(key)] = std::move(entry);
+    Insert(data_, std::move(key), std::move(entry));
     return *this;
 }
 
@@ -89,7 +115,7 @@ EvaluationSeriesDataBuilder& EvaluationSeriesDataBuilder::SetShared(
     std::shared_ptr<std::any> value) {
     EvaluationSeriesData::DataEntry entry;
     entry.shared = std::move(value);
-    data_[std::move(key)] = std::move(entry);
+    Insert(data_, std::move(key), std::move(entry));
     return *this;
 }
 
@@ -100,16 +126,16 @@ EvaluationSeriesData EvaluationSeriesDataBuilder::Build() const {
 // EvaluationSeriesContext implementation
 
 EvaluationSeriesContext::EvaluationSeriesContext(
-    std::string flag_key,
+    std::string const& flag_key,
     Context const& context,
-    Value default_value,
-    std::string method,
+    Value const& default_value,
+    std::string const& method,
     HookContext const& hook_context,
     std::optional<std::string> environment_id)
-    : flag_key_(std::move(flag_key)),
+    : flag_key_(flag_key),
       context_(context),
-      default_value_(std::move(default_value)),
-      method_(std::move(method)),
+      default_value_(default_value),
+      method_(method),
       hook_context_(hook_context),
       environment_id_(std::move(environment_id)) {}
 
@@ -1,6 +1,7 @@
 #include "hook_executor.hpp"
 
 #include <exception>
+#include <utility>
 
 namespace launchdarkly::server_side::hooks {
 
@@ -18,7 +19,7 @@ void EvaluationSeriesExecutor::BeforeEvaluation(
     for (std::size_t i = 0; i < hooks_.size(); ++i) {
         try {
             series_data_[i] =
-                hooks_[i]->BeforeEvaluation(context, series_data_[i]);
+                hooks_[i]->BeforeEvaluation(context, EvaluationSeriesData());
         } catch (std::exception const& e) {
             LogHookError("BeforeEvaluation",
                          std::string(hooks_[i]->Metadata().Name()),
@@ -39,8 +40,9 @@ void EvaluationSeriesExecutor::AfterEvaluation(
     // Execute hooks in reverse order of registration
     for (std::size_t i = hooks_.size(); i-- > 0;) {
         try {
-            series_data_[i] =
-                hooks_[i]->AfterEvaluation(context, series_data_[i], detail);
+            // This is the last stage, so the data can be handed over.
+            series_data_[i] = hooks_[i]->AfterEvaluation(
+                context, std::move(series_data_[i]), detail);
         } catch (std::exception const& e) {
             LogHookError("AfterEvaluation",
                          std::string(hooks_[i]->Metadata().Name()),
@@ -3,6 +3,8 @@
 #include <launchdarkly/logging/logger.hpp>
 #include <launchdarkly/server_side/hooks/hook.hpp>
 
+#include <boost/container/small_vector.hpp>
+
 #include <memory>
 #include <optional>
 #include <string>
@@ -67,8 +69,9 @@ class EvaluationSeriesExecutor {
     Logger& logger_;
 
     // Per-invocation series data for each hook.
-    // The outer vector index corresponds to hook index.
-    std::vector<EvaluationSeriesData> series_data_;
+    // The outer vector index corresponds to hook index. Stored inline for
+    // typical hook counts, so that an evaluation doesn't allocate for it.
+    boost::container::small_vector<EvaluationSeriesData, 4> series_data_;
 
     void LogHookError(std::string const& stage,
                       std::string const& hook_name,
@@ -1,11 +1,17 @@
 #include <gtest/gtest.h>
 
 #include "all_flags_state/all_flags_state_builder.hpp"
+#include "all_flags_state/all_flags_state_json_writer.hpp"
 
 #include <launchdarkly/server_side/serialization/json_all_flags_state.hpp>
 
 #include <boost/json.hpp>
 
+#include <cstring>
+#include <map>
+#include <tuple>
+#include <vector>
+
 using namespace launchdarkly;
 using namespace launchdarkly::server_side;
 
@@ -288,3 +294,85 @@ TEST(AllFlagsTest,
         return kvp.second == state;
     }));
 }
+
+// The JSON written directly by AllFlagsStateJsonWriter must be equivalent to
+// serializing the AllFlagsState built from the same flags.
+TEST(AllFlagsTest, JsonWriterMatchesBuilderSerialization) {
+    std::vector<std::tuple<std::string, Value, AllFlagsState::State>> flags{
+        {"tracked",
+         true,
+         {42, 1, EvaluationReason::Fallthrough(false), true, true,
+          std::nullopt, {"a", "b"}}},
+        {"untracked",
+         Value{"a", 1.5},
+         {43, 0, EvaluationReason::Off(), false, false, 5, {}}},
+        {"error",
+         Value::Null(),
+         {44, std::nullopt,
+          EvaluationReason::MalformedFlag(), false, false, std::nullopt,
+          {}}},
+        {"object",
+         Value{std::map<std::string, Value>{{"k", "v\n\"q\""}}},
+         {45, 2, std::nullopt, false, false, 0, {}}}};
+
+    for (auto const options :
+         {AllFlagsState::Options::Default,
+          AllFlagsState::Options::IncludeReasons,
+          AllFlagsState::Options::DetailsOnlyForTrackedFlags,
+          AllFlagsState::Options::IncludeReasons |
+              AllFlagsState::Options::DetailsOnlyForTrackedFlags}) {
+        AllFlagsStateBuilder builder{options};
+        std::string json;
+        AllFlagsStateJsonWriter writer{options, json};
+        for (auto const& [key, value, state] : flags) {
+            builder.AddFlag(key, value, state);
+            writer.AddFlag(key, value, state);
+        }
+        writer.Finish();
+
+        ASSERT_EQ(boost::json::parse(json),
+                  boost::json::value_from(builder.Build()));
+    }
+}
+
+TEST(AllFlagsTest, JsonWriterEmptyAndInvalid) {
+    std::string json;
+    AllFlagsStateJsonWriter writer{AllFlagsState::Options::Default, json};
+    writer.Finish();
+    ASSERT_EQ(json, R"({"$valid":true,"$flagsState":{}})");
+
+    AllFlagsStateJsonWriter::WriteInvalid(json);
+    ASSERT_EQ(json, R"({"$valid":false,"$flagsState":{}})");
+    ASSERT_EQ(boost::json::parse(json),
+              boost::json::value_from(AllFlagsState{}));
+}
+
+TEST(AllFlagsTest, JsonWriterWritesIntoBuffer) {
+    AllFlagsState::State const state{
+        42, 1, EvaluationReason::Fallthrough(false), false, false,
+        std::nullopt, {}};
+
+    std::string json;
+    AllFlagsStateJsonWriter string_writer{AllFlagsState::Options::Default,
+                                          json};
+    string_writer.AddFlag("flag", "value", state);
+    string_writer.Finish();
+
+    std::vector<char> buffer(json.size());
+    AllFlagsStateJsonWriter buffer_writer{
+        AllFlagsState::Options::Default,
+        JsonOutput(buffer.data(), buffer.size())};
+    buffer_writer.AddFlag("flag", "value", state);
+    buffer_writer.Finish();
+
+    ASSERT_EQ(buffer_writer.Length(), json.size());
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), json);
+
+    // A buffer which is too small holds the start of the JSON, and the full
+    // length is still reported.
+    std::vector<char> small(8);
+    ASSERT_EQ(AllFlagsStateJsonWriter::WriteInvalid(
+                  JsonOutput(small.data(), small.size())),
+              std::strlen(R"({"$valid":false,"$flagsState":{}})"));
+    ASSERT_EQ(std::string(small.begin(), small.end()), R"({"$valid)");
+}
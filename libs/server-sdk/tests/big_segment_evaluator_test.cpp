@@ -16,6 +16,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 using namespace launchdarkly;
 using namespace launchdarkly::server_side;
@@ -46,6 +47,20 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
         return integrations::Membership::FromSegmentRefs({}, {});
     }
 
+    GetMembershipsResult GetMemberships(
+        std::vector<std::string> const& hashes) const noexcept override {
+        {
+            std::lock_guard lock(mutex_);
+            ++batch_calls_;
+        }
+        return IBigSegmentStore::GetMemberships(hashes);
+    }
+
+    bool BatchesMemberships() const noexcept override {
+        std::lock_guard lock(mutex_);
+        return batches_;
+    }
+
     GetMetadataResult GetMetadata() const noexcept override {
         std::lock_guard lock(mutex_);
         return metadata_;
@@ -56,6 +71,11 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
         responses_.push_back(std::move(response));
     }
 
+    void SetBatches(bool batches) {
+        std::lock_guard lock(mutex_);
+        batches_ = batches;
+    }
+
     void SetMetadata(GetMetadataResult metadata) {
         std::lock_guard lock(mutex_);
         metadata_ = std::move(metadata);
@@ -66,9 +86,16 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
         return membership_calls_;
     }
 
+    int BatchCalls() const {
+        std::lock_guard lock(mutex_);
+        return batch_calls_;
+    }
+
    private:
     mutable std::mutex mutex_;
     mutable int membership_calls_ = 0;
+    mutable int batch_calls_ = 0;
+    bool batches_ = false;
     mutable std::deque<GetMembershipResult> responses_;
     // Defaults to fresh metadata so a successful lookup reports HEALTHY.
     GetMetadataResult metadata_ = std::optional<integrations::StoreMetadata>{
@@ -346,4 +373,96 @@ TEST_F(BigSegmentEvaluatorTest, QueriesStoreOncePerContextKey) {
     EXPECT_EQ(fake_->MembershipCalls(), 1);
 }
 
+TEST_F(BigSegmentEvaluatorTest, FetchesAllContextKeysInOneQuery) {
+    // The org segment is only reachable through a nested segmentMatch, and
+    // the unused kind's key must not be fetched.
+    UpsertSegment("bigsegA", UnboundedSegment("bigsegA", "user", true, ""));
+    UpsertSegment("bigsegB", UnboundedSegment("bigsegB", "org", true, ""));
+    UpsertSegment(
+        "outer",
+        R"({"key":"outer","included":[],"excluded":[],"rules":[{"id":"r",)"
+        R"("clauses":[{"op":"segmentMatch","values":["bigsegB"]}]}],)"
+        R"("salt":"salty","version":1})");
+    UpsertFlag(FlagMatchingSegments({"bigsegA", "outer"}));
+    fake_->SetBatches(true);
+
+    auto context = ContextBuilder()
+                       .Kind("user", "alice")
+                       .Kind("org", "org1")
+                       .Kind("device", "phone")
+                       .Build();
+    auto eval = EvaluatorWithStore();
+    auto detail = eval.Evaluate(store_.GetFlag("flag")->item.value(), context);
+
+    EXPECT_EQ(*detail, Value(true));
+    EXPECT_EQ(detail.Reason()->BigSegmentsStatus(),
+              EvaluationReason::BigSegmentsStatus::kHealthy);
+    EXPECT_EQ(fake_->BatchCalls(), 1);
+    EXPECT_EQ(fake_->MembershipCalls(), 2);
+}
+
+TEST_F(BigSegmentEvaluatorTest, NonBatchingStoreIsQueriedOnlyForNeededKeys) {
+    // The user segment matches, so the org segment behind "outer" is never
+    // reached and its key must not be fetched speculatively.
+    UpsertSegment("bigsegA", UnboundedSegment("bigsegA", "user", true, ""));
+    UpsertSegment("bigsegB", UnboundedSegment("bigsegB", "org", true, ""));
+    UpsertSegment(
+        "outer",
+        R"({"key":"outer","included":[],"excluded":[],"rules":[{"id":"r",)"
+        R"("clauses":[{"op":"segmentMatch","values":["bigsegB"]}]}],)"
+        R"("salt":"salty","version":1})");
+    UpsertFlag(FlagMatchingSegments({"bigsegA", "outer"}));
+    fake_->PushMembership(Included("bigsegA.g1"));
+
+    auto context =
+        ContextBuilder().Kind("user", "alice").Kind("org", "org1").Build();
+    auto eval = EvaluatorWithStore();
+    auto detail = eval.Evaluate(store_.GetFlag("flag")->item.value(), context);
+
+    EXPECT_EQ(*detail, Value(false));
+    EXPECT_EQ(fake_->BatchCalls(), 1);
+    EXPECT_EQ(fake_->MembershipCalls(), 1);
+}
+
+TEST_F(BigSegmentEvaluatorTest, CachedMembershipIsNotQueriedAgain) {
+    UpsertSegment("bigseg", UnboundedSegment("bigseg", "user", true, ""));
+    UpsertFlag(FlagMatchingSegments({"bigseg"}));
+    fake_->PushMembership(Included("bigseg.g1"));
+    fake_->SetBatches(true);
+
+    auto eval = EvaluatorWithStore();
+    auto first =
+        eval.Evaluate(store_.GetFlag("flag")->item.value(), AliceUser());
+    auto second =
+        eval.Evaluate(store_.GetFlag("flag")->item.value(), AliceUser());
+
+    EXPECT_EQ(*second, Value(false));
+    EXPECT_EQ(second.Reason()->BigSegmentsStatus(),
+              EvaluationReason::BigSegmentsStatus::kHealthy);
+    EXPECT_EQ(fake_->BatchCalls(), 1);
+    EXPECT_EQ(fake_->MembershipCalls(), 1);
+}
+
+TEST_F(BigSegmentEvaluatorTest, SharedMembershipsAreLookedUpOnce) {
+    // A failed lookup isn't cached by the wrapper, so only the shared
+    // memberships keep the second evaluation from querying the store again.
+    UpsertSegment("bigseg", UnboundedSegment("bigseg", "user", true, ""));
+    UpsertFlag(FlagMatchingSegments({"bigseg"}));
+    fake_->PushMembership(tl::make_unexpected(std::string("boom")));
+
+    auto eval = EvaluatorWithStore();
+    evaluation::BigSegmentMemberships memberships;
+    auto first = eval.Evaluate(store_.GetFlag("flag")->item.value(),
+                               AliceUser(), EventScope{}, &memberships);
+    auto second = eval.Evaluate(store_.GetFlag("flag")->item.value(),
+                                AliceUser(), EventScope{}, &memberships);
+
+    EXPECT_EQ(fake_->MembershipCalls(), 1);
+    for (auto const& detail : {first, second}) {
+        EXPECT_EQ(*detail, Value(true));
+        EXPECT_EQ(detail.Reason()->BigSegmentsStatus(),
+                  EvaluationReason::BigSegmentsStatus::kStoreError);
+    }
+}
+
 }  // namespace
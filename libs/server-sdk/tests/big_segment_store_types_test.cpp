@@ -2,6 +2,9 @@
 
 #include <launchdarkly/server_side/integrations/big_segments/big_segment_store_types.hpp>
 
+#include <map>
+#include <string>
+
 using launchdarkly::server_side::integrations::Membership;
 
 TEST(MembershipTests, EmptyHasNoEntries) {
@@ -37,3 +40,16 @@ TEST(MembershipTests, DifferentGenerationsAreDistinct) {
     ASSERT_EQ(m.CheckMembership("seg.g1"), false);
     ASSERT_EQ(m.CheckMembership("seg.g2"), true);
 }
+
+TEST(MembershipTests, ForEachSegmentRefVisitsEveryEntry) {
+    auto const m = Membership::FromSegmentRefs({"seg1.g1", "seg.g1"},
+                                               {"seg2.g1", "seg.g1"});
+
+    std::map<std::string, bool> entries;
+    m.ForEachSegmentRef([&entries](std::string const& ref, bool included) {
+        entries.emplace(ref, included);
+    });
+    ASSERT_EQ(entries,
+              (std::map<std::string, bool>{
+                  {"seg.g1", true}, {"seg1.g1", true}, {"seg2.g1", false}}));
+}
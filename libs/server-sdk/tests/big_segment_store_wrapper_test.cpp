@@ -9,8 +9,10 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -38,6 +40,15 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
         return membership_;
     }
 
+    GetMembershipsResult GetMemberships(
+        std::vector<std::string> const& hashes) const noexcept override {
+        {
+            std::lock_guard lock(mutex_);
+            batch_sizes_.push_back(hashes.size());
+        }
+        return IBigSegmentStore::GetMemberships(hashes);
+    }
+
     GetMetadataResult GetMetadata() const noexcept override {
         std::lock_guard lock(mutex_);
         ++metadata_calls_;
@@ -65,6 +76,12 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
         return metadata_calls_;
     }
 
+    // Number of hashes passed to each GetMemberships call.
+    std::vector<std::size_t> BatchSizes() const {
+        std::lock_guard lock(mutex_);
+        return batch_sizes_;
+    }
+
     void WaitForMembershipCalls(int n, std::chrono::milliseconds timeout) {
         std::unique_lock lock(mutex_);
         cv_.wait_for(lock, timeout, [&] { return membership_calls_ >= n; });
@@ -97,6 +114,7 @@ class FakeBigSegmentStore : public integrations::IBigSegmentStore {
     // All of the following are protected by mutex_.
     mutable int metadata_calls_ = 0;
     mutable int membership_calls_ = 0;
+    mutable std::vector<std::size_t> batch_sizes_;
     GetMetadataResult metadata_ =
         std::optional<integrations::StoreMetadata>{std::nullopt};
     GetMembershipResult membership_ =
@@ -131,6 +149,19 @@ class StatusCollector {
     std::vector<BigSegmentStoreStatus> statuses_;
 };
 
+// Checks a membership returned by the wrapper for the given segment ref.
+std::optional<bool> Check(
+    BigSegmentStoreWrapper const& wrapper,
+    BigSegmentStoreWrapper::MembershipPtr const& membership,
+    std::string const& segment_key,
+    std::uint64_t generation) {
+    auto const id = wrapper.FindSegmentRef(segment_key, generation);
+    if (!id) {
+        return std::nullopt;
+    }
+    return membership->CheckMembership(*id);
+}
+
 built::BigSegmentsConfig MakeConfig(
     std::shared_ptr<integrations::IBigSegmentStore> store,
     std::chrono::milliseconds poll_interval,
@@ -266,8 +297,8 @@ TEST(BigSegmentStoreWrapperMembershipTest,
 
     auto result = wrapper->GetMembership("ctx");
     EXPECT_EQ(BigSegmentsStatus::kHealthy, result.status);
-    EXPECT_EQ(true, result.membership.CheckMembership("segA.g1"));
-    EXPECT_EQ(false, result.membership.CheckMembership("segB.g2"));
+    EXPECT_EQ(true, Check(*wrapper, result.membership, "segA", 1));
+    EXPECT_EQ(false, Check(*wrapper, result.membership, "segB", 2));
 }
 
 TEST(BigSegmentStoreWrapperMembershipTest, CacheHitAvoidsSecondQuery) {
@@ -285,10 +316,30 @@ TEST(BigSegmentStoreWrapperMembershipTest, CacheHitAvoidsSecondQuery) {
 
     auto first = wrapper->GetMembership("ctx");
     auto second = wrapper->GetMembership("ctx");
-    EXPECT_EQ(true, second.membership.CheckMembership("segA.g1"));
+    EXPECT_EQ(true, Check(*wrapper, second.membership, "segA", 1));
     EXPECT_EQ(1, store->MembershipCalls());
 }
 
+TEST(BigSegmentStoreWrapperMembershipTest, CountsCacheHitsAndMisses) {
+    auto store = std::make_shared<FakeBigSegmentStore>();
+    store->SetMetadata(
+        integrations::StoreMetadata{std::chrono::system_clock::now()});
+
+    auto logger = launchdarkly::logging::NullLogger();
+    boost::asio::io_context ioc;
+    launchdarkly::metrics::Registry metrics;
+    auto wrapper = std::make_shared<BigSegmentStoreWrapper>(
+        MakeConfig(store, /*poll_interval=*/5s, /*stale_after=*/2min),
+        ioc.get_executor(), logger, &metrics);
+
+    (void)wrapper->GetMembership("a");
+    (void)wrapper->GetMemberships({"a", "b", "c"});
+
+    auto const snapshot = metrics.Snapshot();
+    EXPECT_EQ(1, snapshot.counters.at("big_segments.cache_hits"));
+    EXPECT_EQ(3, snapshot.counters.at("big_segments.cache_misses"));
+}
+
 TEST(BigSegmentStoreWrapperMembershipTest,
      StoreErrorIsNotCachedAndMarksUnavailable) {
     auto store = std::make_shared<FakeBigSegmentStore>();
@@ -304,7 +355,7 @@ TEST(BigSegmentStoreWrapperMembershipTest,
 
     auto result = wrapper->GetMembership("ctx");
     EXPECT_EQ(BigSegmentsStatus::kStoreError, result.status);
-    EXPECT_FALSE(result.membership.CheckMembership("segA.g1").has_value());
+    EXPECT_FALSE(Check(*wrapper, result.membership, "segA", 1).has_value());
     EXPECT_FALSE(wrapper->GetStatus().available);
 
     // The error was not cached, so the next lookup queries the store again.
@@ -327,7 +378,7 @@ TEST(BigSegmentStoreWrapperMembershipTest, StaleStoreMakesMembershipStale) {
 
     auto result = wrapper->GetMembership("ctx");
     EXPECT_EQ(BigSegmentsStatus::kStale, result.status);
-    EXPECT_EQ(true, result.membership.CheckMembership("segA.g1"));
+    EXPECT_EQ(true, Check(*wrapper, result.membership, "segA", 1));
 }
 
 TEST(BigSegmentStoreWrapperMembershipTest, ConcurrentMissesShareOneStoreQuery) {
@@ -363,7 +414,104 @@ TEST(BigSegmentStoreWrapperMembershipTest, ConcurrentMissesShareOneStoreQuery) {
 
     ASSERT_TRUE(r1.has_value());
     ASSERT_TRUE(r2.has_value());
-    EXPECT_EQ(true, r1->membership.CheckMembership("segA.g1"));
-    EXPECT_EQ(true, r2->membership.CheckMembership("segA.g1"));
+    EXPECT_EQ(true, Check(*wrapper, r1->membership, "segA", 1));
+    EXPECT_EQ(true, Check(*wrapper, r2->membership, "segA", 1));
     EXPECT_EQ(1, store->MembershipCalls());
 }
+
+TEST(BigSegmentStoreWrapperMembershipTest, MissesAreQueriedInOneBatch) {
+    auto store = std::make_shared<FakeBigSegmentStore>();
+    store->SetMetadata(
+        integrations::StoreMetadata{std::chrono::system_clock::now()});
+    store->SetMembership(
+        integrations::Membership::FromSegmentRefs({"segA.g1"}, {}));
+
+    auto logger = launchdarkly::logging::NullLogger();
+    boost::asio::io_context ioc;
+    auto wrapper = std::make_shared<BigSegmentStoreWrapper>(
+        MakeConfig(store, /*poll_interval=*/5s, /*stale_after=*/2min),
+        ioc.get_executor(), logger);
+
+    (void)wrapper->GetMembership("cached");
+
+    // The cached key is served from the cache, the duplicate is queried once,
+    // and the remaining misses share a single store query.
+    auto result = wrapper->GetMemberships({"cached", "a", "b", "a"});
+    EXPECT_EQ(BigSegmentsStatus::kHealthy, result.status);
+    ASSERT_EQ(3u, result.memberships.size());
+    for (auto const& key : {"cached", "a", "b"}) {
+        ASSERT_EQ(1u, result.memberships.count(key));
+        EXPECT_EQ(true, Check(*wrapper, result.memberships.at(key), "segA", 1));
+    }
+    EXPECT_EQ((std::vector<std::size_t>{1, 2}), store->BatchSizes());
+
+    // Every key is now cached.
+    (void)wrapper->GetMemberships({"a", "b", "cached"});
+    EXPECT_EQ(2u, store->BatchSizes().size());
+}
+
+TEST(BigSegmentStoreWrapperMembershipTest, BatchErrorFailsEveryKey) {
+    auto store = std::make_shared<FakeBigSegmentStore>();
+    store->SetMetadata(
+        integrations::StoreMetadata{std::chrono::system_clock::now()});
+    store->SetMembership(tl::make_unexpected("boom"));
+
+    auto logger = launchdarkly::logging::NullLogger();
+    boost::asio::io_context ioc;
+    auto wrapper = std::make_shared<BigSegmentStoreWrapper>(
+        MakeConfig(store, /*poll_interval=*/5s, /*stale_after=*/2min),
+        ioc.get_executor(), logger);
+
+    auto result = wrapper->GetMemberships({"a", "b"});
+    EXPECT_EQ(BigSegmentsStatus::kStoreError, result.status);
+    EXPECT_TRUE(result.memberships.empty());
+    EXPECT_FALSE(wrapper->GetStatus().available);
+}
+
+TEST(BigSegmentStoreWrapperMembershipTest, PrefetchLoadsCacheOnExecutor) {
+    auto store = std::make_shared<FakeBigSegmentStore>();
+    store->SetMetadata(
+        integrations::StoreMetadata{std::chrono::system_clock::now()});
+    store->SetMembership(
+        integrations::Membership::FromSegmentRefs({"segA.g1"}, {}));
+
+    auto logger = launchdarkly::logging::NullLogger();
+    boost::asio::io_context ioc;
+    auto wrapper = std::make_shared<BigSegmentStoreWrapper>(
+        MakeConfig(store, /*poll_interval=*/5s, /*stale_after=*/2min),
+        ioc.get_executor(), logger);
+
+    auto future = wrapper->Prefetch({"a", "b"}, ioc.get_executor());
+
+    // Nothing is queried on the calling thread.
+    EXPECT_FALSE(future.IsFinished());
+    EXPECT_EQ(0, store->MembershipCalls());
+
+    ioc.run();
+
+    ASSERT_EQ(BigSegmentsStatus::kHealthy, future.GetResult());
+    EXPECT_EQ((std::vector<std::size_t>{2}), store->BatchSizes());
+
+    // Both keys are now served from the cache.
+    auto result = wrapper->GetMemberships({"a", "b"});
+    EXPECT_EQ(true, Check(*wrapper, result.memberships.at("a"), "segA", 1));
+    EXPECT_EQ(1u, store->BatchSizes().size());
+}
+
+TEST(BigSegmentStoreWrapperMembershipTest, PrefetchReportsStoreError) {
+    auto store = std::make_shared<FakeBigSegmentStore>();
+    store->SetMetadata(
+        integrations::StoreMetadata{std::chrono::system_clock::now()});
+    store->SetMembership(tl::make_unexpected("boom"));
+
+    auto logger = launchdarkly::logging::NullLogger();
+    boost::asio::io_context ioc;
+    auto wrapper = std::make_shared<BigSegmentStoreWrapper>(
+        MakeConfig(store, /*poll_interval=*/5s, /*stale_after=*/2min),
+        ioc.get_executor(), logger);
+
+    auto future = wrapper->Prefetch({"a"}, ioc.get_executor());
+    ioc.run();
+
+    ASSERT_EQ(BigSegmentsStatus::kStoreError, future.GetResult());
+}
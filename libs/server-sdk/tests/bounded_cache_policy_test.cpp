@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <data_components/bounded_cache/bounded_cache_policy.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+using launchdarkly::server_side::data_components::BoundedCachePolicy;
+using launchdarkly::server_side::data_components::DataKind;
+
+namespace {
+
+// Applies the policy's decisions to a set of resident keys, as a cache would.
+class Resident {
+   public:
+    explicit Resident(BoundedCachePolicy& policy) : policy_(policy) {}
+
+    void Insert(std::string const& key, std::size_t bytes = 1) {
+        keys_.insert(key);
+        for (auto const& [kind, evicted] :
+             policy_.Insert(DataKind::kFlag, key, bytes)) {
+            EXPECT_NE(evicted, key);
+            keys_.erase(evicted);
+        }
+    }
+
+    void Access(std::string const& key) {
+        policy_.Access(DataKind::kFlag, key);
+    }
+
+    [[nodiscard]] bool Contains(std::string const& key) const {
+        return keys_.count(key) != 0;
+    }
+
+    [[nodiscard]] std::size_t Size() const { return keys_.size(); }
+
+   private:
+    BoundedCachePolicy& policy_;
+    std::set<std::string> keys_;
+};
+
+std::string Key(std::string const& prefix, std::size_t i) {
+    return prefix + std::to_string(i);
+}
+
+}  // namespace
+
+TEST(BoundedCachePolicyTest, RespectsItemBound) {
+    BoundedCachePolicy policy(10, 0);
+    Resident cache(policy);
+
+    for (std::size_t i = 0; i < 100; i++) {
+        cache.Insert(Key("flag", i));
+        ASSERT_LE(cache.Size(), 10);
+    }
+
+    auto const stats = policy.GetStats();
+    ASSERT_EQ(stats.items, 10);
+    ASSERT_EQ(stats.items, cache.Size());
+    ASSERT_EQ(stats.evictions, 90);
+}
+
+TEST(BoundedCachePolicyTest, RespectsByteBound) {
+    BoundedCachePolicy policy(0, 1000);
+    Resident cache(policy);
+
+    for (std::size_t i = 0; i < 100; i++) {
+        cache.Insert(Key("flag", i), 10 + i % 7);
+        ASSERT_LE(policy.GetStats().bytes, 1000);
+    }
+    ASSERT_EQ(policy.GetStats().items, cache.Size());
+}
+
+TEST(BoundedCachePolicyTest, NewestItemIsResidentEvenIfOversized) {
+    BoundedCachePolicy policy(0, 100);
+    Resident cache(policy);
+
+    cache.Insert("small", 10);
+    cache.Insert("huge", 1000);
+    ASSERT_TRUE(cache.Contains("huge"));
+
+    // Once it is no longer the newest item, it can't be admitted.
+    cache.Insert("next", 10);
+    ASSERT_FALSE(cache.Contains("huge"));
+    ASSERT_TRUE(cache.Contains("next"));
+}
+
+TEST(BoundedCachePolicyTest, ScanDoesNotFlushFrequentlyUsedItems) {
+    BoundedCachePolicy policy(100, 0);
+    Resident cache(policy);
+
+    for (std::size_t round = 0; round < 5; round++) {
+        for (std::size_t i = 0; i < 50; i++) {
+            if (round == 0) {
+                cache.Insert(Key("hot", i));
+            } else {
+                cache.Access(Key("hot", i));
+            }
+        }
+    }
+
+    // A scan over many items which are each used only once.
+    for (std::size_t i = 0; i < 10000; i++) {
+        cache.Insert(Key("cold", i));
+    }
+
+    std::size_t hot_resident = 0;
+    for (std::size_t i = 0; i < 50; i++) {
+        hot_resident += cache.Contains(Key("hot", i)) ? 1 : 0;
+    }
+    ASSERT_GE(hot_resident, 45);
+    ASSERT_LE(cache.Size(), 100);
+}
+
+TEST(BoundedCachePolicyTest, RemovedKeysAreNoLongerCounted) {
+    BoundedCachePolicy policy(10, 0);
+
+    ASSERT_TRUE(policy.Insert(DataKind::kFlag, "a", 5).empty());
+    ASSERT_TRUE(policy.Insert(DataKind::kSegment, "a", 7).empty());
+    ASSERT_EQ(policy.GetStats().items, 2);
+    ASSERT_EQ(policy.GetStats().bytes, 12);
+
+    policy.Remove(DataKind::kFlag, "a");
+    ASSERT_EQ(policy.GetStats().items, 1);
+    ASSERT_EQ(policy.GetStats().bytes, 7);
+
+    // Reinserting a resident key updates its size.
+    ASSERT_TRUE(policy.Insert(DataKind::kSegment, "a", 3).empty());
+    ASSERT_EQ(policy.GetStats().items, 1);
+    ASSERT_EQ(policy.GetStats().bytes, 3);
+}
@@ -2,7 +2,18 @@
 #include <launchdarkly/context_builder.hpp>
 #include <launchdarkly/server_side/client.hpp>
 #include <launchdarkly/server_side/config/config_builder.hpp>
+#include <launchdarkly/server_side/integrations/data_reader/iserialized_data_reader.hpp>
+#include <array>
+#include <chrono>
+#include <future>
 #include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#include "client_impl.hpp"
+#include "spy_event_processor.hpp"
 
 using namespace launchdarkly;
 using namespace launchdarkly::server_side;
@@ -32,6 +43,30 @@ TEST_F(ClientTest, BoolVariationDefaultPassesThrough) {
     }
 }
 
+TEST_F(ClientTest, MetricsCountEvaluations) {
+    for (int i = 0; i < 32; i++) {
+        (void)client_.BoolVariation(context_, "extra-cat-food", false);
+    }
+
+    auto const metrics = client_.Metrics();
+    EXPECT_EQ(metrics.counters.at("evaluations"), 32);
+    // A sample of evaluations is timed.
+    EXPECT_GE(metrics.histograms.at("evaluation.duration_ns").count, 1);
+    EXPECT_EQ(metrics.gauges.count("events.inbox_depth"), 1);
+}
+
+TEST(ClientMetricsTest, StreamingMetricsAreReportedBeforeSynchronizerStarts) {
+    // The FDv2 streaming synchronizer is only built once the client starts,
+    // but its metrics are registered with the client.
+    auto builder = ConfigBuilder("sdk-123");
+    builder.DataSystem().Method(
+        server_side::config::builders::DataSystemBuilder::FDv2::Default());
+    Client client(builder.Build().value());
+
+    auto const metrics = client.Metrics();
+    EXPECT_EQ(metrics.counters.at("data_source.stream_reconnects"), 0);
+}
+
 TEST_F(ClientTest, StringVariationDefaultPassesThrough) {
     std::string const flag = "treat";
     std::vector<std::string> values = {"chicken", "fish", "cat-grass"};
@@ -71,6 +106,121 @@ TEST_F(ClientTest, JsonVariationDefaultPassesThrough) {
     }
 }
 
+TEST_F(ClientTest, JsonVariationDetailsPassThroughDefaults) {
+    Value const weight_default(20);
+    Value const treat_default("fish");
+    auto const details = client_.JsonVariationDetails(
+        context_, {{"weight", &weight_default}, {"treat", &treat_default}});
+    ASSERT_EQ(details.size(), 2);
+    EXPECT_EQ(*details[0], Value(20));
+    EXPECT_EQ(*details[1], Value("fish"));
+    for (auto const& detail : details) {
+        EXPECT_EQ(detail.Reason()->ErrorKind(),
+                  EvaluationReason::ErrorKind::kClientNotReady);
+    }
+}
+
+namespace {
+// Serves the given flags, keyed by flag key, and no segments.
+class FlagsReader final : public integrations::ISerializedDataReader {
+   public:
+    explicit FlagsReader(std::map<std::string, std::string> const& flags) {
+        for (auto const& [key, json] : flags) {
+            flags_.emplace(key,
+                           integrations::SerializedItemDescriptor::Present(
+                               1, json));
+        }
+    }
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        if (kind.Namespace() != "features") {
+            return std::nullopt;
+        }
+        if (auto it = flags_.find(itemKey); it != flags_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        if (kind.Namespace() != "features") {
+            return AllResult::value_type{};
+        }
+        return flags_;
+    }
+
+    std::string const& Identity() const override { return identity_; }
+
+    bool Initialized() const override { return true; }
+
+   private:
+    std::unordered_map<std::string, integrations::SerializedItemDescriptor>
+        flags_;
+    std::string identity_ = "flags-reader";
+};
+}  // namespace
+
+TEST(ClientImplTest, JsonVariationDetailsEvaluatesFlagsInOrder) {
+    auto builder = ConfigBuilder("sdk-123");
+    builder.DataSystem().Method(
+        server_side::config::builders::LazyLoadBuilder().Source(
+            std::make_shared<FlagsReader>(std::map<std::string, std::string>{
+                {"color",
+                 R"({"key":"color","version":1,"on":true,)"
+                 R"("variations":["red","green"],"offVariation":0,)"
+                 R"("fallthrough":{"variation":1},"salt":"salt"})"},
+                {"size",
+                 R"({"key":"size","version":1,"on":false,)"
+                 R"("variations":[1,2],"offVariation":0,)"
+                 R"("fallthrough":{"variation":1},"salt":"salt"})"}})));
+    auto processor = std::make_unique<SpyEventProcessor>();
+    SpyEventProcessor const& spy = *processor;
+    ClientImpl client(builder.Build().value(), "test", std::move(processor));
+
+    auto started = client.StartAsync();
+    ASSERT_EQ(started.wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    ASSERT_TRUE(started.get());
+
+    Value const color_default("blue");
+    Value const size_default(0);
+    Value const missing_default(true);
+    auto const details = client.JsonVariationDetails(
+        ContextBuilder().Kind("cat", "shadow").Build(),
+        {{"color", &color_default},
+         {"size", &size_default},
+         {"missing", &missing_default}});
+
+    ASSERT_EQ(details.size(), 3);
+    EXPECT_EQ(*details[0], Value("green"));
+    EXPECT_EQ(details[0].VariationIndex(), 1);
+    EXPECT_EQ(details[0].Reason()->Kind(),
+              EvaluationReason::Kind::kFallthrough);
+    EXPECT_EQ(*details[1], Value(1));
+    EXPECT_EQ(details[1].VariationIndex(), 0);
+    EXPECT_EQ(details[1].Reason()->Kind(), EvaluationReason::Kind::kOff);
+    EXPECT_EQ(*details[2], missing_default);
+    EXPECT_FALSE(details[2].VariationIndex());
+    EXPECT_EQ(details[2].Reason()->ErrorKind(),
+              EvaluationReason::ErrorKind::kFlagNotFound);
+
+    // One evaluation event per flag, in order, as JsonVariationDetail would
+    // send.
+    ASSERT_TRUE(spy.Count(3));
+    std::vector<std::string> const keys = {"color", "size", "missing"};
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        ASSERT_TRUE(spy.Kind<events::FeatureEventParams>(i));
+        auto const& event =
+            std::get<events::FeatureEventParams>(spy.Events()[i]);
+        EXPECT_EQ(event.key, keys[i]);
+        EXPECT_EQ(event.value, *details[i]);
+        EXPECT_EQ(event.variation, details[i].VariationIndex());
+        EXPECT_TRUE(event.reason);
+    }
+}
+
 TEST_F(ClientTest, AllFlagsStateNotValid) {
     // Since we don't have any ability to insert into the data store, assert
     // only that the state is not valid.
@@ -79,3 +229,89 @@ TEST_F(ClientTest, AllFlagsStateNotValid) {
                       AllFlagsState::Options::ClientSideOnly);
     ASSERT_FALSE(flags.Valid());
 }
+
+TEST_F(ClientTest, AllFlagsStateJsonNotValid) {
+    std::string json = "previous contents";
+    client_.AllFlagsStateJson(context_, json,
+                              AllFlagsState::Options::IncludeReasons);
+    ASSERT_EQ(json, "{\"$valid\":false,\"$flagsState\":{}}");
+}
+
+TEST_F(ClientTest, AllFlagsStateJsonIntoBuffer) {
+    std::string const expected = "{\"$valid\":false,\"$flagsState\":{}}";
+
+    // Nothing is written past the given size, but the full length is
+    // returned.
+    std::array<char, 9> small{};
+    small.fill('#');
+    ASSERT_EQ(client_.AllFlagsStateJson(context_, small.data(), 8),
+              expected.size());
+    ASSERT_EQ(std::string(small.data(), 8), expected.substr(0, 8));
+    ASSERT_EQ(small[8], '#');
+
+    std::array<char, 64> buffer{};
+    buffer.fill('#');
+    ASSERT_EQ(client_.AllFlagsStateJson(context_, buffer.data(), buffer.size()),
+              expected.size());
+    ASSERT_STREQ(buffer.data(), expected.c_str());
+}
+
+TEST_F(ClientTest, PrefetchBigSegmentsWithoutStoreResolvesFalse) {
+    auto prefetch = client_.PrefetchBigSegments(context_);
+    ASSERT_EQ(prefetch.wait_for(std::chrono::seconds(0)),
+              std::future_status::ready);
+    ASSERT_FALSE(prefetch.get());
+}
+
+// Smoke test only: the client starts, evaluates, and joins every background
+// thread on destruction. Ordering within each component is provided by its
+// strand and isn't observable through the public API.
+TEST(ClientIoThreadsTest, ClientStartsAndStopsWithMultipleIoThreads) {
+    auto config = ConfigBuilder("sdk-123").IoThreads(4).Build().value();
+    Client client(std::move(config));
+    auto const context = ContextBuilder().Kind("cat", "shadow").Build();
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(client.BoolVariation(context, "extra-cat-food", true));
+    }
+    client.FlushAsync();
+}
+
+// Records which threads it was written from.
+class ThreadRecordingBackend final : public ILogBackend {
+   public:
+    bool Enabled(LogLevel level) noexcept override { return true; }
+
+    void Write(LogLevel level, std::string message) noexcept override {
+        std::lock_guard lock(mutex_);
+        writers_.insert(std::this_thread::get_id());
+    }
+
+    std::set<std::thread::id> Writers() {
+        std::lock_guard lock(mutex_);
+        return writers_;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::set<std::thread::id> writers_;
+};
+
+TEST(ClientLoggingTest, AsynchronousLoggingWritesFromBackgroundThread) {
+    auto backend = std::make_shared<ThreadRecordingBackend>();
+    auto builder = ConfigBuilder("sdk-123");
+    using LoggingBuilder = server_side::config::builders::LoggingBuilder;
+    builder.Logging()
+        .Logging(LoggingBuilder::CustomLogging().Backend(backend))
+        .Asynchronous(16);
+
+    {
+        // The client logs its data system on construction; the record is
+        // written by the time the client's logger is destroyed.
+        Client client(builder.Build().value());
+    }
+
+    auto const writers = backend->Writers();
+    ASSERT_FALSE(writers.empty());
+    ASSERT_EQ(writers.count(std::this_thread::get_id()), 0);
+}
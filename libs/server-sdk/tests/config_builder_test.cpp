@@ -46,6 +46,29 @@ TEST_F(ConfigBuilderTest, DefaultConstruction_Succeeds) {
     ASSERT_EQ(cfg->SdkKey(), "sdk-123");
 }
 
+TEST_F(ConfigBuilderTest, DefaultConstruction_UsesOneIoThread) {
+    ConfigBuilder builder("sdk-123");
+    auto cfg = builder.Build();
+    ASSERT_TRUE(cfg);
+    ASSERT_EQ(cfg->IoThreads(), 1);
+}
+
+TEST_F(ConfigBuilderTest, CanSetIoThreads) {
+    ConfigBuilder builder("sdk-123");
+    builder.IoThreads(4);
+    auto cfg = builder.Build();
+    ASSERT_TRUE(cfg);
+    ASSERT_EQ(cfg->IoThreads(), 4);
+}
+
+TEST_F(ConfigBuilderTest, ZeroIoThreadsIsTreatedAsOne) {
+    ConfigBuilder builder("sdk-123");
+    builder.IoThreads(0);
+    auto cfg = builder.Build();
+    ASSERT_TRUE(cfg);
+    ASSERT_EQ(cfg->IoThreads(), 1);
+}
+
 TEST_F(ConfigBuilderTest, DefaultConstruction_StreamingDefaultsAreUsed) {
     // Sanity check that the default server-side config uses
     // the streaming data source.
@@ -218,6 +241,35 @@ TEST_F(ConfigBuilderTest, FDv2_AddingInitializerClearsDefaults) {
     */
 }
 
+TEST_F(ConfigBuilderTest, FDv2_LocalSnapshot) {
+    ConfigBuilder builder("sdk-123");
+    builder.DataSystem().Method(
+        builders::DataSystemBuilder::FDv2::Default().Snapshot(
+            builders::FDv2Builder::LocalSnapshot("/var/lib/app/ld.snapshot")
+                .WriteInterval(std::chrono::seconds{10})));
+
+    auto cfg = builder.Build();
+    auto const fdv2_config =
+        std::get<built::FDv2Config>(cfg->DataSystemConfig().system_);
+
+    ASSERT_TRUE(fdv2_config.snapshot.has_value());
+    EXPECT_EQ(fdv2_config.snapshot->path, "/var/lib/app/ld.snapshot");
+    EXPECT_EQ(fdv2_config.snapshot->write_interval, std::chrono::seconds{10});
+    // The snapshot is loaded in addition to the network initializers.
+    EXPECT_EQ(fdv2_config.initializers.size(), 1u);
+}
+
+TEST_F(ConfigBuilderTest, FDv2_NoSnapshotByDefault) {
+    ConfigBuilder builder("sdk-123");
+    builder.DataSystem().Method(builders::DataSystemBuilder::FDv2::Default());
+
+    auto cfg = builder.Build();
+    auto const fdv2_config =
+        std::get<built::FDv2Config>(cfg->DataSystemConfig().system_);
+
+    EXPECT_FALSE(fdv2_config.snapshot.has_value());
+}
+
 TEST_F(ConfigBuilderTest, FDv2_PerSourceBaseUrlOverride) {
     ConfigBuilder builder("sdk-123");
     builder.DataSystem().Method(
@@ -120,6 +120,65 @@ TEST(ExpirationTrackerTest, CanPrune) {
               tracker.State(DataKind::kSegment, "freshSegment", Second(80)));
 }
 
+TEST(ExpirationTrackerTest, PruneExpiredRemovesOnlyExpiredExpiringKeys) {
+    ExpirationTracker tracker;
+    tracker.Add(DataKind::kFlag, "staleFlag", Second(50));
+    tracker.AddExpiring(DataKind::kFlag, "expiringFlag", Second(50));
+    tracker.AddExpiring(DataKind::kSegment, "expiringSegment", Second(60));
+    tracker.AddExpiring(DataKind::kFlag, "freshFlag", Second(100));
+
+    EXPECT_EQ(0, tracker.PruneExpired(Second(40)));
+    EXPECT_EQ(2, tracker.PruneExpired(Second(80)));
+
+    EXPECT_EQ(ExpirationTracker::TrackState::kNotTracked,
+              tracker.State(DataKind::kFlag, "expiringFlag", Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kNotTracked,
+              tracker.State(DataKind::kSegment, "expiringSegment", Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "staleFlag", Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kFresh,
+              tracker.State(DataKind::kFlag, "freshFlag", Second(80)));
+
+    EXPECT_EQ(1, tracker.PruneExpired(Second(100)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kNotTracked,
+              tracker.State(DataKind::kFlag, "freshFlag", Second(100)));
+}
+
+TEST(ExpirationTrackerTest, ReAddingCancelsPruningOfExpiringKey) {
+    ExpirationTracker tracker;
+    tracker.AddExpiring(DataKind::kFlag, "readded", Second(50));
+    tracker.AddExpiring(DataKind::kFlag, "extended", Second(50));
+    tracker.AddExpiring(DataKind::kFlag, "removed", Second(50));
+
+    tracker.Add(DataKind::kFlag, "readded", Second(60));
+    tracker.AddExpiring(DataKind::kFlag, "extended", Second(90));
+    tracker.Remove(DataKind::kFlag, "removed");
+    tracker.AddExpiring(DataKind::kFlag, "removed", Second(50));
+    tracker.Remove(DataKind::kFlag, "removed");
+
+    EXPECT_EQ(0, tracker.PruneExpired(Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "readded", Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kFresh,
+              tracker.State(DataKind::kFlag, "extended", Second(80)));
+
+    EXPECT_EQ(1, tracker.PruneExpired(Second(90)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kNotTracked,
+              tracker.State(DataKind::kFlag, "extended", Second(90)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "readded", Second(90)));
+}
+
+TEST(ExpirationTrackerTest, ClearForgetsExpiringKeys) {
+    ExpirationTracker tracker;
+    tracker.AddExpiring(DataKind::kFlag, "key", Second(50));
+    tracker.Clear();
+    tracker.Add(DataKind::kFlag, "key", Second(10));
+    EXPECT_EQ(0, tracker.PruneExpired(Second(80)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "key", Second(80)));
+}
+
 TEST(ExpirationTrackerTest, CanUpdateExistingExpiry) {
     ExpirationTracker tracker;
 
@@ -133,3 +192,21 @@ TEST(ExpirationTrackerTest, CanUpdateExistingExpiry) {
         ASSERT_TRUE(tracker.Prune(now).empty());
     }
 }
+
+TEST(ExpirationTrackerTest, CanExpireAllKeysOfKind) {
+    ExpirationTracker tracker;
+    tracker.Add(DataKind::kFlag, "late", Second(100));
+    tracker.Add(DataKind::kFlag, "early", Second(5));
+    tracker.Add(DataKind::kSegment, "segment", Second(100));
+
+    tracker.ExpireAll(DataKind::kFlag, Second(10));
+
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "late", Second(10)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kStale,
+              tracker.State(DataKind::kFlag, "early", Second(5)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kFresh,
+              tracker.State(DataKind::kSegment, "segment", Second(10)));
+    EXPECT_EQ(ExpirationTracker::TrackState::kNotTracked,
+              tracker.State(DataKind::kFlag, "untracked", Second(10)));
+}
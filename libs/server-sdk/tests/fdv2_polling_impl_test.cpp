@@ -1,11 +1,22 @@
 #include <gtest/gtest.h>
 
 #include <data_systems/fdv2/fdv2_polling_impl.hpp>
+#include <data_systems/fdv2/polling_synchronizer.hpp>
 
 #include <launchdarkly/config/shared/defaults.hpp>
 #include <launchdarkly/fdv2_protocol_handler.hpp>
 #include <launchdarkly/logging/logger.hpp>
 #include <launchdarkly/network/http_requester.hpp>
+#include <launchdarkly/server_side/config/builders/all_builders.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace launchdarkly;
 using namespace launchdarkly::server_side::data_interfaces;
@@ -171,3 +182,140 @@ TEST(MakeFDv2PollRequestTest, InvalidFilterKeyIsDropped) {
                             std::string{"has spaces"}, logger);
     EXPECT_EQ(req.Url(), "http://example.com/sdk/poll");
 }
+
+TEST(MakeFDv2PollRequestTest, AcceptsGzipEncodedResponses) {
+    auto logger = MakeNullLogger();
+    auto props =
+        config::shared::Defaults<config::shared::ServerSDK>::HttpProperties();
+    auto req =
+        MakeFDv2PollRequest("http://example.com", props, data_model::Selector{},
+                            std::nullopt, logger);
+    auto const& headers = req.Properties().BaseHeaders();
+    auto const encoding = headers.find("Accept-Encoding");
+    ASSERT_NE(encoding, headers.end());
+    EXPECT_EQ(encoding->second, "gzip");
+}
+
+namespace {
+
+namespace http = boost::beast::http;
+using tcp = boost::asio::ip::tcp;
+
+// Serves a fixed number of FDv2 poll requests. The first response carries an
+// ETag; a request presenting that ETag in If-None-Match receives a 304.
+class ConditionalPollEndpoint {
+   public:
+    static constexpr char const* kEtag = "\"payload-1\"";
+
+    ConditionalPollEndpoint(std::string body, std::size_t request_count)
+        : body_(std::move(body)),
+          acceptor_(ioc_, {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+        thread_ = std::thread([this, request_count]() {
+            for (std::size_t i = 0; i < request_count; i++) {
+                Serve();
+            }
+        });
+    }
+
+    ~ConditionalPollEndpoint() { Wait(); }
+
+    void Wait() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    [[nodiscard]] std::string BaseUrl() const {
+        return "http://127.0.0.1:" +
+               std::to_string(acceptor_.local_endpoint().port());
+    }
+
+    // If-None-Match header of each request, in order. Empty if absent.
+    std::vector<std::string> if_none_match;
+
+   private:
+    void Serve() {
+        tcp::socket socket(ioc_);
+        acceptor_.accept(socket);
+
+        boost::beast::flat_buffer buffer;
+        http::request<http::string_body> req;
+        http::read(socket, buffer, req);
+        if_none_match.emplace_back(req[http::field::if_none_match]);
+
+        http::response<http::string_body> res{http::status::ok, req.version()};
+        res.set(http::field::etag, kEtag);
+        if (req[http::field::if_none_match] == kEtag) {
+            res.result(http::status::not_modified);
+        } else {
+            res.body() = body_;
+        }
+        res.prepare_payload();
+
+        http::write(socket, res);
+        boost::beast::error_code ec;
+        socket.shutdown(tcp::socket::shutdown_both, ec);
+    }
+
+    std::string body_;
+    boost::asio::io_context ioc_;
+    tcp::acceptor acceptor_;
+    std::thread thread_;
+};
+
+}  // namespace
+
+TEST(FDv2PollingSynchronizerTest, SendsStoredEtagAndHandlesNotModified) {
+    using namespace std::chrono_literals;
+
+    std::string const body =
+        R"({"events":[)"
+        R"({"event":"server-intent","data":{"payloads":[)"
+        R"({"id":"p1","target":1,"intentCode":"xfer-full"}]}},)"
+        R"({"event":"put-object","data":{"version":1,"kind":"flag",)"
+        R"("key":"my-flag","object":{"key":"my-flag","on":true,)"
+        R"("fallthrough":{"variation":0},"variations":[true,false],)"
+        R"("version":1}}},)"
+        R"({"event":"payload-transferred","data":{"state":"abc","version":1}})"
+        R"(]})";
+    ConditionalPollEndpoint endpoint(body, 2);
+
+    boost::asio::io_context ioc;
+    auto work = boost::asio::make_work_guard(ioc);
+    std::thread ioc_thread([&] { ioc.run(); });
+
+    {
+        FDv2PollingSynchronizer synchronizer(
+            ioc.get_executor(), MakeNullLogger(), endpoint.BaseUrl(),
+            server_side::config::builders::HttpPropertiesBuilder().Build(),
+            std::nullopt, 0s, 0s);
+
+        // Both polls use the same selector so that the request URL, and
+        // therefore the ETag's scope, is unchanged.
+        auto first =
+            synchronizer.Next(data_model::Selector{}).WaitForResult(5s);
+        ASSERT_TRUE(first.has_value());
+        auto* full = std::get_if<FDv2SourceResult::ChangeSet>(&first->value);
+        ASSERT_NE(full, nullptr);
+        EXPECT_FALSE(full->change_set.data.empty());
+
+        auto second =
+            synchronizer.Next(data_model::Selector{}).WaitForResult(5s);
+        ASSERT_TRUE(second.has_value());
+        auto* unchanged =
+            std::get_if<FDv2SourceResult::ChangeSet>(&second->value);
+        ASSERT_NE(unchanged, nullptr);
+        EXPECT_EQ(data_model::ChangeSetType::kNone,
+                  unchanged->change_set.type);
+        EXPECT_TRUE(unchanged->change_set.data.empty());
+    }
+
+    work.reset();
+    ioc.stop();
+    ioc_thread.join();
+
+    endpoint.Wait();
+    ASSERT_EQ(2, endpoint.if_none_match.size());
+    EXPECT_EQ("", endpoint.if_none_match[0]);
+    EXPECT_EQ(ConditionalPollEndpoint::kEtag, endpoint.if_none_match[1]);
+}
@@ -0,0 +1,320 @@
+#include <gtest/gtest.h>
+
+#include <data_components/status_notifications/data_source_status_manager.hpp>
+#include <data_interfaces/source/ifdv2_initializer.hpp>
+#include <data_interfaces/source/ifdv2_initializer_factory.hpp>
+#include <data_interfaces/source/ifdv2_synchronizer.hpp>
+#include <data_interfaces/source/ifdv2_synchronizer_factory.hpp>
+#include <data_systems/fdv2/fdv2_data_system.hpp>
+#include <data_systems/fdv2/snapshot_file.hpp>
+#include <data_systems/fdv2/snapshot_initializer.hpp>
+#include <data_systems/fdv2/snapshot_writer.hpp>
+
+#include <launchdarkly/async/promise.hpp>
+#include <launchdarkly/data_model/flag.hpp>
+#include <launchdarkly/data_model/segment.hpp>
+#include <launchdarkly/logging/logger.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace launchdarkly;
+using namespace launchdarkly::server_side;
+using namespace launchdarkly::server_side::data_interfaces;
+using namespace launchdarkly::server_side::data_systems;
+using namespace std::chrono_literals;
+
+namespace {
+
+Logger MakeNullLogger() {
+    struct NullBackend : ILogBackend {
+        bool Enabled(LogLevel) noexcept override { return false; }
+        void Write(LogLevel, std::string) noexcept override {}
+    };
+    return Logger{std::make_shared<NullBackend>()};
+}
+
+data_model::Selector MakeSelector(std::int64_t version, std::string state) {
+    return data_model::Selector{
+        data_model::Selector::State{version, std::move(state)}};
+}
+
+class FDv2SnapshotTest : public ::testing::Test {
+   protected:
+    FDv2SnapshotTest()
+        : path_(::testing::TempDir() + "ld_snapshot_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+                ".bin") {
+        std::remove(path_.c_str());
+    }
+
+    ~FDv2SnapshotTest() override { std::remove(path_.c_str()); }
+
+    static std::string EncodeSample(data_model::Selector const& selector) {
+        data_model::Flag flag;
+        flag.key = "flagA";
+        flag.version = 3;
+        flag.on = true;
+
+        data_model::Segment segment;
+        segment.key = "segmentA";
+        segment.version = 7;
+
+        return EncodeSnapshot(
+            selector,
+            {{"flagA", std::make_shared<data_model::FlagDescriptor>(flag)},
+             {"flagB", std::make_shared<data_model::FlagDescriptor>(
+                           data_model::Tombstone{9})}},
+            {{"segmentA",
+              std::make_shared<data_model::SegmentDescriptor>(segment)}});
+    }
+
+    std::string const path_;
+};
+
+// Initializer that resolves Run() with a full changeset carrying a selector.
+class ChangeSetInitializer : public IFDv2Initializer {
+   public:
+    async::Future<FDv2SourceResult> Run() override {
+        data_model::Flag flag;
+        flag.key = "flagA";
+        flag.version = 1;
+        return async::MakeFuture(FDv2SourceResult{FDv2SourceResult::ChangeSet{
+            data_model::ChangeSet<ChangeSetData>{
+                data_model::ChangeSetType::kFull,
+                {ItemChange{"flagA", data_model::FlagDescriptor(flag)}},
+                MakeSelector(5, "state-5")}}});
+    }
+
+    void Close() override {}
+
+    std::string const& Identity() const override {
+        static std::string const id = "changeset initializer";
+        return id;
+    }
+};
+
+class SingleInitializerFactory : public IFDv2InitializerFactory {
+   public:
+    explicit SingleInitializerFactory(std::unique_ptr<IFDv2Initializer> source)
+        : source_(std::move(source)) {}
+
+    std::unique_ptr<IFDv2Initializer> Build() override {
+        return std::move(source_);
+    }
+
+   private:
+    std::unique_ptr<IFDv2Initializer> source_;
+};
+
+// Synchronizer which records the selectors passed to Next() and never
+// resolves.
+class RecordingSynchronizer : public IFDv2Synchronizer {
+   public:
+    explicit RecordingSynchronizer(std::vector<data_model::Selector>* calls)
+        : calls_(calls) {}
+
+    async::Future<FDv2SourceResult> Next(
+        data_model::Selector selector) override {
+        calls_->push_back(selector);
+        return promise_.GetFuture();
+    }
+
+    void Close() override {
+        promise_.Resolve(FDv2SourceResult{FDv2SourceResult::Shutdown{}});
+    }
+
+    std::string const& Identity() const override {
+        static std::string const id = "recording synchronizer";
+        return id;
+    }
+
+   private:
+    std::vector<data_model::Selector>* calls_;
+    async::Promise<FDv2SourceResult> promise_;
+};
+
+class SingleSynchronizerFactory : public IFDv2SynchronizerFactory {
+   public:
+    explicit SingleSynchronizerFactory(
+        std::unique_ptr<IFDv2Synchronizer> source)
+        : source_(std::move(source)) {}
+
+    std::unique_ptr<IFDv2Synchronizer> Build() override {
+        return std::move(source_);
+    }
+
+   private:
+    std::unique_ptr<IFDv2Synchronizer> source_;
+};
+
+}  // namespace
+
+TEST_F(FDv2SnapshotTest, EncodeDecodeRoundTrip) {
+    auto decoded = DecodeSnapshot(EncodeSample(MakeSelector(42, "state-42")));
+    ASSERT_TRUE(decoded) << decoded.error();
+
+    ASSERT_TRUE(decoded->selector.value);
+    EXPECT_EQ(42, decoded->selector.value->version);
+    EXPECT_EQ("state-42", decoded->selector.value->state);
+
+    ASSERT_EQ(3u, decoded->data.size());
+    bool saw_flag = false;
+    bool saw_tombstone = false;
+    bool saw_segment = false;
+    for (auto const& change : decoded->data) {
+        if (change.key == "flagA") {
+            auto const& desc =
+                std::get<data_model::FlagDescriptor>(change.object);
+            ASSERT_TRUE(desc.item);
+            EXPECT_EQ(3u, desc.version);
+            EXPECT_TRUE(desc.item->on);
+            saw_flag = true;
+        } else if (change.key == "flagB") {
+            auto const& desc =
+                std::get<data_model::FlagDescriptor>(change.object);
+            EXPECT_FALSE(desc.item);
+            EXPECT_EQ(9u, desc.version);
+            saw_tombstone = true;
+        } else if (change.key == "segmentA") {
+            auto const& desc =
+                std::get<data_model::SegmentDescriptor>(change.object);
+            ASSERT_TRUE(desc.item);
+            EXPECT_EQ(7u, desc.version);
+            saw_segment = true;
+        }
+    }
+    EXPECT_TRUE(saw_flag);
+    EXPECT_TRUE(saw_tombstone);
+    EXPECT_TRUE(saw_segment);
+}
+
+TEST_F(FDv2SnapshotTest, EncodeDecodeWithoutSelector) {
+    auto decoded = DecodeSnapshot(EncodeSample(data_model::Selector{}));
+    ASSERT_TRUE(decoded) << decoded.error();
+    EXPECT_FALSE(decoded->selector.value);
+    EXPECT_EQ(3u, decoded->data.size());
+}
+
+TEST_F(FDv2SnapshotTest, DecodeRejectsCorruptedData) {
+    auto encoded = EncodeSample(MakeSelector(1, "state-1"));
+    encoded[encoded.size() / 2] ^= 0x5A;
+    auto decoded = DecodeSnapshot(encoded);
+    ASSERT_FALSE(decoded);
+    EXPECT_EQ("snapshot checksum mismatch", decoded.error());
+}
+
+TEST_F(FDv2SnapshotTest, DecodeRejectsTruncatedData) {
+    auto encoded = EncodeSample(MakeSelector(1, "state-1"));
+    EXPECT_FALSE(DecodeSnapshot(encoded.substr(0, encoded.size() - 1)));
+    EXPECT_FALSE(DecodeSnapshot(encoded.substr(0, 10)));
+    EXPECT_FALSE(DecodeSnapshot(""));
+}
+
+TEST_F(FDv2SnapshotTest, DecodeRejectsOtherFiles) {
+    EXPECT_FALSE(DecodeSnapshot("{\"flags\": {}, \"segments\": {}}"));
+}
+
+TEST_F(FDv2SnapshotTest, InitializerReportsMissingSnapshotAsTerminalError) {
+    FDv2SnapshotInitializer initializer(MakeNullLogger(), path_);
+    auto result = initializer.Run().GetResult();
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(std::holds_alternative<FDv2SourceResult::TerminalError>(
+        result->value));
+}
+
+TEST_F(FDv2SnapshotTest, InitializerLoadsWrittenSnapshot) {
+    ASSERT_TRUE(
+        WriteSnapshotFile(path_, EncodeSample(MakeSelector(42, "state-42"))));
+
+    FDv2SnapshotInitializer initializer(MakeNullLogger(), path_);
+    auto result = initializer.Run().GetResult();
+    ASSERT_TRUE(result);
+    auto const* change_set =
+        std::get_if<FDv2SourceResult::ChangeSet>(&result->value);
+    ASSERT_TRUE(change_set);
+    EXPECT_EQ(data_model::ChangeSetType::kFull, change_set->change_set.type);
+    EXPECT_EQ(3u, change_set->change_set.data.size());
+    ASSERT_TRUE(change_set->change_set.selector.value);
+    EXPECT_EQ("state-42", change_set->change_set.selector.value->state);
+}
+
+TEST_F(FDv2SnapshotTest, WriterOnlyWritesWhenDirty) {
+    boost::asio::io_context ioc;
+    FDv2SnapshotWriter writer(ioc.get_executor(), MakeNullLogger(), path_,
+                              1h);
+    int encodes = 0;
+    writer.Start([&]() {
+        ++encodes;
+        return EncodeSample(MakeSelector(1, "state-1"));
+    });
+
+    EXPECT_FALSE(writer.WriteIfDirty());
+    writer.MarkDirty();
+    EXPECT_TRUE(writer.WriteIfDirty());
+    EXPECT_FALSE(writer.WriteIfDirty());
+    EXPECT_EQ(1, encodes);
+
+    EXPECT_TRUE(ReadSnapshotFile(path_));
+}
+
+TEST_F(FDv2SnapshotTest, DataSystemWarmStartsFromItsOwnSnapshot) {
+    auto logger = MakeNullLogger();
+
+    // First run: an initializer delivers data, and the data system persists
+    // it through the snapshot writer.
+    {
+        boost::asio::io_context ioc;
+        data_components::DataSourceStatusManager status_manager;
+
+        std::vector<std::unique_ptr<IFDv2InitializerFactory>> initializers;
+        initializers.push_back(std::make_unique<SingleInitializerFactory>(
+            std::make_unique<ChangeSetInitializer>()));
+
+        FDv2DataSystem ds(std::move(initializers), {},
+                          /*fallback_condition_factory=*/nullptr,
+                          /*recovery_condition_factory=*/nullptr,
+                          ioc.get_executor(), &status_manager, logger,
+                          std::make_unique<FDv2SnapshotWriter>(
+                              ioc.get_executor(), logger, path_, 10ms));
+        ds.Initialize();
+        ioc.run_for(200ms);
+        ASSERT_TRUE(ds.Initialized());
+    }
+
+    // Second run: the snapshot initializer provides the basis, so the
+    // synchronizer resumes from the persisted selector.
+    boost::asio::io_context ioc;
+    data_components::DataSourceStatusManager status_manager;
+    std::vector<data_model::Selector> next_calls;
+
+    std::vector<std::unique_ptr<IFDv2InitializerFactory>> initializers;
+    initializers.push_back(std::make_unique<SingleInitializerFactory>(
+        std::make_unique<FDv2SnapshotInitializer>(logger, path_)));
+    std::vector<std::unique_ptr<IFDv2SynchronizerFactory>> synchronizers;
+    synchronizers.push_back(std::make_unique<SingleSynchronizerFactory>(
+        std::make_unique<RecordingSynchronizer>(&next_calls)));
+
+    FDv2DataSystem ds(std::move(initializers), std::move(synchronizers),
+                      /*fallback_condition_factory=*/nullptr,
+                      /*recovery_condition_factory=*/nullptr,
+                      ioc.get_executor(), &status_manager, logger);
+    ds.Initialize();
+    ioc.run_for(100ms);
+
+    EXPECT_TRUE(ds.Initialized());
+    auto flag = ds.GetFlag("flagA");
+    ASSERT_TRUE(flag);
+    EXPECT_EQ(1u, flag->version);
+
+    ASSERT_EQ(1u, next_calls.size());
+    ASSERT_TRUE(next_calls[0].value);
+    EXPECT_EQ(5, next_calls[0].value->version);
+    EXPECT_EQ("state-5", next_calls[0].value->state);
+}
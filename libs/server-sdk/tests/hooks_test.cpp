@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace launchdarkly;
@@ -771,6 +772,61 @@ TEST_F(HooksTest, EvaluationSeriesDataGetSharedReturnsNulloptForValueKeys) {
     EXPECT_EQ(*value, Value(42));
 }
 
+// Test that setting an existing key replaces its entry
+TEST_F(HooksTest, EvaluationSeriesDataBuilderReplacesExistingKey) {
+    EvaluationSeriesDataBuilder builder;
+    builder.Set("b", Value(1));
+    builder.Set("a", Value(2));
+    builder.SetShared("b", std::make_shared<std::any>(3));
+
+    auto data = builder.Build();
+
+    EXPECT_EQ(data.Keys(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_FALSE(data.Get("b").has_value());
+    auto shared = data.GetShared("b");
+    ASSERT_TRUE(shared.has_value());
+    EXPECT_EQ(std::any_cast<int>(**shared), 3);
+}
+
+// Test that building leaves the builder usable
+TEST_F(HooksTest, EvaluationSeriesDataBuilderCanBuildRepeatedly) {
+    EvaluationSeriesDataBuilder builder;
+    builder.Set("first", Value(1));
+    auto first = builder.Build();
+    builder.Set("second", Value(2));
+    auto second = builder.Build();
+
+    EXPECT_EQ(first.Keys(), (std::vector<std::string>{"first"}));
+    EXPECT_EQ(second.Keys(), (std::vector<std::string>{"first", "second"}));
+}
+
+// The series context refers to its arguments, so it must not be constructible
+// from temporaries which would be destroyed before it.
+TEST_F(HooksTest, EvaluationSeriesContextRejectsTemporaries) {
+    using Optional = std::optional<std::string>;
+    static_assert(
+        std::is_constructible_v<EvaluationSeriesContext, std::string const&,
+                                Context const&, Value const&,
+                                std::string const&, HookContext const&,
+                                Optional>);
+    static_assert(
+        !std::is_constructible_v<EvaluationSeriesContext, char const*,
+                                 Context const&, Value const&,
+                                 std::string const&, HookContext const&,
+                                 Optional>);
+    static_assert(
+        !std::is_constructible_v<EvaluationSeriesContext, std::string const&,
+                                 Context const&, bool, std::string const&,
+                                 HookContext const&, Optional>);
+    static_assert(
+        !std::is_constructible_v<EvaluationSeriesContext, std::string const&,
+                                 Context const&, Value const&, std::string,
+                                 HookContext const&, Optional>);
+    static_assert(
+        !std::is_constructible_v<EvaluationSeriesContext, std::string, Context,
+                                 Value, std::string, HookContext, Optional>);
+}
+
 // Test span use case: create in beforeEvaluation, close in afterEvaluation
 TEST_F(HooksTest, SpanLifecycleAcrossEvaluationStages) {
     struct MockSpan {
@@ -918,6 +974,17 @@ TEST_F(HooksTest, HookContextBasicFunctionality) {
     EXPECT_EQ(trace_val, 42);
 }
 
+// Test that setting an existing HookContext key replaces its value
+TEST_F(HooksTest, HookContextReplacesExistingKey) {
+    HookContext ctx;
+    ctx.Set("key", std::make_shared<std::any>(1));
+    ctx.Set("key", std::make_shared<std::any>(2));
+
+    auto retrieved = ctx.Get("key");
+    ASSERT_TRUE(retrieved.has_value());
+    EXPECT_EQ(std::any_cast<int>(*(*retrieved)), 2);
+}
+
 // Test that hooks can access HookContext from EvaluationSeriesContext
 // This simulates the OpenTelemetry span parent use case
 TEST_F(HooksTest, HookAccessesCallerProvidedContext) {
@@ -3,12 +3,19 @@
 
 #include "data_systems/lazy_load/lazy_load_system.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "data_components/serialization_adapters/json_deserializer.hpp"
 #include "spy_logger.hpp"
 
+#include <launchdarkly/logging/null_logger.hpp>
+
 using namespace launchdarkly;
 using namespace launchdarkly::server_side;
 using namespace launchdarkly::server_side::config;
@@ -38,6 +45,131 @@ class MockDataReader : public integrations::ISerializedDataReader {
     std::string const name_;
 };
 
+// Reader which simulates a slow store. Each Get or All returns an item whose
+// version is the number of times that operation has been called.
+class DelayedDataReader : public integrations::ISerializedDataReader {
+   public:
+    explicit DelayedDataReader(std::chrono::milliseconds delay)
+        : delay_(delay), gets_(0), alls_(0) {}
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        std::this_thread::sleep_for(delay_);
+        auto const version = ++gets_;
+        return integrations::SerializedItemDescriptor{
+            version, false,
+            "{\"key\":\"" + itemKey +
+                "\",\"version\":" + std::to_string(version) + "}"};
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        std::this_thread::sleep_for(delay_);
+        auto const version = ++alls_;
+        return std::unordered_map<std::string,
+                                  integrations::SerializedItemDescriptor>{
+            {"foo",
+             {version, false,
+              "{\"key\":\"foo\",\"version\":" + std::to_string(version) +
+                  "}"}}};
+    }
+
+    std::string const& Identity() const override {
+        static std::string const id = "delayed reader";
+        return id;
+    }
+
+    bool Initialized() const override { return true; }
+
+    std::uint64_t Gets() const { return gets_; }
+    std::uint64_t Alls() const { return alls_; }
+
+   private:
+    std::chrono::milliseconds const delay_;
+    mutable std::atomic<std::uint64_t> gets_;
+    mutable std::atomic<std::uint64_t> alls_;
+};
+
+// Reader backed by in-memory maps of serialized items, which counts the
+// individual and batched reads made against it.
+class CountingDataReader : public integrations::ISerializedDataReader {
+   public:
+    using Items = std::unordered_map<std::string, std::string>;
+
+    CountingDataReader(Items flags, Items segments)
+        : flags_(std::move(flags)), segments_(std::move(segments)) {}
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        ++gets;
+        auto const& items = ItemsFor(kind);
+        auto const it = items.find(itemKey);
+        if (it == items.end()) {
+            return std::nullopt;
+        }
+        return integrations::SerializedItemDescriptor{1, false, it->second};
+    }
+
+    GetManyResult GetMany(
+        integrations::ISerializedItemKind const& kind,
+        std::vector<std::string> const& itemKeys) const override {
+        ++get_manys;
+        GetManyResult::value_type result;
+        for (auto const& key : itemKeys) {
+            auto const& items = ItemsFor(kind);
+            if (auto const it = items.find(key); it != items.end()) {
+                result.emplace(key, integrations::SerializedItemDescriptor{
+                                        1, false, it->second});
+            }
+        }
+        return result;
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        ++alls;
+        AllResult::value_type result;
+        for (auto const& [key, item] : ItemsFor(kind)) {
+            result.emplace(
+                key, integrations::SerializedItemDescriptor{1, false, item});
+        }
+        return result;
+    }
+
+    std::string const& Identity() const override {
+        static std::string const id = "counting reader";
+        return id;
+    }
+
+    bool Initialized() const override { return true; }
+
+    mutable std::atomic<std::size_t> gets{0};
+    mutable std::atomic<std::size_t> get_manys{0};
+    mutable std::atomic<std::size_t> alls{0};
+
+   private:
+    Items const& ItemsFor(integrations::ISerializedItemKind const& kind) const {
+        return kind == data_systems::LazyLoad::Kinds::Flag ? flags_
+                                                           : segments_;
+    }
+
+    Items const flags_;
+    Items const segments_;
+};
+
+template <typename Predicate>
+bool WaitFor(Predicate&& predicate,
+             std::chrono::milliseconds const timeout = std::chrono::seconds(5)) {
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
 class LazyLoadTest : public ::testing::Test {
    public:
     std::string mock_reader_name = "fake reader";
@@ -338,3 +470,641 @@ TEST_F(LazyLoadTest, InitializeCalledAgainAfterTTL) {
         ASSERT_TRUE(lazy_load.Initialized());
     }
 }
+
+class LazyLoadDelayedReaderTest : public ::testing::Test {
+   public:
+    using TimePoint = data_systems::LazyLoad::ClockType::time_point;
+
+    static constexpr auto kRefreshTtl = std::chrono::seconds(10);
+    static constexpr auto kReaderDelay = std::chrono::milliseconds(100);
+
+    std::shared_ptr<DelayedDataReader> reader;
+    // The spy logger isn't thread-safe, and refreshes log from the
+    // background thread.
+    Logger const logger;
+    data_components::DataSourceStatusManager status_manager;
+    std::atomic<TimePoint> now;
+
+    LazyLoadDelayedReaderTest()
+        : reader(std::make_shared<DelayedDataReader>(kReaderDelay)),
+          logger(logging::NullLogger()),
+          now(TimePoint{std::chrono::seconds(0)}) {}
+
+    std::unique_ptr<data_systems::LazyLoad> MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy const policy) {
+        built::LazyLoadConfig const config{
+            built::LazyLoadConfig::EvictionPolicy::Disabled, kRefreshTtl,
+            reader, policy};
+        return std::make_unique<data_systems::LazyLoad>(
+            logger, config, status_manager, [this]() { return now.load(); });
+    }
+
+    void ExpireCache() {
+        now = now.load() + kRefreshTtl + std::chrono::seconds(1);
+    }
+};
+
+// Reader whose first Get returns immediately, and whose later Gets block
+// until Release is called. This holds a refresh in progress for as long as a
+// test needs. The test can also deliver change notifications meanwhile.
+class GatedDataReader : public integrations::ISerializedDataReader {
+   public:
+    GatedDataReader() : released_(release_.get_future().share()), gets_(0) {}
+
+    GetResult Get(integrations::ISerializedItemKind const& kind,
+                  std::string const& itemKey) const override {
+        auto const version = ++gets_;
+        if (version > 1) {
+            released_.wait();
+        }
+        return integrations::SerializedItemDescriptor{
+            version, false,
+            "{\"key\":\"" + itemKey +
+                "\",\"version\":" + std::to_string(version) + "}"};
+    }
+
+    AllResult All(
+        integrations::ISerializedItemKind const& kind) const override {
+        return AllResult::value_type{};
+    }
+
+    std::string const& Identity() const override {
+        static std::string const id = "gated reader";
+        return id;
+    }
+
+    bool Initialized() const override { return true; }
+
+    std::unique_ptr<IConnection> SubscribeToChanges(
+        ChangeHandler handler) override {
+        handler_ = std::move(handler);
+        return std::make_unique<Connection>(*this);
+    }
+
+    void Notify(std::string const& kind_namespace,
+                std::optional<std::string> const& item_key) const {
+        handler_(kind_namespace, item_key);
+    }
+
+    void Release() { release_.set_value(); }
+
+    [[nodiscard]] std::uint64_t Gets() const { return gets_; }
+
+   private:
+    class Connection final : public IConnection {
+       public:
+        explicit Connection(GatedDataReader& reader) : reader_(reader) {}
+        void Disconnect() override { reader_.handler_ = nullptr; }
+
+       private:
+        GatedDataReader& reader_;
+    };
+
+    std::promise<void> release_;
+    std::shared_future<void> released_;
+    mutable std::atomic<std::uint64_t> gets_;
+    ChangeHandler handler_;
+};
+
+class LazyLoadGatedReaderTest : public ::testing::Test {
+   public:
+    using TimePoint = data_systems::LazyLoad::ClockType::time_point;
+
+    static constexpr auto kRefreshTtl = std::chrono::seconds(10);
+    // Long enough that a read which isn't blocked on the refresh always
+    // completes within it.
+    static constexpr auto kUnblockedTimeout = std::chrono::seconds(10);
+
+    std::shared_ptr<GatedDataReader> reader;
+    Logger const logger;
+    data_components::DataSourceStatusManager status_manager;
+    std::atomic<TimePoint> now;
+
+    LazyLoadGatedReaderTest()
+        : reader(std::make_shared<GatedDataReader>()),
+          logger(logging::NullLogger()),
+          now(TimePoint{std::chrono::seconds(0)}) {}
+
+    std::unique_ptr<data_systems::LazyLoad> MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy const policy) {
+        built::LazyLoadConfig const config{
+            built::LazyLoadConfig::EvictionPolicy::Disabled, kRefreshTtl,
+            reader, policy};
+        return std::make_unique<data_systems::LazyLoad>(
+            logger, config, status_manager, [this]() { return now.load(); });
+    }
+
+    void ExpireCache() {
+        now = now.load() + kRefreshTtl + std::chrono::seconds(1);
+    }
+};
+
+TEST_F(LazyLoadGatedReaderTest, StaleReadDoesNotWaitForRefresh) {
+    auto const lazy_load = MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate);
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    ExpireCache();
+
+    // The refresh started by this read can't complete until the reader is
+    // released, so the read must be served from the cache.
+    auto stale_read = std::async(std::launch::async,
+                                 [&]() { return lazy_load->GetFlag("foo"); });
+    ASSERT_EQ(stale_read.wait_for(kUnblockedTimeout),
+              std::future_status::ready);
+    auto const flag = stale_read.get();
+    ASSERT_TRUE(flag);
+    ASSERT_EQ(flag->version, 1);
+
+    reader->Release();
+    ASSERT_TRUE(WaitFor([&]() {
+        auto const refreshed = lazy_load->GetFlag("foo");
+        return refreshed && refreshed->version == 2;
+    }));
+}
+
+TEST_F(LazyLoadGatedReaderTest, SynchronousStaleReadWaitsForRefresh) {
+    auto const lazy_load =
+        MakeLazyLoad(built::LazyLoadConfig::RefreshPolicy::Synchronous);
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    ExpireCache();
+
+    auto stale_read = std::async(std::launch::async,
+                                 [&]() { return lazy_load->GetFlag("foo"); });
+    // The read is blocked on the refresh, so it can't be ready however long
+    // this waits.
+    ASSERT_EQ(stale_read.wait_for(std::chrono::milliseconds(50)),
+              std::future_status::timeout);
+
+    reader->Release();
+    auto const flag = stale_read.get();
+    ASSERT_TRUE(flag);
+    ASSERT_EQ(flag->version, 2);
+}
+
+TEST_F(LazyLoadGatedReaderTest, ChangeDuringRefreshLeavesItemStale) {
+    auto const lazy_load =
+        MakeLazyLoad(built::LazyLoadConfig::RefreshPolicy::Synchronous);
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    ExpireCache();
+
+    auto refreshing_read = std::async(
+        std::launch::async, [&]() { return lazy_load->GetFlag("foo"); });
+    ASSERT_TRUE(WaitFor([&]() { return reader->Gets() == 2; }));
+
+    // The refresh has fetched version 2, which may predate this change, so
+    // it must not be marked fresh.
+    reader->Notify("features", "foo");
+    reader->Release();
+    ASSERT_EQ(refreshing_read.get()->version, 2);
+
+    ASSERT_EQ(lazy_load->GetFlag("foo")->version, 3);
+    ASSERT_EQ(lazy_load->GetFlag("foo")->version, 3);
+    ASSERT_EQ(reader->Gets(), 3);
+}
+
+TEST_F(LazyLoadGatedReaderTest, ChangeDuringBackgroundRefreshLeavesItemStale) {
+    auto const lazy_load = MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate);
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    ExpireCache();
+
+    ASSERT_EQ(lazy_load->GetFlag("foo")->version, 1);
+    ASSERT_TRUE(WaitFor([&]() { return reader->Gets() == 2; }));
+
+    // A notification for every flag has the same effect. The refresh already
+    // pending absorbs the one the notification would have started.
+    reader->Notify("features", std::nullopt);
+    reader->Release();
+
+    ASSERT_TRUE(WaitFor([&]() {
+        auto const refreshed = lazy_load->GetFlag("foo");
+        return refreshed && refreshed->version == 3;
+    }));
+}
+
+TEST_F(LazyLoadDelayedReaderTest, ServesStaleFlagThenRefreshedFlag) {
+    auto const lazy_load = MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate);
+
+    // A cache miss has nothing to serve, so it is fetched synchronously.
+    auto const flag1 = lazy_load->GetFlag("foo");
+    ASSERT_TRUE(flag1);
+    ASSERT_EQ(flag1->version, 1);
+
+    ExpireCache();
+
+    auto const flag2 = lazy_load->GetFlag("foo");
+    ASSERT_TRUE(flag2);
+    ASSERT_EQ(flag2->version, 1);
+
+    ASSERT_TRUE(WaitFor([&]() {
+        auto const flag = lazy_load->GetFlag("foo");
+        return flag && flag->version == 2;
+    }));
+    ASSERT_EQ(reader->Gets(), 2);
+}
+
+TEST_F(LazyLoadDelayedReaderTest, ConcurrentStaleReadsShareOneRefresh) {
+    auto const lazy_load = MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate);
+
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    ExpireCache();
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 8; i++) {
+        threads.emplace_back([&]() {
+            for (std::size_t j = 0; j < 50; j++) {
+                EXPECT_TRUE(lazy_load->GetFlag("foo"));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(WaitFor([&]() {
+        auto const flag = lazy_load->GetFlag("foo");
+        return flag && flag->version == 2;
+    }));
+    ASSERT_EQ(reader->Gets(), 2);
+}
+
+TEST_F(LazyLoadDelayedReaderTest, AllFlagsRefreshesInBackground) {
+    auto const lazy_load = MakeLazyLoad(
+        built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate);
+
+    auto const all_flags1 = lazy_load->AllFlags();
+    ASSERT_EQ(all_flags1.at("foo")->version, 1);
+
+    ExpireCache();
+
+    auto const all_flags2 = lazy_load->AllFlags();
+    ASSERT_EQ(all_flags2.at("foo")->version, 1);
+
+    ASSERT_TRUE(WaitFor([&]() {
+        return lazy_load->AllFlags().at("foo")->version == 2;
+    }));
+    ASSERT_EQ(reader->Alls(), 2);
+    ASSERT_EQ(reader->Gets(), 0);
+}
+
+TEST_F(LazyLoadDelayedReaderTest, ConcurrentMissesShareOneFetch) {
+    auto const lazy_load =
+        MakeLazyLoad(built::LazyLoadConfig::RefreshPolicy::Synchronous);
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 8; i++) {
+        threads.emplace_back([&]() {
+            while (!start) {
+                std::this_thread::yield();
+            }
+            auto const flag = lazy_load->GetFlag("foo");
+            EXPECT_TRUE(flag);
+            if (flag) {
+                EXPECT_EQ(flag->version, 1);
+            }
+        });
+    }
+    start = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(reader->Gets(), 1);
+}
+
+TEST_F(LazyLoadDelayedReaderTest,
+       ConcurrentMissesOfDifferentKindsAreNotShared) {
+    auto const lazy_load =
+        MakeLazyLoad(built::LazyLoadConfig::RefreshPolicy::Synchronous);
+
+    std::thread segment_thread(
+        [&]() { EXPECT_TRUE(lazy_load->GetSegment("foo")); });
+    ASSERT_TRUE(lazy_load->GetFlag("foo"));
+    segment_thread.join();
+
+    ASSERT_EQ(reader->Gets(), 2);
+}
+
+TEST_F(LazyLoadTest, FlagDependenciesArePrefetchedInBatches) {
+    auto const reader = std::make_shared<CountingDataReader>(
+        CountingDataReader::Items{
+            {"top",
+             R"({"key":"top","version":1,)"
+             R"("prerequisites":[{"key":"p1","variation":0},)"
+             R"({"key":"p2","variation":0}],)"
+             R"("rules":[{"variation":0,"clauses":[{"attribute":"key",)"
+             R"("op":"segmentMatch","values":["s1","s2"]}]}]})"},
+            {"p1",
+             R"({"key":"p1","version":1,)"
+             R"("prerequisites":[{"key":"p3","variation":0}]})"},
+            {"p2", R"({"key":"p2","version":1})"},
+            {"p3", R"({"key":"p3","version":1})"}},
+        CountingDataReader::Items{{"s1", R"({"key":"s1","version":1})"}});
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager);
+
+    ASSERT_TRUE(lazy_load.GetFlag("top"));
+
+    // One Get for the flag itself; then one batch for p1/p2, one for s1/s2,
+    // and one for p3 (a prerequisite of p1).
+    ASSERT_EQ(reader->gets, 1);
+    ASSERT_EQ(reader->get_manys, 3);
+
+    // Every dependency is now cached, including the knowledge that s2 doesn't
+    // exist.
+    ASSERT_TRUE(lazy_load.GetFlag("p1"));
+    ASSERT_TRUE(lazy_load.GetFlag("p2"));
+    ASSERT_TRUE(lazy_load.GetFlag("p3"));
+    ASSERT_TRUE(lazy_load.GetSegment("s1"));
+    ASSERT_FALSE(lazy_load.GetSegment("s2"));
+    ASSERT_EQ(reader->gets, 1);
+    ASSERT_EQ(reader->get_manys, 3);
+}
+
+static CountingDataReader::Items MakeFlags(std::size_t const count) {
+    CountingDataReader::Items flags;
+    for (std::size_t i = 0; i < count; i++) {
+        auto const key = "flag" + std::to_string(i);
+        flags.emplace(key, R"({"key":")" + key + R"(","version":1})");
+    }
+    return flags;
+}
+
+TEST_F(LazyLoadTest, BoundedCacheEvictsAndRefetches) {
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(10), CountingDataReader::Items{});
+
+    built::LazyLoadConfig config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+    config.cache_max_items = 4;
+
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager);
+
+    for (std::size_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(lazy_load.GetFlag("flag" + std::to_string(i)));
+    }
+    ASSERT_EQ(reader->gets, 10);
+
+    auto stats = lazy_load.GetCacheStats();
+    ASSERT_EQ(stats.misses, 10);
+    ASSERT_EQ(stats.hits, 0);
+    ASSERT_EQ(stats.items, 4);
+    ASSERT_EQ(stats.evictions, 6);
+    ASSERT_GT(stats.bytes, 0);
+
+    // Evicted flags are loaded again, rather than reported as missing.
+    for (std::size_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(lazy_load.GetFlag("flag" + std::to_string(i)));
+    }
+    ASSERT_GT(reader->gets, 10);
+
+    stats = lazy_load.GetCacheStats();
+    ASSERT_EQ(stats.hits + stats.misses, 20);
+    ASSERT_GT(stats.hits, 0);
+    ASSERT_LE(stats.items, 4);
+}
+
+TEST_F(LazyLoadTest, CountsLookupsAndRefreshesInMetrics) {
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(2), CountingDataReader::Items{});
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+
+    metrics::Registry registry;
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager,
+                                           &registry);
+
+    // The metrics are reported before the first lookup.
+    auto snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot.counters.at("lazy_load.cache_hits"), 0);
+    EXPECT_EQ(snapshot.counters.at("lazy_load.cache_misses"), 0);
+    EXPECT_EQ(snapshot.counters.at("lazy_load.refreshes"), 0);
+
+    ASSERT_TRUE(lazy_load.GetFlag("flag0"));
+    ASSERT_TRUE(lazy_load.GetFlag("flag0"));
+    ASSERT_TRUE(lazy_load.GetFlag("flag1"));
+
+    snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot.counters.at("lazy_load.cache_hits"), 1);
+    EXPECT_EQ(snapshot.counters.at("lazy_load.cache_misses"), 2);
+    EXPECT_EQ(snapshot.counters.at("lazy_load.refreshes"), 2);
+}
+
+TEST_F(LazyLoadTest, ExpiredMissingKeysArePruned) {
+    using TimePoint = data_systems::LazyLoad::ClockType::time_point;
+    constexpr auto kRefreshTtl = std::chrono::seconds(10);
+
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(1), CountingDataReader::Items{});
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled, kRefreshTtl, reader};
+
+    TimePoint now{std::chrono::seconds(0)};
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager,
+                                           [&]() { return now; });
+
+    ASSERT_TRUE(lazy_load.GetFlag("flag0"));
+    ASSERT_FALSE(lazy_load.GetFlag("missing"));
+
+    now += kRefreshTtl + std::chrono::seconds(1);
+
+    // Tracking another missing key prunes the expired entries.
+    ASSERT_FALSE(lazy_load.GetFlag("other"));
+
+    auto const before = lazy_load.GetCacheStats();
+
+    // The expired entry for the missing key was pruned, so it is a miss...
+    ASSERT_FALSE(lazy_load.GetFlag("missing"));
+    auto after = lazy_load.GetCacheStats();
+    EXPECT_EQ(after.misses, before.misses + 1);
+    EXPECT_EQ(after.hits, before.hits);
+
+    // ...while the cached flag's entry was kept, so that it is still a hit.
+    ASSERT_TRUE(lazy_load.GetFlag("flag0"));
+    after = lazy_load.GetCacheStats();
+    EXPECT_EQ(after.hits, before.hits + 1);
+}
+
+// With room for a single item, every insert evicts another thread's item.
+// An item which exists must never be reported as missing because of that.
+TEST_F(LazyLoadTest, SingleEntryCacheUnderConcurrentGets) {
+    constexpr std::size_t kNumKeys = 4;
+    CountingDataReader::Items segments;
+    for (std::size_t i = 0; i < kNumKeys; i++) {
+        auto const key = "segment" + std::to_string(i);
+        segments.emplace(key, R"({"key":")" + key + R"(","version":1})");
+    }
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(kNumKeys), std::move(segments));
+
+    built::LazyLoadConfig config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+    config.cache_max_items = 1;
+
+    // The spy logger isn't thread-safe.
+    Logger const null_logger{logging::NullLogger()};
+    data_systems::LazyLoad const lazy_load(null_logger, config,
+                                           status_manager);
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 8; t++) {
+        threads.emplace_back([&, t]() {
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i < 500; i++) {
+                auto const index = std::to_string((i + t) % kNumKeys);
+                auto const flag = lazy_load.GetFlag("flag" + index);
+                ASSERT_TRUE(flag);
+                ASSERT_TRUE(flag->item);
+                EXPECT_EQ(flag->item->key, "flag" + index);
+
+                auto const segment = lazy_load.GetSegment("segment" + index);
+                ASSERT_TRUE(segment);
+                ASSERT_TRUE(segment->item);
+                EXPECT_EQ(segment->item->key, "segment" + index);
+            }
+        });
+    }
+    start = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_LE(lazy_load.GetCacheStats().items, 1);
+}
+
+TEST_F(LazyLoadTest, BoundedCacheAllFlagsReturnsEveryFlag) {
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(5), CountingDataReader::Items{});
+
+    built::LazyLoadConfig config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+    config.cache_max_items = 2;
+
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager);
+
+    ASSERT_EQ(lazy_load.AllFlags().size(), 5);
+    ASSERT_LE(lazy_load.GetCacheStats().items, 2);
+
+    // The cache can't hold every flag, so it can't answer AllFlags on its own.
+    ASSERT_EQ(lazy_load.AllFlags().size(), 5);
+    ASSERT_EQ(reader->alls, 2);
+}
+
+TEST_F(LazyLoadTest, UnboundedCacheAllFlagsIsServedFromCache) {
+    auto const reader = std::make_shared<CountingDataReader>(
+        MakeFlags(5), CountingDataReader::Items{});
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled,
+        std::chrono::seconds(10), reader};
+
+    data_systems::LazyLoad const lazy_load(logger, config, status_manager);
+
+    ASSERT_EQ(lazy_load.AllFlags().size(), 5);
+    ASSERT_EQ(lazy_load.AllFlags().size(), 5);
+    ASSERT_EQ(reader->alls, 1);
+
+    auto const stats = lazy_load.GetCacheStats();
+    ASSERT_EQ(stats.evictions, 0);
+    ASSERT_EQ(stats.items, 0);
+}
+
+// Reader which lets the test deliver change notifications to its subscriber.
+class NotifyingDataReader : public DelayedDataReader {
+   public:
+    NotifyingDataReader() : DelayedDataReader(std::chrono::milliseconds(0)) {}
+
+    std::unique_ptr<IConnection> SubscribeToChanges(
+        ChangeHandler handler) override {
+        handler_ = std::move(handler);
+        return std::make_unique<Connection>(*this);
+    }
+
+    void Notify(std::string const& kind_namespace,
+                std::optional<std::string> const& item_key) const {
+        handler_(kind_namespace, item_key);
+    }
+
+    [[nodiscard]] bool Subscribed() const {
+        return static_cast<bool>(handler_);
+    }
+
+   private:
+    class Connection final : public IConnection {
+       public:
+        explicit Connection(NotifyingDataReader& reader) : reader_(reader) {}
+        void Disconnect() override { reader_.handler_ = nullptr; }
+
+       private:
+        NotifyingDataReader& reader_;
+    };
+
+    ChangeHandler handler_;
+};
+
+TEST_F(LazyLoadTest, ChangedItemsAreRefreshedBeforeTtl) {
+    auto const reader = std::make_shared<NotifyingDataReader>();
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled, std::chrono::hours(1),
+        reader};
+
+    {
+        data_systems::LazyLoad const lazy_load(logger, config, status_manager);
+        ASSERT_TRUE(reader->Subscribed());
+
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 1);
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 1);
+
+        reader->Notify("features", "foo");
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 2);
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 2);
+
+        // A notification which doesn't identify the item applies to every
+        // item of the kind.
+        reader->Notify("features", std::nullopt);
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 3);
+
+        // Other kinds, and items which aren't cached, are unaffected.
+        reader->Notify("segments", "foo");
+        reader->Notify("features", "bar");
+        ASSERT_EQ(lazy_load.GetFlag("foo")->version, 3);
+        ASSERT_EQ(reader->Gets(), 3);
+    }
+
+    ASSERT_FALSE(reader->Subscribed());
+}
+
+TEST_F(LazyLoadTest, ChangedItemsAreRefreshedInBackground) {
+    auto const reader = std::make_shared<NotifyingDataReader>();
+
+    built::LazyLoadConfig const config{
+        built::LazyLoadConfig::EvictionPolicy::Disabled, std::chrono::hours(1),
+        reader, built::LazyLoadConfig::RefreshPolicy::StaleWhileRevalidate};
+
+    // Refreshes log from the background thread.
+    Logger const null_logger = logging::NullLogger();
+    data_systems::LazyLoad const lazy_load(null_logger, config, status_manager);
+
+    ASSERT_EQ(lazy_load.GetFlag("foo")->version, 1);
+
+    reader->Notify("features", "foo");
+    ASSERT_TRUE(WaitFor([&] { return reader->Gets() == 2; }));
+    ASSERT_TRUE(WaitFor([&] { return lazy_load.GetFlag("foo")->version == 2; }));
+}
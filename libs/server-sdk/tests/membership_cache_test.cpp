@@ -2,11 +2,18 @@
 
 #include <data_components/big_segments/membership_cache.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+using launchdarkly::server_side::data_components::CompactMembership;
 using launchdarkly::server_side::data_components::MembershipCache;
-using launchdarkly::server_side::integrations::Membership;
+using launchdarkly::server_side::data_components::SegmentRefId;
 using namespace std::chrono_literals;
 
 namespace {
@@ -25,98 +32,162 @@ class FakeClock {
     std::chrono::steady_clock::time_point now_{};
 };
 
-Membership MemberOf(std::string const& segment_ref) {
-    return Membership::FromSegmentRefs({segment_ref}, {});
+std::shared_ptr<CompactMembership const> MemberOf(SegmentRefId segment_ref) {
+    return std::make_shared<CompactMembership const>(
+        std::vector<std::pair<SegmentRefId, bool>>{{segment_ref, true}});
 }
 
 }  // namespace
 
 TEST(MembershipCacheTest, MissOnAbsentKey) {
     MembershipCache cache(10, 1000ms);
-    EXPECT_FALSE(cache.Get("nobody").has_value());
+    EXPECT_FALSE(cache.Get("nobody"));
 }
 
 TEST(MembershipCacheTest, ReturnsStoredValue) {
     MembershipCache cache(10, 1000ms);
-    cache.Set("a", MemberOf("seg.g1"));
+    cache.Set("a", MemberOf(1));
 
     auto result = cache.Get("a");
-    ASSERT_TRUE(result.has_value());
-    EXPECT_EQ(true, result->CheckMembership("seg.g1"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(true, result->CheckMembership(1));
 }
 
 TEST(MembershipCacheTest, SetReplacesExistingValue) {
     MembershipCache cache(10, 1000ms);
-    cache.Set("a", MemberOf("first.g1"));
-    cache.Set("a", MemberOf("second.g1"));
+    cache.Set("a", MemberOf(1));
+    cache.Set("a", MemberOf(2));
 
     auto result = cache.Get("a");
-    ASSERT_TRUE(result.has_value());
-    EXPECT_FALSE(result->CheckMembership("first.g1").has_value());
-    EXPECT_EQ(true, result->CheckMembership("second.g1"));
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result->CheckMembership(1).has_value());
+    EXPECT_EQ(true, result->CheckMembership(2));
     EXPECT_EQ(1u, cache.Size());
 }
 
 TEST(MembershipCacheTest, EvictsLeastRecentlyUsedAtCapacity) {
     MembershipCache cache(2, 1000ms);
-    cache.Set("a", MemberOf("a.g1"));
-    cache.Set("b", MemberOf("b.g1"));
-    cache.Set("c", MemberOf("c.g1"));  // evicts "a", the LRU
+    cache.Set("a", MemberOf(1));
+    cache.Set("b", MemberOf(2));
+    cache.Set("c", MemberOf(3));  // evicts "a", the LRU
 
     EXPECT_EQ(2u, cache.Size());
-    EXPECT_FALSE(cache.Get("a").has_value());
-    EXPECT_TRUE(cache.Get("b").has_value());
-    EXPECT_TRUE(cache.Get("c").has_value());
+    EXPECT_FALSE(cache.Get("a"));
+    EXPECT_TRUE(cache.Get("b"));
+    EXPECT_TRUE(cache.Get("c"));
 }
 
 TEST(MembershipCacheTest, GetRefreshesRecency) {
     MembershipCache cache(2, 1000ms);
-    cache.Set("a", MemberOf("a.g1"));
-    cache.Set("b", MemberOf("b.g1"));
+    cache.Set("a", MemberOf(1));
+    cache.Set("b", MemberOf(2));
 
     // Touch "a" so "b" becomes the least-recently-used.
-    EXPECT_TRUE(cache.Get("a").has_value());
+    EXPECT_TRUE(cache.Get("a"));
 
-    cache.Set("c", MemberOf("c.g1"));  // evicts "b" now, not "a"
+    cache.Set("c", MemberOf(3));  // evicts "b" now, not "a"
 
-    EXPECT_TRUE(cache.Get("a").has_value());
-    EXPECT_FALSE(cache.Get("b").has_value());
-    EXPECT_TRUE(cache.Get("c").has_value());
+    EXPECT_TRUE(cache.Get("a"));
+    EXPECT_FALSE(cache.Get("b"));
+    EXPECT_TRUE(cache.Get("c"));
 }
 
 TEST(MembershipCacheTest, ExpiresAfterTtlAndIsRemoved) {
     FakeClock clock;
     MembershipCache cache(10, 1000ms, clock.AsFn());
-    cache.Set("a", MemberOf("a.g1"));
+    cache.Set("a", MemberOf(1));
 
     clock.Advance(999ms);
-    EXPECT_TRUE(cache.Get("a").has_value());
+    EXPECT_TRUE(cache.Get("a"));
 
     clock.Advance(1ms);  // now exactly at the TTL boundary
-    EXPECT_FALSE(cache.Get("a").has_value());
+    EXPECT_FALSE(cache.Get("a"));
     EXPECT_EQ(0u, cache.Size());  // the expired entry is dropped, not retained
 }
 
 TEST(MembershipCacheTest, SetResetsExpiration) {
     FakeClock clock;
     MembershipCache cache(10, 1000ms, clock.AsFn());
-    cache.Set("a", MemberOf("a.g1"));
+    cache.Set("a", MemberOf(1));
 
     clock.Advance(600ms);
-    cache.Set("a", MemberOf("a.g1"));  // re-insert resets the TTL
+    cache.Set("a", MemberOf(1));  // re-insert resets the TTL
 
     clock.Advance(600ms);  // 1200ms since first set, 600ms since the second
-    EXPECT_TRUE(cache.Get("a").has_value());
+    EXPECT_TRUE(cache.Get("a"));
 }
 
 TEST(MembershipCacheTest, ClearRemovesEverything) {
     MembershipCache cache(10, 1000ms);
-    cache.Set("a", MemberOf("a.g1"));
-    cache.Set("b", MemberOf("b.g1"));
+    cache.Set("a", MemberOf(1));
+    cache.Set("b", MemberOf(2));
 
     cache.Clear();
 
     EXPECT_EQ(0u, cache.Size());
-    EXPECT_FALSE(cache.Get("a").has_value());
-    EXPECT_FALSE(cache.Get("b").has_value());
+    EXPECT_FALSE(cache.Get("a"));
+    EXPECT_FALSE(cache.Get("b"));
+}
+
+TEST(MembershipCacheTest, ShardedCacheRespectsCapacity) {
+    MembershipCache cache(1000, 1000ms);
+    for (int i = 0; i < 5000; i++) {
+        cache.Set("ctx" + std::to_string(i), MemberOf(1));
+        ASSERT_LE(cache.Size(), 1000u);
+    }
+    EXPECT_EQ(1000u, cache.Size());
+
+    // The most recent insertions into every shard are still resident.
+    EXPECT_TRUE(cache.Get("ctx4999"));
+}
+
+TEST(MembershipCacheTest, FrequentlyReadEntriesSurviveEviction) {
+    MembershipCache cache(1000, 1000ms);
+    for (int i = 0; i < 100; i++) {
+        cache.Set("hot" + std::to_string(i), MemberOf(1));
+    }
+
+    // Insert twice the capacity of entries which are never read, reading the
+    // hot entries regularly in between.
+    for (int i = 0; i < 2000; i++) {
+        if (i % 100 == 0) {
+            for (int j = 0; j < 100; j++) {
+                (void)cache.Get("hot" + std::to_string(j));
+            }
+        }
+        cache.Set("cold" + std::to_string(i), MemberOf(1));
+    }
+
+    int hot_resident = 0;
+    for (int j = 0; j < 100; j++) {
+        hot_resident += cache.Get("hot" + std::to_string(j)) != nullptr;
+    }
+    EXPECT_GE(hot_resident, 90);
+}
+
+TEST(MembershipCacheTest, ConcurrentReadersAndWriters) {
+    MembershipCache cache(256, 1000ms);
+    std::atomic<int> hits{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&cache, &hits, t] {
+            for (int i = 0; i < 5000; i++) {
+                SegmentRefId const id = (i * 7 + t) % 512;
+                auto const key = "ctx" + std::to_string(id);
+                if (i % 4 == 0) {
+                    cache.Set(key, MemberOf(id));
+                } else if (auto result = cache.Get(key)) {
+                    EXPECT_EQ(true, result->CheckMembership(id));
+                    hits++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_GT(hits.load(), 0);
+    EXPECT_LE(cache.Size(), 256u);
 }
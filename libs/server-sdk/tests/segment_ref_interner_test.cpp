@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <data_components/big_segments/segment_ref_interner.hpp>
+
+#include <utility>
+#include <vector>
+
+using launchdarkly::server_side::data_components::CompactMembership;
+using launchdarkly::server_side::data_components::SegmentRefId;
+using launchdarkly::server_side::data_components::SegmentRefInterner;
+using launchdarkly::server_side::integrations::Membership;
+
+TEST(CompactMembershipTest, EmptyHasNoEntries) {
+    CompactMembership const membership;
+    ASSERT_EQ(membership.Size(), 0);
+    ASSERT_FALSE(membership.CheckMembership(0).has_value());
+}
+
+TEST(CompactMembershipTest, ReturnsStateOfEachEntry) {
+    CompactMembership const membership(
+        std::vector<std::pair<SegmentRefId, bool>>{
+            {7, true}, {2, false}, {100000, true}});
+
+    ASSERT_EQ(membership.Size(), 3);
+    ASSERT_EQ(membership.CheckMembership(7), true);
+    ASSERT_EQ(membership.CheckMembership(2), false);
+    ASSERT_EQ(membership.CheckMembership(100000), true);
+    ASSERT_FALSE(membership.CheckMembership(3).has_value());
+}
+
+TEST(CompactMembershipTest, InclusionWinsOverExclusion) {
+    CompactMembership const membership(
+        std::vector<std::pair<SegmentRefId, bool>>{
+            {1, true}, {1, false}, {2, false}, {2, true}});
+
+    ASSERT_EQ(membership.Size(), 2);
+    ASSERT_EQ(membership.CheckMembership(1), true);
+    ASSERT_EQ(membership.CheckMembership(2), true);
+}
+
+TEST(SegmentRefInternerTest, UnknownRefIsNotFound) {
+    SegmentRefInterner const interner;
+    ASSERT_FALSE(interner.Find("seg", 1).has_value());
+}
+
+TEST(SegmentRefInternerTest, CompactInternsRefs) {
+    SegmentRefInterner interner;
+    auto const membership = interner.Compact(
+        Membership::FromSegmentRefs({"seg1.g1", "seg.with.dots.g20"},
+                                    {"seg2.g3"}));
+
+    auto const seg1 = interner.Find("seg1", 1);
+    auto const dotted = interner.Find("seg.with.dots", 20);
+    auto const seg2 = interner.Find("seg2", 3);
+    ASSERT_TRUE(seg1 && dotted && seg2);
+    ASSERT_EQ(interner.Size(), 3);
+
+    ASSERT_EQ(membership.CheckMembership(*seg1), true);
+    ASSERT_EQ(membership.CheckMembership(*dotted), true);
+    ASSERT_EQ(membership.CheckMembership(*seg2), false);
+
+    // A different generation of a known segment is a different ref.
+    ASSERT_FALSE(interner.Find("seg1", 2).has_value());
+}
+
+TEST(SegmentRefInternerTest, RefsKeepTheirIds) {
+    SegmentRefInterner interner;
+    (void)interner.Compact(Membership::FromSegmentRefs({"a.g1"}, {}));
+    auto const id = interner.Find("a", 1);
+
+    auto const membership = interner.Compact(
+        Membership::FromSegmentRefs({"b.g1"}, {"a.g1"}));
+    ASSERT_EQ(interner.Find("a", 1), id);
+    ASSERT_EQ(membership.CheckMembership(*id), false);
+    ASSERT_EQ(interner.Size(), 2);
+}
+
+TEST(SegmentRefInternerTest, MalformedRefsAreDropped) {
+    SegmentRefInterner interner;
+    auto const membership = interner.Compact(Membership::FromSegmentRefs(
+        {"nogeneration", "seg.g", "seg.gx", "seg.g99999999999999999999"},
+        {}));
+
+    ASSERT_EQ(membership.Size(), 0);
+    ASSERT_EQ(interner.Size(), 0);
+}
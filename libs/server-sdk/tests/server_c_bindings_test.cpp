@@ -12,6 +12,7 @@
 #include <boost/json/parse.hpp>
 
 #include <chrono>
+#include <cstring>
 
 TEST(ClientBindings, MinimalInstantiation) {
     LDServerConfigBuilder cfg_builder = LDServerConfigBuilder_New("sdk-123");
@@ -174,6 +175,41 @@ TEST(ClientBindings, AllFlagsState) {
     LDServerSDK_Free(sdk);
 }
 
+TEST(ClientBindings, AllFlagsStateJSON) {
+    LDServerConfigBuilder cfg_builder = LDServerConfigBuilder_New("sdk-123");
+
+    LDServerConfig config;
+    LDStatus status = LDServerConfigBuilder_Build(cfg_builder, &config);
+    ASSERT_TRUE(LDStatus_Ok(status));
+
+    LDServerSDK sdk = LDServerSDK_New(config);
+
+    LDContextBuilder ctx_builder = LDContextBuilder_New();
+    LDContextBuilder_AddKind(ctx_builder, "user", "shadow");
+    LDContext context = LDContextBuilder_Build(ctx_builder);
+
+    char const* const expected = "{\"$valid\":false,\"$flagsState\":{}}";
+    size_t const expected_length = strlen(expected);
+
+    char small[8];
+    size_t length = 0;
+    ASSERT_FALSE(LDServerSDK_AllFlagsStateJSON(sdk, context,
+                                               LD_ALLFLAGSSTATE_DEFAULT, small,
+                                               sizeof(small), &length));
+    ASSERT_EQ(length, expected_length);
+
+    char buffer[64];
+    length = 0;
+    ASSERT_TRUE(LDServerSDK_AllFlagsStateJSON(sdk, context,
+                                              LD_ALLFLAGSSTATE_DEFAULT, buffer,
+                                              sizeof(buffer), &length));
+    ASSERT_EQ(length, expected_length);
+    ASSERT_STREQ(buffer, expected);
+
+    LDContext_Free(context);
+    LDServerSDK_Free(sdk);
+}
+
 TEST(ClientBindings, DoubleVariationPassesThroughDefault) {
     LDServerConfigBuilder cfg_builder = LDServerConfigBuilder_New("sdk-123");
 
@@ -201,6 +237,49 @@ TEST(ClientBindings, DoubleVariationPassesThroughDefault) {
     LDContext_Free(context);
 }
 
+TEST(ClientBindings, JsonVariationDetailsPassThroughDefaults) {
+    LDServerConfigBuilder cfg_builder = LDServerConfigBuilder_New("sdk-123");
+
+    LDServerConfig config;
+    LDStatus status = LDServerConfigBuilder_Build(cfg_builder, &config);
+    ASSERT_TRUE(LDStatus_Ok(status));
+
+    LDServerSDK sdk = LDServerSDK_New(config);
+
+    LDContextBuilder ctx_builder = LDContextBuilder_New();
+    LDContextBuilder_AddKind(ctx_builder, "user", "shadow");
+    LDContext context = LDContextBuilder_Build(ctx_builder);
+
+    char const* keys[] = {"weight", "treat", "extra-cat-food"};
+    LDValue defaults[] = {LDValue_NewNumber(12.5), LDValue_NewString("fish"),
+                          LDValue_NewBool(true)};
+    struct LDServerEvaluationResult results[3];
+
+    LDServerSDK_JsonVariationDetails(sdk, context, keys, defaults, 3, results);
+
+    EXPECT_EQ(LDValue_GetNumber(results[0].Value), 12.5);
+    EXPECT_STREQ(LDValue_GetString(results[1].Value), "fish");
+    EXPECT_TRUE(LDValue_GetBool(results[2].Value));
+    for (auto const& result : results) {
+        EXPECT_EQ(result.VariationIndex, -1);
+        EXPECT_EQ(result.ReasonKind, LD_EVALREASON_ERROR);
+        // The client was never started.
+        EXPECT_EQ(result.ErrorKind, LD_EVALREASON_ERROR_CLIENT_NOT_READY);
+    }
+
+    LDServerEvaluationResults_Free(results, 3);
+    for (auto value : defaults) {
+        LDValue_Free(value);
+    }
+
+    // An empty batch is allowed.
+    LDServerSDK_JsonVariationDetails(sdk, context, nullptr, nullptr, 0,
+                                     nullptr);
+
+    LDServerSDK_Free(sdk);
+    LDContext_Free(context);
+}
+
 TEST(ClientBindings, CanSetEventConfigurationSuccessfully) {
     LDServerConfigBuilder cfg_builder = LDServerConfigBuilder_New("sdk-123");
 
@@ -236,6 +315,10 @@ TEST(ClientBindings, LazyLoadDataSource) {
     LDServerLazyLoadBuilder_CachePolicy(
         lazy_builder, LD_LAZYLOAD_CACHE_EVICTION_POLICY_DISABLED);
     LDServerLazyLoadBuilder_CacheRefreshMs(lazy_builder, 1000);
+    LDServerLazyLoadBuilder_CacheRefreshPolicy(
+        lazy_builder, LD_LAZYLOAD_CACHE_REFRESH_POLICY_STALE_WHILE_REVALIDATE);
+    LDServerLazyLoadBuilder_CacheMaxItems(lazy_builder, 1000);
+    LDServerLazyLoadBuilder_CacheMaxBytes(lazy_builder, 1024 * 1024);
 
     LDServerConfigBuilder_DataSystem_LazyLoad(cfg_builder, lazy_builder);
 
@@ -34,6 +34,11 @@ class SpyEventProcessor : public events::IEventProcessor {
                << "Expected " << count << " events, got " << events_.size();
     }
 
+    /**
+     * @return The events recorded so far, in the order they were sent.
+     */
+    [[nodiscard]] std::vector<Record> const& Events() const { return events_; }
+
     template <typename T>
     [[nodiscard]] testing::AssertionResult Kind(std::size_t index) const {
         return GetIndex(index, [&](auto const& actual) {
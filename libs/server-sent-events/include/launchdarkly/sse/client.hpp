@@ -103,6 +103,17 @@ class Builder {
      */
     Builder& initial_reconnect_delay(std::chrono::milliseconds delay);
 
+    /**
+     * Use "decorrelated jitter" when backing off, instead of the default
+     * proportional jitter. Each delay is chosen randomly between the initial
+     * reconnect delay and three times the previous delay, which spreads out
+     * the reconnections of many clients that lost their connections at the
+     * same time.
+     * @param enabled True to use decorrelated jitter.
+     * @return Reference to this builder.
+     */
+    Builder& decorrelated_jitter(bool enabled);
+
     /**
      * Specify the method for the initial request. The default method is GET.
      * @param verb The HTTP method.
@@ -228,6 +239,7 @@ class Builder {
     std::optional<std::chrono::milliseconds> write_timeout_;
     std::optional<std::chrono::milliseconds> connect_timeout_;
     std::optional<std::chrono::milliseconds> initial_reconnect_delay_;
+    bool decorrelated_jitter_;
     LogCallback logging_cb_;
     EventReceiver receiver_;
     ErrorCallback error_cb_;
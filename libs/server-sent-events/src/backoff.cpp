@@ -7,6 +7,9 @@ static constexpr auto kDefaultResetInterval = std::chrono::milliseconds{60'000};
 namespace launchdarkly::sse {
 
 std::chrono::milliseconds Backoff::delay() const {
+    if (jitter_ == Jitter::kDecorrelated) {
+        return decorrelated_delay_;
+    }
     return detail::delay(initial_, max_, attempt_, max_exponent_, jitter_ratio_,
                          random_);
 }
@@ -31,6 +34,14 @@ void Backoff::fail() {
     }
     // There has been a failure, so the connection is no longer active.
     active_since_ = std::nullopt;
+
+    if (jitter_ == Jitter::kDecorrelated) {
+        // The sequence restarts from the initial delay whenever the attempts
+        // are reset.
+        auto const previous = attempt_ == 1 ? initial_ : decorrelated_delay_;
+        decorrelated_delay_ =
+            detail::decorrelated_delay(initial_, max_, previous, random_);
+    }
 }
 
 void Backoff::succeed() {
@@ -42,6 +53,19 @@ Backoff::Backoff(std::chrono::milliseconds initial,
                  double jitter_ratio,
                  std::chrono::milliseconds reset_interval,
                  std::function<double(double ratio)> random)
+    : Backoff(initial,
+              max,
+              jitter_ratio,
+              reset_interval,
+              std::move(random),
+              Jitter::kProportional) {}
+
+Backoff::Backoff(std::chrono::milliseconds initial,
+                 std::chrono::milliseconds max,
+                 double jitter_ratio,
+                 std::chrono::milliseconds reset_interval,
+                 std::function<double(double ratio)> random,
+                 Jitter jitter)
     : initial_(initial),
       max_(max),
       // This is necessary to constrain the exponent that is passed eventually
@@ -55,17 +79,25 @@ Backoff::Backoff(std::chrono::milliseconds initial,
       attempt_(1),
       jitter_ratio_(jitter_ratio),
       reset_interval_(reset_interval),
+      jitter_(jitter),
+      decorrelated_delay_(initial),
       random_(std::move(random)) {}
 
 Backoff::Backoff(std::chrono::milliseconds initial,
                  std::chrono::milliseconds max)
+    : Backoff(initial, max, Jitter::kProportional) {}
+
+Backoff::Backoff(std::chrono::milliseconds initial,
+                 std::chrono::milliseconds max,
+                 Jitter jitter)
     : Backoff(initial,
               max,
               kDefaultJitterRatio,
               kDefaultResetInterval,
               [this](auto ratio) {
-                  std::uniform_real_distribution<double> distribution(
-                      0.0, kDefaultJitterRatio);
+                  std::uniform_real_distribution<double> distribution(0.0,
+                                                                      ratio);
                   return distribution(this->random_gen_);
-              }) {}
+              },
+              jitter) {}
 }  // namespace launchdarkly::sse
@@ -12,6 +12,24 @@ namespace launchdarkly::sse {
  */
 class Backoff {
    public:
+    /**
+     * How the exponential delay is randomized.
+     */
+    enum class Jitter {
+        /**
+         * The delay doubles with each attempt and is reduced by a random
+         * proportion of up to jitter_ratio.
+         */
+        kProportional,
+        /**
+         * "Decorrelated jitter": each delay is chosen uniformly between the
+         * initial delay and three times the previous delay. Clients which
+         * disconnect at the same moment quickly spread out, instead of
+         * reconnecting within the same narrow window.
+         */
+        kDecorrelated,
+    };
+
     /**
      * Construct a backoff instance with customized behavior.
      * @param initial Initial delay for the first failed connection.
@@ -31,6 +49,26 @@ class Backoff {
             std::chrono::milliseconds reset_interval,
             std::function<double(double ratio)> random);
 
+    /**
+     * Construct a backoff instance with customized behavior and jitter
+     * strategy.
+     * @param initial Initial delay for the first failed connection.
+     * @param max The maximum delay between retries.
+     * @param jitter_ratio The ratio to use when jittering. Only used by
+     * Jitter::kProportional.
+     * @param reset_interval The milliseconds interval to reset the backoff
+     * attempts after a successful connection.
+     * @param random A random method which produces a value between 0 and
+     * the ratio it is given. Primarily intended for testing.
+     * @param jitter The jitter strategy.
+     */
+    Backoff(std::chrono::milliseconds initial,
+            std::chrono::milliseconds max,
+            double jitter_ratio,
+            std::chrono::milliseconds reset_interval,
+            std::function<double(double ratio)> random,
+            Jitter jitter);
+
     /**
      * Construct a backoff instance with default behavior.
      * @param initial Initial delay for the first failed connection.
@@ -38,6 +76,17 @@ class Backoff {
      */
     Backoff(std::chrono::milliseconds initial, std::chrono::milliseconds max);
 
+    /**
+     * Construct a backoff instance with default behavior and the given
+     * jitter strategy.
+     * @param initial Initial delay for the first failed connection.
+     * @param max The maximum delay between retries.
+     * @param jitter The jitter strategy.
+     */
+    Backoff(std::chrono::milliseconds initial,
+            std::chrono::milliseconds max,
+            Jitter jitter);
+
     /**
      * Report to the backoff that their was a connection failure.
      */
@@ -63,8 +112,13 @@ class Backoff {
         active_since_;
     double const jitter_ratio_;
     std::chrono::milliseconds const reset_interval_;
+    Jitter const jitter_;
+    // The most recent delay chosen by Jitter::kDecorrelated.
+    std::chrono::milliseconds decorrelated_delay_;
     // Default random generator. Used when random method not specified.
     std::function<double(double ratio)> random_;
-    std::default_random_engine random_gen_;
+    // Seeded per instance, so that processes started at the same moment do
+    // not produce identical jitter.
+    std::default_random_engine random_gen_{std::random_device{}()};
 };
 }  // namespace launchdarkly::sse
@@ -32,4 +32,16 @@ std::chrono::milliseconds delay(std::chrono::milliseconds const initial,
     auto const constrained_backoff = std::min(backoff, max);
     return jitter(constrained_backoff, jitter_ratio, random);
 }
+
+std::chrono::milliseconds decorrelated_delay(
+    std::chrono::milliseconds const initial,
+    std::chrono::milliseconds const max,
+    std::chrono::milliseconds const previous,
+    std::function<double(double)> const& random) {
+    auto const upper = static_cast<double>(previous.count()) * 3;
+    auto const lower = static_cast<double>(initial.count());
+    double const chosen = lower + random(1.0) * std::max(upper - lower, 0.0);
+    return std::min(
+        std::chrono::milliseconds(static_cast<uint64_t>(chosen)), max);
+}
 }  // namespace launchdarkly::sse::detail
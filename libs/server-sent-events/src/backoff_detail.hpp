@@ -49,4 +49,23 @@ std::chrono::milliseconds delay(std::chrono::milliseconds initial,
                                 std::uint64_t max_exponent,
                                 double jitter_ratio,
                                 std::function<double(double)> const& random);
+
+/**
+ * Calculate the next delay using "decorrelated jitter". The delay is chosen
+ * uniformly between the initial delay and three times the previous delay,
+ * and constrained by the maximum.
+ *
+ * @param initial The initial retry delay.
+ * @param max The maximum delay between retries.
+ * @param previous The previous delay, or the initial delay for the first
+ * attempt.
+ * @param random A random method which produces a value between 0 and the
+ * ratio it is given.
+ * @return The delay between connection attempts.
+ */
+std::chrono::milliseconds decorrelated_delay(
+    std::chrono::milliseconds initial,
+    std::chrono::milliseconds max,
+    std::chrono::milliseconds previous,
+    std::function<double(double)> const& random);
 }  // namespace launchdarkly::sse::detail
@@ -76,7 +76,8 @@ class FoxyClient : public Client,
                Builder::ErrorCallback errors,
                Builder::ConnectionHook connection_hook,
                Builder::ResponseHook response_hook,
-               std::optional<net::ssl::context> maybe_ssl)
+               std::optional<net::ssl::context> maybe_ssl,
+               bool decorrelated_jitter)
         : ssl_context_(std::move(maybe_ssl)),
           host_(std::move(host)),
           port_(std::move(port)),
@@ -94,7 +95,9 @@ class FoxyClient : public Client,
           last_event_id_(std::nullopt),
           backoff_(
               initial_reconnect_delay.value_or(kDefaultInitialReconnectDelay),
-              kDefaultMaxBackoffDelay),
+              kDefaultMaxBackoffDelay,
+              decorrelated_jitter ? Backoff::Jitter::kDecorrelated
+                                  : Backoff::Jitter::kProportional),
           backoff_timer_(std::move(executor)),
           last_read_(std::nullopt),
           shutting_down_(false) {
@@ -565,6 +568,7 @@ Builder::Builder(net::any_io_executor ctx, std::string url)
       write_timeout_{std::nullopt},
       connect_timeout_{std::nullopt},
       initial_reconnect_delay_{std::nullopt},
+      decorrelated_jitter_(false),
       logging_cb_([](auto msg) {}),
       receiver_([](launchdarkly::sse::Event const&) {}),
       error_cb_([](auto err) {}),
@@ -608,6 +612,11 @@ Builder& Builder::initial_reconnect_delay(std::chrono::milliseconds delay) {
     return *this;
 }
 
+Builder& Builder::decorrelated_jitter(bool enabled) {
+    decorrelated_jitter_ = enabled;
+    return *this;
+}
+
 Builder& Builder::method(http::verb verb) {
     request_.method(verb);
     return *this;
@@ -712,7 +721,8 @@ std::shared_ptr<Client> Builder::build() {
         net::make_strand(executor_), request, host, service, connect_timeout_,
         read_timeout_, write_timeout_, initial_reconnect_delay_, receiver_,
         logging_cb_, error_cb_, connection_hook_, response_hook_,
-        skip_verify_peer_, custom_ca_file_, use_https, proxy_url_);
+        skip_verify_peer_, custom_ca_file_, use_https, proxy_url_,
+        decorrelated_jitter_);
 #else
     std::optional<ssl::context> ssl;
     if (uri_components->scheme_id() == boost::urls::scheme::https) {
@@ -735,7 +745,7 @@ std::shared_ptr<Client> Builder::build() {
         net::make_strand(executor_), request, host, service, connect_timeout_,
         read_timeout_, write_timeout_, initial_reconnect_delay_, receiver_,
         logging_cb_, error_cb_, connection_hook_, response_hook_,
-        std::move(ssl));
+        std::move(ssl), decorrelated_jitter_);
 #endif
 }
 
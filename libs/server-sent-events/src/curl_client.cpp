@@ -48,7 +48,8 @@ CurlClient::CurlClient(
     bool skip_verify_peer,
     std::optional<std::string> custom_ca_file,
     bool use_https,
-    std::optional<std::string> proxy_url)
+    std::optional<std::string> proxy_url,
+    bool decorrelated_jitter)
     : host_(std::move(host)),
       port_(std::move(port)),
       event_receiver_(std::move(receiver)),
@@ -58,9 +59,11 @@ CurlClient::CurlClient(
       response_hook_(std::move(response_hook)),
       use_https_(use_https),
       backoff_timer_(executor),
-      multi_manager_(CurlMultiManager::create(executor)),
+      multi_manager_(CurlMultiManager::shared(executor)),
       backoff_(initial_reconnect_delay.value_or(kDefaultInitialReconnectDelay),
-               kDefaultMaxBackoffDelay) {
+               kDefaultMaxBackoffDelay,
+               decorrelated_jitter ? Backoff::Jitter::kDecorrelated
+                                   : Backoff::Jitter::kProportional) {
     request_context_ = std::make_shared<RequestContext>(
         build_url(req), std::move(req), connect_timeout, read_timeout,
         write_timeout, std::move(custom_ca_file), std::move(proxy_url),
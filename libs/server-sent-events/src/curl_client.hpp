@@ -265,7 +265,8 @@ class CurlClient final : public Client,
                bool skip_verify_peer,
                std::optional<std::string> custom_ca_file,
                bool use_https,
-               std::optional<std::string> proxy_url);
+               std::optional<std::string> proxy_url,
+               bool decorrelated_jitter);
 
     ~CurlClient() override;
 
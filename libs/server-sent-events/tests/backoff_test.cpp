@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <numeric>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include "backoff.hpp"
 #include "backoff_detail.hpp"
@@ -196,3 +198,95 @@ INSTANTIATE_TEST_SUITE_P(VariousBackoffAttempts,
                              10000,
                              100000,
                              std::numeric_limits<std::uint64_t>::max()));
+
+TEST(BackoffTests, DecorrelatedJitterStartsAtInitial) {
+    Backoff backoff(
+        std::chrono::milliseconds{1000}, std::chrono::milliseconds{30000}, 0,
+        std::chrono::milliseconds{60000}, [](auto ratio) { return 0.5; },
+        Backoff::Jitter::kDecorrelated);
+
+    EXPECT_EQ(1000, backoff.delay().count());
+}
+
+TEST(BackoffTests, DecorrelatedJitterGrowsFromPreviousDelay) {
+    Backoff backoff(
+        std::chrono::milliseconds{1000}, std::chrono::milliseconds{30000}, 0,
+        std::chrono::milliseconds{60000}, [](auto ratio) { return 0.5; },
+        Backoff::Jitter::kDecorrelated);
+
+    // Each delay is halfway between the initial delay and three times the
+    // previous delay.
+    backoff.fail();
+    EXPECT_EQ(2000, backoff.delay().count());
+
+    backoff.fail();
+    EXPECT_EQ(3500, backoff.delay().count());
+
+    backoff.fail();
+    EXPECT_EQ(5750, backoff.delay().count());
+}
+
+TEST(BackoffTests, DecorrelatedJitterRespectsMax) {
+    Backoff backoff(
+        std::chrono::milliseconds{1000}, std::chrono::milliseconds{30000}, 0,
+        std::chrono::milliseconds{60000}, [](auto ratio) { return 1.0; },
+        Backoff::Jitter::kDecorrelated);
+
+    std::vector<std::int64_t> delays;
+    for (int i = 0; i < 6; i++) {
+        backoff.fail();
+        delays.push_back(backoff.delay().count());
+    }
+
+    EXPECT_EQ(delays, (std::vector<std::int64_t>{3000, 9000, 27000, 30000,
+                                                 30000, 30000}));
+}
+
+TEST(BackoffTests, DecorrelatedJitterNeverBelowInitial) {
+    Backoff backoff(
+        std::chrono::milliseconds{1000}, std::chrono::milliseconds{30000}, 0,
+        std::chrono::milliseconds{60000}, [](auto ratio) { return 0; },
+        Backoff::Jitter::kDecorrelated);
+
+    for (int i = 0; i < 10; i++) {
+        backoff.fail();
+        EXPECT_EQ(1000, backoff.delay().count());
+    }
+}
+
+TEST(BackoffTests, DecorrelatedJitterResetsAfterResetInterval) {
+    Backoff backoff(
+        std::chrono::milliseconds{1000}, std::chrono::milliseconds{30000}, 0,
+        std::chrono::milliseconds{50}, [](auto ratio) { return 1.0; },
+        Backoff::Jitter::kDecorrelated);
+
+    backoff.fail();     // 3000
+    backoff.fail();     // 9000
+    backoff.succeed();  // Still 9000
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The sequence restarts from the initial delay.
+    backoff.fail();
+    EXPECT_EQ(3000, backoff.delay().count());
+}
+
+TEST(BackoffTests, DefaultDecorrelatedBackoffsAreNotCorrelated) {
+    // Backoffs constructed at the same moment must not produce the same
+    // sequence of delays; otherwise clients which disconnect together would
+    // also reconnect together.
+    constexpr auto kInitial = std::chrono::milliseconds{1000};
+    constexpr auto kMax = std::chrono::milliseconds{30000};
+
+    std::set<std::int64_t> delays;
+    for (int i = 0; i < 20; i++) {
+        Backoff backoff(kInitial, kMax, Backoff::Jitter::kDecorrelated);
+        backoff.fail();
+        backoff.fail();
+        auto const delay = backoff.delay();
+        EXPECT_GE(delay, kInitial);
+        EXPECT_LE(delay, kMax);
+        delays.insert(delay.count());
+    }
+    EXPECT_GT(delays.size(), 1);
+}
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <vector>
 
@@ -1508,6 +1509,85 @@ TEST(ClientTest, OnConnectHookLastEventIdIsManagedByClient) {
     EXPECT_TRUE(shutdown_latch.wait_for(5000ms));
 }
 
+TEST(ClientTest, MassDisconnectReconnectsAreSpreadAndResume) {
+    constexpr std::size_t kClients = 20;
+
+    MockSSEServer server;
+    std::mutex received_mutex;
+    std::condition_variable received_cv;
+    std::map<std::string, std::size_t> connects;
+    // Last-Event-ID and arrival time of each client's first reconnect.
+    std::map<std::string,
+             std::pair<std::string, std::chrono::steady_clock::time_point>>
+        reconnects;
+
+    auto port = server.start([&](auto const& req, auto send_response,
+                                 auto send_sse_event, auto close) {
+        std::string const id(req["X-Client-Id"]);
+        {
+            std::lock_guard lock(received_mutex);
+            bool const first = connects[id]++ == 0;
+            if (!first && reconnects.count(id) == 0) {
+                reconnects.emplace(
+                    id, std::make_pair(std::string(req["Last-Event-ID"]),
+                                       std::chrono::steady_clock::now()));
+                received_cv.notify_all();
+            }
+        }
+
+        http::response<http::string_body> res{http::status::ok, 11};
+        res.set(http::field::content_type, "text/event-stream");
+        res.chunked(true);
+        send_response(res);
+        send_sse_event(SSEFormatter::event("data", "", "evt-" + id));
+        // Every client loses its connection right after its first event.
+        std::this_thread::sleep_for(5ms);
+        close();
+    });
+
+    IoContextRunner runner;
+
+    std::vector<std::shared_ptr<Client>> clients;
+    for (std::size_t i = 0; i < kClients; i++) {
+        auto client = Builder(runner.context().get_executor(),
+                              "http://localhost:" + std::to_string(port))
+                          .header("X-Client-Id", std::to_string(i))
+                          .receiver([](Event) {})
+                          .initial_reconnect_delay(100ms)
+                          .decorrelated_jitter(true)
+                          .build();
+        client->async_connect();
+        clients.push_back(std::move(client));
+    }
+
+    {
+        std::unique_lock lock(received_mutex);
+        ASSERT_TRUE(received_cv.wait_for(
+            lock, 10000ms, [&] { return reconnects.size() >= kClients; }));
+    }
+
+    {
+        std::lock_guard lock(received_mutex);
+        auto earliest = std::chrono::steady_clock::time_point::max();
+        auto latest = std::chrono::steady_clock::time_point::min();
+        for (auto const& [id, reconnect] : reconnects) {
+            // Each client resumes from the last event it received.
+            EXPECT_EQ("evt-" + id, reconnect.first);
+            earliest = std::min(earliest, reconnect.second);
+            latest = std::max(latest, reconnect.second);
+        }
+        // Decorrelated jitter picks each first retry delay from [100ms,
+        // 300ms), so the reconnections should not arrive as a single burst.
+        EXPECT_GE(latest - earliest, 50ms);
+    }
+
+    SimpleLatch shutdown_latch(kClients);
+    for (auto const& client : clients) {
+        client->async_shutdown([&] { shutdown_latch.count_down(); });
+    }
+    EXPECT_TRUE(shutdown_latch.wait_for(5000ms));
+}
+
 TEST(ClientTest, OnResponseHookFiresWithCustomHeader) {
     MockSSEServer server;
     auto port = server.start(